@@ -0,0 +1,49 @@
+#include "AdjacencyIndex.hpp"
+#include <algorithm>
+
+namespace graph_analysis {
+
+void AdjacencyIndex::add(GraphElementId sourceId, GraphElementId targetId, GraphElementId edgeId)
+{
+    mEdges[ key(sourceId, targetId) ].push_back(edgeId);
+}
+
+void AdjacencyIndex::remove(GraphElementId sourceId, GraphElementId targetId, GraphElementId edgeId)
+{
+    boost::unordered_map<Key, EdgeIdList>::iterator it = mEdges.find( key(sourceId, targetId) );
+    if(it == mEdges.end())
+    {
+        return;
+    }
+
+    EdgeIdList& edgeIds = it->second;
+    EdgeIdList::iterator eit = std::find(edgeIds.begin(), edgeIds.end(), edgeId);
+    if(eit != edgeIds.end())
+    {
+        *eit = edgeIds.back();
+        edgeIds.pop_back();
+    }
+
+    if(edgeIds.empty())
+    {
+        mEdges.erase(it);
+    }
+}
+
+const AdjacencyIndex::EdgeIdList* AdjacencyIndex::find(GraphElementId sourceId, GraphElementId targetId) const
+{
+    boost::unordered_map<Key, EdgeIdList>::const_iterator cit = mEdges.find( key(sourceId, targetId) );
+    if(cit == mEdges.end())
+    {
+        return NULL;
+    }
+    return &cit->second;
+}
+
+size_t AdjacencyIndex::count(GraphElementId sourceId, GraphElementId targetId) const
+{
+    const EdgeIdList* edgeIds = find(sourceId, targetId);
+    return edgeIds ? edgeIds->size() : 0;
+}
+
+} // end namespace graph_analysis
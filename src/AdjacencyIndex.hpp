@@ -0,0 +1,63 @@
+#ifndef GRAPH_ANALYSIS_ADJACENCY_INDEX_HPP
+#define GRAPH_ANALYSIS_ADJACENCY_INDEX_HPP
+
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "GraphElement.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \class AdjacencyIndex
+ * \brief Hash index of the edges of a graph by the ids of their source and
+ * target vertex
+ * \details Gives O(1) expected lookup of the edges between two vertices,
+ * see BaseGraph::setAdjacencyIndexEnabled
+ */
+class AdjacencyIndex
+{
+public:
+    typedef std::vector<GraphElementId> EdgeIdList;
+
+    /**
+     * Add an edge from source to target
+     */
+    void add(GraphElementId sourceId, GraphElementId targetId, GraphElementId edgeId);
+
+    /**
+     * Remove an edge from source to target -- ignores unknown edges
+     */
+    void remove(GraphElementId sourceId, GraphElementId targetId, GraphElementId edgeId);
+
+    /**
+     * Get the ids of the edges from source to target
+     * \return list of edge ids, or NULL if there is no such edge
+     */
+    const EdgeIdList* find(GraphElementId sourceId, GraphElementId targetId) const;
+
+    /**
+     * Get the number of edges from source to target
+     */
+    size_t count(GraphElementId sourceId, GraphElementId targetId) const;
+
+    /**
+     * Get the number of vertex pairs which are connected by edges
+     */
+    size_t size() const { return mEdges.size(); }
+
+    bool empty() const { return mEdges.empty(); }
+
+    void reserve(size_t numberOfEdges) { mEdges.reserve(numberOfEdges); }
+
+    void clear() { mEdges.clear(); }
+
+private:
+    typedef uint64_t Key;
+
+    static Key key(GraphElementId sourceId, GraphElementId targetId) { return (static_cast<Key>(sourceId) << 32) | targetId; }
+
+    boost::unordered_map<Key, EdgeIdList> mEdges;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_ADJACENCY_INDEX_HPP
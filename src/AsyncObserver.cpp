@@ -0,0 +1,140 @@
+#include "AsyncObserver.hpp"
+#include <base-logging/Logging.hpp>
+
+namespace graph_analysis {
+
+AsyncObserver::AsyncObserver(const BaseGraphObserver::Ptr& observer, size_t capacity)
+    : mObserver(observer)
+    , mQueue(capacity)
+    , mQueued(0)
+    , mDelivered(0)
+    , mStop(false)
+    , mWaiting(false)
+{
+    if(!mObserver)
+    {
+        throw std::invalid_argument("graph_analysis::AsyncObserver: no observer given");
+    }
+    mThread = std::thread(&AsyncObserver::run, this);
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_one();
+    mThread.join();
+}
+
+void AsyncObserver::notify(const Vertex::Ptr& vertex, const EventType& event, const GraphId& origin)
+{
+    Notification notification;
+    notification.type = Notification::ELEMENT;
+    notification.event = ObserverEvent(vertex, origin, event);
+    push(notification);
+}
+
+void AsyncObserver::notify(const Edge::Ptr& edge, const EventType& event, const GraphId& origin)
+{
+    Notification notification;
+    notification.type = Notification::ELEMENT;
+    notification.event = ObserverEvent(edge, origin, event);
+    push(notification);
+}
+
+void AsyncObserver::notify(const TransactionType& event, const GraphId& origin)
+{
+    Notification notification;
+    notification.type = Notification::TRANSACTION;
+    notification.transaction = event;
+    notification.event.origin = origin;
+    push(notification);
+}
+
+void AsyncObserver::notifyBatch(const std::vector<ObserverEvent>& events)
+{
+    Notification notification;
+    notification.type = Notification::BATCH;
+    notification.batch = shared_ptr< const std::vector<ObserverEvent> >(new std::vector<ObserverEvent>(events));
+    push(notification);
+}
+
+void AsyncObserver::flush()
+{
+    while(mDelivered.load() != mQueued)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void AsyncObserver::push(const Notification& notification)
+{
+    // Bounded queue: wait for the worker if the queue is full
+    while(!mQueue.push(notification))
+    {
+        std::this_thread::yield();
+    }
+    ++mQueued;
+
+    // Pairs with the fence in run(), so that either the worker sees the
+    // notification or this thread sees that the worker is waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(mWaiting.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCondition.notify_one();
+    }
+}
+
+void AsyncObserver::deliver(const Notification& notification)
+{
+    try {
+        switch(notification.type)
+        {
+            case Notification::ELEMENT:
+                mObserver->notifyBatch(std::vector<ObserverEvent>(1, notification.event));
+                break;
+            case Notification::TRANSACTION:
+                mObserver->notify(notification.transaction, notification.event.origin);
+                break;
+            case Notification::BATCH:
+                mObserver->notifyBatch(*notification.batch);
+                break;
+        }
+    } catch(const std::exception& e)
+    {
+        LOG_WARN_S << "graph_analysis::AsyncObserver: observer failed to process event: " << e.what();
+    }
+}
+
+void AsyncObserver::run()
+{
+    Notification notification;
+    while(true)
+    {
+        while(mQueue.pop(notification))
+        {
+            deliver(notification);
+            // Release references before reporting the delivery
+            notification = Notification();
+            ++mDelivered;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWaiting = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(mQueue.read_available() == 0)
+        {
+            if(mStop)
+            {
+                break;
+            }
+            mCondition.wait(lock);
+        }
+        mWaiting = false;
+    }
+}
+
+} // end namespace graph_analysis
@@ -0,0 +1,102 @@
+#ifndef GRAPH_ANALYSIS_ASYNC_OBSERVER_HPP
+#define GRAPH_ANALYSIS_ASYNC_OBSERVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <boost/lockfree/spsc_queue.hpp>
+#include "BaseGraphObserver.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \class AsyncObserver
+ * \brief Observer which forwards all events to another observer on a
+ * dedicated thread
+ * \details Events are passed through a bounded lock-free queue, so that a
+ * heavy observer does not slow down the modification of the graph. Events of
+ * a transaction are received as a single batch (see
+ * BaseGraphObserver::acceptsBatches) and are forwarded via notifyBatch.
+ * If the queue is full, the notifying thread waits until the worker thread
+ * has caught up.
+ *
+ * The forwarded observer is called from the worker thread only, i.e. it
+ * has to synchronize access to data which is shared with other threads. Since
+ * the graph may have been modified further when an event is delivered, the
+ * observer should not query the graph for the state of an element.
+ *
+ * \verbatim
+    BaseGraphObserver::Ptr observer(new MyHeavyObserver());
+    AsyncObserver::Ptr asyncObserver(new AsyncObserver(observer));
+    graph->addObserver(asyncObserver);
+
+    graph->addEdges(edges);
+    // wait for all events to be processed
+    asyncObserver->flush();
+ \endverbatim
+ */
+class AsyncObserver : public BaseGraphObserver
+{
+public:
+    typedef shared_ptr<AsyncObserver> Ptr;
+
+    /**
+     * Start the worker thread
+     * \param observer Observer to which events are forwarded
+     * \param capacity Maximum number of queued notifications
+     */
+    AsyncObserver(const BaseGraphObserver::Ptr& observer, size_t capacity = 1024);
+
+    /**
+     * Deliver all pending notifications and stop the worker thread
+     */
+    virtual ~AsyncObserver();
+
+    virtual bool acceptsBatches() const { return true; }
+
+    virtual void notify(const Vertex::Ptr& vertex, const EventType& event, const GraphId& origin);
+    virtual void notify(const Edge::Ptr& edge, const EventType& event, const GraphId& origin);
+    virtual void notify(const TransactionType& event, const GraphId& origin);
+    virtual void notifyBatch(const std::vector<ObserverEvent>& events);
+
+    /**
+     * Wait until all notifications which have been queued so far have been
+     * delivered
+     */
+    void flush();
+
+    const BaseGraphObserver::Ptr& getObserver() const { return mObserver; }
+
+private:
+    struct Notification
+    {
+        enum Type { ELEMENT = 0, TRANSACTION, BATCH };
+
+        Type type;
+        ObserverEvent event;
+        TransactionType transaction;
+        shared_ptr< const std::vector<ObserverEvent> > batch;
+    };
+
+    void push(const Notification& notification);
+    void deliver(const Notification& notification);
+    void run();
+
+    BaseGraphObserver::Ptr mObserver;
+    boost::lockfree::spsc_queue<Notification> mQueue;
+
+    /// Number of queued notifications, only accessed by the notifying thread
+    size_t mQueued;
+    /// Number of delivered notifications
+    std::atomic<size_t> mDelivered;
+
+    std::atomic<bool> mStop;
+    std::atomic<bool> mWaiting;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::thread mThread;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_ASYNC_OBSERVER_HPP
@@ -0,0 +1,194 @@
+#include "AttributeColumn.hpp"
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include "MapInitializer.hpp"
+
+namespace graph_analysis {
+
+namespace attribute {
+
+std::map<ColumnType, std::string> ColumnTypeTxt = InitMap<ColumnType, std::string>
+    (INT, "int")
+    (DOUBLE, "double")
+    (STRING, "string")
+    (BLOB, "blob")
+    ;
+
+namespace {
+
+/**
+ * Parse a number from the given text, using the C locale
+ */
+template<typename T>
+void parseNumber(const std::string& text, T& value)
+{
+    std::istringstream ss(text);
+    ss.imbue(std::locale::classic());
+    ss >> value;
+    if(ss.fail() || !(ss >> std::ws).eof())
+    {
+        throw std::invalid_argument("graph_analysis::attribute::fromText: '" + text + "' is not a valid number");
+    }
+}
+
+} // end anonymous namespace
+
+ColumnType getColumnType(const std::string& name)
+{
+    std::map<ColumnType, std::string>::const_iterator cit = ColumnTypeTxt.begin();
+    for(; cit != ColumnTypeTxt.end(); ++cit)
+    {
+        if(cit->second == name)
+        {
+            return cit->first;
+        }
+    }
+    throw std::invalid_argument("graph_analysis::attribute::getColumnType: unknown column type '" + name + "'");
+}
+
+std::string toText(int64_t value)
+{
+    std::ostringstream ss;
+    ss.imbue(std::locale::classic());
+    ss << value;
+    return ss.str();
+}
+
+std::string toText(double value)
+{
+    std::ostringstream ss;
+    ss.imbue(std::locale::classic());
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    return ss.str();
+}
+
+std::string toText(const std::string& value)
+{
+    return value;
+}
+
+std::string toText(const Blob& value)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string text;
+    text.reserve(2*value.size());
+    for(size_t i = 0; i < value.size(); ++i)
+    {
+        text += digits[value[i] >> 4];
+        text += digits[value[i] & 0x0f];
+    }
+    return text;
+}
+
+void fromText(const std::string& text, int64_t& value)
+{
+    parseNumber(text, value);
+}
+
+void fromText(const std::string& text, double& value)
+{
+    parseNumber(text, value);
+}
+
+void fromText(const std::string& text, std::string& value)
+{
+    value = text;
+}
+
+void fromText(const std::string& text, Blob& value)
+{
+    if(text.size() % 2 != 0)
+    {
+        throw std::invalid_argument("graph_analysis::attribute::fromText: '" + text + "' is not a valid hex string");
+    }
+
+    value.resize(text.size()/2);
+    for(size_t i = 0; i < text.size(); ++i)
+    {
+        char c = text[i];
+        uint8_t digit = 0;
+        if(c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        } else if(c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        } else if(c >= 'A' && c <= 'F')
+        {
+            digit = c - 'A' + 10;
+        } else {
+            throw std::invalid_argument("graph_analysis::attribute::fromText: '" + text + "' is not a valid hex string");
+        }
+        value[i/2] = i % 2 == 0 ? digit << 4 : value[i/2] | digit;
+    }
+}
+
+} // end namespace attribute
+
+void AttributeColumns::add(const std::map<std::string, attribute::ColumnType>& columns)
+{
+    std::map<std::string, attribute::ColumnType>::const_iterator cit = columns.begin();
+    for(; cit != columns.end(); ++cit)
+    {
+        switch(cit->second)
+        {
+            case attribute::INT:
+                get<int64_t>(cit->first);
+                break;
+            case attribute::DOUBLE:
+                get<double>(cit->first);
+                break;
+            case attribute::STRING:
+                get<std::string>(cit->first);
+                break;
+            case attribute::BLOB:
+                get<attribute::Blob>(cit->first);
+                break;
+            default:
+                throw std::invalid_argument("graph_analysis::AttributeColumns::add: column '" + cit->first + "' has an invalid type");
+        }
+    }
+}
+
+AttributeColumnBase::Ptr AttributeColumns::getColumn(const std::string& name) const
+{
+    ColumnMap::const_iterator cit = mColumns.find(name);
+    if(cit == mColumns.end())
+    {
+        throw std::invalid_argument("graph_analysis::AttributeColumns::getColumn: column '" + name + "' does not exist");
+    }
+    return cit->second;
+}
+
+void AttributeColumns::reset(GraphElementId id)
+{
+    ColumnMap::const_iterator cit = mColumns.begin();
+    for(; cit != mColumns.end(); ++cit)
+    {
+        cit->second->reset(id);
+    }
+}
+
+void AttributeColumns::clearValues()
+{
+    ColumnMap::const_iterator cit = mColumns.begin();
+    for(; cit != mColumns.end(); ++cit)
+    {
+        cit->second->clear();
+    }
+}
+
+AttributeColumns AttributeColumns::createEmpty() const
+{
+    AttributeColumns columns;
+    ColumnMap::const_iterator cit = mColumns.begin();
+    for(; cit != mColumns.end(); ++cit)
+    {
+        columns.add(cit->second->createEmpty());
+    }
+    return columns;
+}
+
+} // end namespace graph_analysis
@@ -0,0 +1,339 @@
+#ifndef GRAPH_ANALYSIS_ATTRIBUTE_COLUMN_HPP
+#define GRAPH_ANALYSIS_ATTRIBUTE_COLUMN_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "GraphElement.hpp"
+
+namespace graph_analysis {
+
+namespace attribute {
+
+/// Value type of an attribute column
+enum ColumnType { INT = 0, DOUBLE, STRING, BLOB, COLUMN_TYPE_END };
+
+extern std::map<ColumnType, std::string> ColumnTypeTxt;
+
+/// Arbitrary binary data
+typedef std::vector<uint8_t> Blob;
+
+/**
+ * Map the C++ type of the values to the ColumnType
+ */
+template<typename T>
+struct ColumnTraits;
+
+template<>
+struct ColumnTraits<int64_t> { static const ColumnType type = INT; };
+
+template<>
+struct ColumnTraits<double> { static const ColumnType type = DOUBLE; };
+
+template<>
+struct ColumnTraits<std::string> { static const ColumnType type = STRING; };
+
+template<>
+struct ColumnTraits<Blob> { static const ColumnType type = BLOB; };
+
+/**
+ * Get the type of a column from its name as given by ColumnTypeTxt
+ * \throw std::invalid_argument if the name is unknown
+ */
+ColumnType getColumnType(const std::string& name);
+
+/**
+ * Convert a value to text, e.g. for text based formats -- numbers are
+ * written independent of the global locale and blobs as hex string
+ */
+std::string toText(int64_t value);
+std::string toText(double value);
+std::string toText(const std::string& value);
+std::string toText(const Blob& value);
+
+/**
+ * Convert text as given by toText to a value
+ * \throw std::invalid_argument if the text is not a valid value
+ */
+void fromText(const std::string& text, int64_t& value);
+void fromText(const std::string& text, double& value);
+void fromText(const std::string& text, std::string& value);
+void fromText(const std::string& text, Blob& value);
+
+} // end namespace attribute
+
+/**
+ * \class AttributeColumnBase
+ * \brief Type independent interface of an AttributeColumn
+ */
+class AttributeColumnBase
+{
+public:
+    typedef shared_ptr<AttributeColumnBase> Ptr;
+
+    AttributeColumnBase(const std::string& name, attribute::ColumnType type)
+        : mName(name)
+        , mType(type)
+    {}
+
+    virtual ~AttributeColumnBase() {}
+
+    const std::string& getName() const { return mName; }
+    attribute::ColumnType getType() const { return mType; }
+
+    /**
+     * Get the number of allocated slots, i.e. the largest element id with an
+     * assigned value + 1
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * Reset the value of the element with the given id to the default value
+     */
+    virtual void reset(GraphElementId id) = 0;
+
+    /**
+     * Remove all values
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Create an empty column with the same name, type and default value
+     */
+    virtual AttributeColumnBase::Ptr createEmpty() const = 0;
+
+    /**
+     * Get the value of the element with the given id as text
+     * \see attribute::toText
+     */
+    virtual std::string getText(GraphElementId id) const = 0;
+
+    /**
+     * Set the value of the element with the given id from text
+     * \throw std::invalid_argument if the text is not a valid value
+     * \see attribute::fromText
+     */
+    virtual void setText(GraphElementId id, const std::string& text) = 0;
+
+    /**
+     * Copy the value of an element to (another) column of the same type
+     */
+    virtual void copyValue(GraphElementId from, AttributeColumnBase& target, GraphElementId to) const = 0;
+
+private:
+    std::string mName;
+    attribute::ColumnType mType;
+};
+
+/**
+ * \class AttributeColumn
+ * \brief Typed attribute values of all vertices or all edges of a graph,
+ * stored in a contiguous array which is indexed by the element id
+ * \details Elements without an assigned value have the default value of the
+ * column. Values can be accessed without virtual calls, and algorithms can
+ * operate on the whole array via values()
+ */
+template<typename T>
+class AttributeColumn : public AttributeColumnBase
+{
+public:
+    typedef shared_ptr< AttributeColumn<T> > Ptr;
+    typedef T value_type;
+
+    AttributeColumn(const std::string& name, const T& defaultValue = T())
+        : AttributeColumnBase(name, attribute::ColumnTraits<T>::type)
+        , mDefault(defaultValue)
+    {}
+
+    /**
+     * Get the value of the element with the given id
+     */
+    const T& get(GraphElementId id) const
+    {
+        return id < mValues.size() ? mValues[id] : mDefault;
+    }
+
+    /**
+     * Set the value of the element with the given id
+     */
+    void set(GraphElementId id, const T& value)
+    {
+        (*this)[id] = value;
+    }
+
+    /**
+     * Access the value of the element with the given id, allocating a slot
+     * if necessary
+     */
+    T& operator[](GraphElementId id)
+    {
+        if(id >= mValues.size())
+        {
+            mValues.resize(id + 1, mDefault);
+        }
+        return mValues[id];
+    }
+
+    const T& getDefault() const { return mDefault; }
+
+    /**
+     * Allocate slots for the given number of element ids
+     */
+    void reserve(size_t size)
+    {
+        if(size > mValues.size())
+        {
+            mValues.resize(size, mDefault);
+        }
+    }
+
+    /**
+     * Direct access to all values, indexed by element id
+     */
+    const std::vector<T>& values() const { return mValues; }
+    std::vector<T>& values() { return mValues; }
+
+    size_t size() const { return mValues.size(); }
+
+    void reset(GraphElementId id)
+    {
+        if(id < mValues.size())
+        {
+            mValues[id] = mDefault;
+        }
+    }
+
+    void clear() { mValues.clear(); }
+
+    AttributeColumnBase::Ptr createEmpty() const
+    {
+        return AttributeColumnBase::Ptr(new AttributeColumn<T>(getName(), mDefault));
+    }
+
+    std::string getText(GraphElementId id) const
+    {
+        return attribute::toText(get(id));
+    }
+
+    void setText(GraphElementId id, const std::string& text)
+    {
+        T value;
+        attribute::fromText(text, value);
+        set(id, value);
+    }
+
+    void copyValue(GraphElementId from, AttributeColumnBase& target, GraphElementId to) const
+    {
+        if(from < mValues.size())
+        {
+            static_cast< AttributeColumn<T>& >(target).set(to, mValues[from]);
+        }
+    }
+
+private:
+    std::vector<T> mValues;
+    T mDefault;
+};
+
+/**
+ * \class AttributeColumns
+ * \brief Set of named attribute columns, e.g. all vertex attribute columns
+ * of a graph
+ */
+class AttributeColumns
+{
+public:
+    typedef std::map<std::string, AttributeColumnBase::Ptr> ColumnMap;
+
+    /**
+     * Get the column with the given name, the column is created if it does
+     * not exist yet
+     * \throw std::invalid_argument if the column exists with a different type
+     */
+    template<typename T>
+    AttributeColumn<T>& get(const std::string& name)
+    {
+        ColumnMap::const_iterator cit = mColumns.find(name);
+        if(cit == mColumns.end())
+        {
+            AttributeColumn<T>* column = new AttributeColumn<T>(name);
+            mColumns[name] = AttributeColumnBase::Ptr(column);
+            return *column;
+        }
+        return cast<T>(*cit->second);
+    }
+
+    /**
+     * Get an existing column with the given name
+     * \throw std::invalid_argument if the column does not exist or has a different type
+     */
+    template<typename T>
+    const AttributeColumn<T>& get(const std::string& name) const
+    {
+        return cast<T>(*getColumn(name));
+    }
+
+    /**
+     * Add a column, replacing an existing column of the same name
+     */
+    void add(const AttributeColumnBase::Ptr& column) { mColumns[column->getName()] = column; }
+
+    /**
+     * Create the columns with the given names and types if they do not exist
+     * \throw std::invalid_argument if a column exists with a different type
+     */
+    void add(const std::map<std::string, attribute::ColumnType>& columns);
+
+    /**
+     * Test whether a column with the given name exists
+     */
+    bool has(const std::string& name) const { return mColumns.count(name); }
+
+    /**
+     * Get the column with the given name
+     * \throw std::invalid_argument if the column does not exist
+     */
+    AttributeColumnBase::Ptr getColumn(const std::string& name) const;
+
+    /**
+     * Get all columns
+     */
+    const ColumnMap& getColumns() const { return mColumns; }
+
+    bool empty() const { return mColumns.empty(); }
+
+    /**
+     * Reset the values of the element with the given id in all columns
+     */
+    void reset(GraphElementId id);
+
+    /**
+     * Remove the values of all columns, but keep the columns
+     */
+    void clearValues();
+
+    /**
+     * Create empty columns with the same names and types
+     */
+    AttributeColumns createEmpty() const;
+
+private:
+    template<typename T>
+    static AttributeColumn<T>& cast(AttributeColumnBase& column)
+    {
+        attribute::ColumnType requestedType = attribute::ColumnTraits<T>::type;
+        if(column.getType() != requestedType)
+        {
+            throw std::invalid_argument("graph_analysis::AttributeColumns: column '" + column.getName() + "' has type '"
+                    + attribute::ColumnTypeTxt[column.getType()] + "', but has been requested as '"
+                    + attribute::ColumnTypeTxt[requestedType] + "'");
+        }
+        return static_cast< AttributeColumn<T>& >(column);
+    }
+
+    ColumnMap mColumns;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_ATTRIBUTE_COLUMN_HPP
@@ -6,13 +6,23 @@ void AttributeManager::registerAttribute(const std::string& typeName, const std:
         io::AttributeSerializationCallbacks::serialize_func_t sF,
         io::AttributeSerializationCallbacks::deserialize_func_t dsF,
         io::AttributeSerializationCallbacks::print_func_t pF)
+{
+    io::AttributeSerializationCallbacks mc = {sF,dsF,pF,NULL,NULL,false};
+    registerAttribute(typeName, attributeName, mc);
+}
+
+void AttributeManager::registerAttribute(const std::string& typeName, const std::string& attributeName,
+        const io::AttributeSerializationCallbacks& callbacks)
 {
     if(mRegisteredCallbacks.find(typeName) == mRegisteredCallbacks.end())
     {
         throw std::invalid_argument("graph_analysis::AttributeManager::registerAttribute: cannot register attribute for unknown type: " + typeName);
     }
-    io::AttributeSerializationCallbacks mc = {sF,dsF,pF};
-    mRegisteredCallbacks[typeName][attributeName] = mc;
+    if(!callbacks.binarySerializeFunction != !callbacks.binaryDeserializeFunction)
+    {
+        throw std::invalid_argument("graph_analysis::AttributeManager::registerAttribute: binary serialization of attribute '" + attributeName + "' requires both functions");
+    }
+    mRegisteredCallbacks[typeName][attributeName] = callbacks;
 }
 
 std::vector<std::string> AttributeManager::getAttributes(const std::string& vertexTypeName) const
@@ -47,4 +57,24 @@ io::AttributeSerializationCallbacks AttributeManager::getAttributeSerializationC
     return mRegisteredCallbacks[typeName][memberName];
 }
 
+void AttributeManager::registerColumn(const std::string& typeName, const std::string& columnName, attribute::ColumnType type)
+{
+    if(mRegisteredCallbacks.find(typeName) == mRegisteredCallbacks.end())
+    {
+        throw std::invalid_argument("graph_analysis::AttributeManager::registerColumn: cannot register column for unknown type: " + typeName);
+    }
+    mRegisteredColumns[typeName][columnName] = type;
+}
+
+const AttributeManager::ColumnTypeMap& AttributeManager::getColumns(const std::string& typeName) const
+{
+    static const ColumnTypeMap noColumns;
+    std::map<std::string, ColumnTypeMap>::const_iterator cit = mRegisteredColumns.find(typeName);
+    if(cit == mRegisteredColumns.end())
+    {
+        return noColumns;
+    }
+    return cit->second;
+}
+
 } // end namespace graph_analysis
@@ -2,6 +2,7 @@
 #define GRAPH_ANALYSIS_ATTRIBUTE_MANAGER_HPP
 
 #include "io/Serialization.hpp"
+#include "AttributeColumn.hpp"
 
 namespace graph_analysis {
 
@@ -13,6 +14,7 @@ class AttributeManager
 {
 public:
     typedef std::map<std::string, io::AttributeSerializationCallbacks> AttributeSerializationCallbackMap;
+    typedef std::map<std::string, attribute::ColumnType> ColumnTypeMap;
 
     void activateAttributedType(const std::string& typeName) { (void) mRegisteredCallbacks[typeName]; }
 
@@ -30,6 +32,18 @@ public:
             io::AttributeSerializationCallbacks::deserialize_func_t dF,
             io::AttributeSerializationCallbacks::print_func_t pF);
 
+    /**
+     *  \brief register a new attribute for serialization and deserialization,
+     *  optionally with a binary encoding and lazy deserialization
+     *  \param typeName the class Name (normally equals Vertex::getClassName()
+     *  \param attributeName arbitrary unique name for the attribute that should added
+     *  \param callbacks Serialization callbacks, the binary functions may be
+     *  NULL
+     */
+    void registerAttribute(const std::string& typeName,
+            const std::string& attributeName,
+            const io::AttributeSerializationCallbacks& callbacks);
+
     /**
      *  \brief returns all registered members for the given vertex
      *  \param vertexTypeName the class Name (normally equals Vertex::getClassName()
@@ -44,8 +58,31 @@ public:
      */
     io::AttributeSerializationCallbacks getAttributeSerializationCallbacks(const std::string& typeName, const std::string& attributeName);
 
+    /**
+     * \brief register a typed attribute column for all elements of a type
+     * \details Graphs create the column once the first element of this type
+     * is added, see BaseGraph::getVertexColumns and BaseGraph::getEdgeColumns
+     * \param typeName the class Name (normally equals Vertex::getClassName()
+     * \param columnName name of the column, which is shared by all types
+     * that register a column of this name
+     * \param type value type of the column
+     */
+    void registerColumn(const std::string& typeName, const std::string& columnName, attribute::ColumnType type);
+
+    /**
+     * \brief returns all registered columns for the given type
+     * \param typeName the class Name (normally equals Vertex::getClassName()
+     */
+    const ColumnTypeMap& getColumns(const std::string& typeName) const;
+
+    /**
+     * Test whether any column has been registered
+     */
+    bool hasColumns() const { return !mRegisteredColumns.empty(); }
+
 private:
     std::map<std::string, AttributeSerializationCallbackMap > mRegisteredCallbacks;
+    std::map<std::string, ColumnTypeMap> mRegisteredColumns;
 
 };
 
@@ -1,12 +1,51 @@
 #include "BaseGraph.hpp"
 #include <base-logging/Logging.hpp>
+#include <algorithm>
+#include <limits>
 #include <sstream>
 #include "boost_graph/DirectedGraph.hpp"
 #include "lemon/Graph.hpp"
 #include "snap/DirectedGraph.hpp"
 #include "MapInitializer.hpp"
+#include "VertexTypeManager.hpp"
+#include "EdgeTypeManager.hpp"
+#include "utils/Parallel.hpp"
 
 namespace graph_analysis {
+namespace {
+
+/// Minimum number of elements which are cloned per thread
+const size_t MIN_CLONE_CHUNK_SIZE = 4096;
+
+/**
+ * Create the columns registered for the type of the element and reset the
+ * values of the element
+ */
+void initializeColumns(AttributeColumns& columns, const AttributeManager* manager, const GraphElement& element, GraphElementId id)
+{
+    if(manager->hasColumns())
+    {
+        columns.add(manager->getColumns(element.getClassName()));
+    }
+    if(!columns.empty())
+    {
+        columns.reset(id);
+    }
+}
+
+/**
+ * Copy the values of an element to the columns of the same name
+ */
+void copyColumnValues(const AttributeColumns& source, GraphElementId from, AttributeColumns& target, GraphElementId to)
+{
+    AttributeColumns::ColumnMap::const_iterator cit = source.getColumns().begin();
+    for(; cit != source.getColumns().end(); ++cit)
+    {
+        cit->second->copyValue(from, *target.getColumn(cit->first), to);
+    }
+}
+
+} // end anonymous namespace
 
 GraphId BaseGraph::msId = 0;
 
@@ -20,6 +59,11 @@ BaseGraph::BaseGraph(ImplementationType type, bool directed)
     : mId(msId++)
     , mImplementationType(type)
     , mDirected(directed)
+    , mTransactionLevel(0)
+    , mVersion(0)
+    , mParallelCloneEnabled(false)
+    , mAdjacencyIndexEnabled(false)
+    , mLabelRevision(GraphElement::getLabelRevision())
 {
 }
 
@@ -44,12 +88,18 @@ BaseGraph::Ptr BaseGraph::getInstance(ImplementationType type)
 
 void BaseGraph::addObserver(const BaseGraphObserver::Ptr& observer)
 {
-    mObservers.insert(observer);
+    if(observer->acceptsBatches())
+    {
+        mBatchObservers.insert(observer);
+    } else {
+        mObservers.insert(observer);
+    }
 }
 
 void BaseGraph::removeObserver(const BaseGraphObserver::Ptr& observer)
 {
     mObservers.erase(observer);
+    mBatchObservers.erase(observer);
 }
 
 void BaseGraph::notifyAll(const Vertex::Ptr& vertex, const EventType& event)
@@ -61,6 +111,7 @@ void BaseGraph::notifyAll(const Vertex::Ptr& vertex, const EventType& event)
     {
         (*it)->notify(vertex, event, getId());
     }
+    notifyBatchObservers(ObserverEvent(vertex, getId(), event));
 }
 
 void BaseGraph::notifyAll(const Edge::Ptr& edge, const EventType& event)
@@ -72,17 +123,57 @@ void BaseGraph::notifyAll(const Edge::Ptr& edge, const EventType& event)
     {
         (*it)->notify(edge, event, getId());
     }
+    notifyBatchObservers(ObserverEvent(edge, getId(), event));
 }
 
 void BaseGraph::notifyAll(const TransactionType& event)
 {
     std::set<BaseGraphObserver::Ptr>::const_iterator it;
 
+    if(event == TRANSACTION_START)
+    {
+        ++mTransactionLevel;
+    } else if(mTransactionLevel > 0 && --mTransactionLevel == 0 && !mPendingEvents.empty())
+    {
+        // Deliver the collected events of the outermost transaction
+        std::vector<ObserverEvent> events;
+        mPendingEvents.take(events);
+        for(it = mBatchObservers.begin(); it != mBatchObservers.end(); ++it)
+        {
+            (*it)->notifyBatch(events);
+        }
+    }
+
     // Call every registered observer
     for(it = mObservers.begin(); it != mObservers.end(); ++it)
     {
         (*it)->notify(event, getId());
     }
+    for(it = mBatchObservers.begin(); it != mBatchObservers.end(); ++it)
+    {
+        (*it)->notify(event, getId());
+    }
+}
+
+void BaseGraph::notifyBatchObservers(const ObserverEvent& event)
+{
+    if(mBatchObservers.empty())
+    {
+        return;
+    }
+
+    if(mTransactionLevel > 0)
+    {
+        mPendingEvents.add(event);
+        return;
+    }
+
+    std::vector<ObserverEvent> events(1, event);
+    std::set<BaseGraphObserver::Ptr>::const_iterator it;
+    for(it = mBatchObservers.begin(); it != mBatchObservers.end(); ++it)
+    {
+        (*it)->notifyBatch(events);
+    }
 }
 
 void BaseGraph::transactionEvent( TransactionType eventType )
@@ -90,74 +181,133 @@ void BaseGraph::transactionEvent( TransactionType eventType )
    notifyAll( eventType );
 }
 
+size_t BaseGraph::getCloneChunkSize() const
+{
+    // A single chunk is cloned on the calling thread
+    return mParallelCloneEnabled ? MIN_CLONE_CHUNK_SIZE : std::numeric_limits<size_t>::max();
+}
+
 BaseGraph::Ptr BaseGraph::clone() const
 {
-    std::map<Vertex::Ptr, Vertex::Ptr> current2Clone;
+    std::vector<Vertex::Ptr> vertices = getAllVertices();
+    std::vector<Edge::Ptr> edges = getAllEdges();
 
-    BaseGraph::Ptr g_clone = this->newInstance();
-    VertexIterator::Ptr vertexIterator = getVertexIterator();
-    while(vertexIterator->next())
-    {
-        Vertex::Ptr v = vertexIterator->current();
-        Vertex::Ptr v_clone = v->clone();
+    std::vector<GraphElementId> vertexIds(vertices.size());
+    std::vector<Vertex::Ptr> vertexClones(vertices.size());
+    utils::parallelFor(vertices.size(), getCloneChunkSize(), [&](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                vertexIds[i] = getVertexId(vertices[i]);
+                vertexClones[i] = vertices[i]->clone();
+            }
+        });
 
-        g_clone->addVertex(v_clone);
-        current2Clone[v] = v_clone;
+    // Map the vertices to their clones by the id in this graph
+    std::vector<Vertex::Ptr> current2Clone;
+    if(!vertexIds.empty())
+    {
+        current2Clone.resize(*std::max_element(vertexIds.begin(), vertexIds.end()) + 1);
     }
-
-    EdgeIterator::Ptr edgeIterator = getEdgeIterator();
-    while(edgeIterator->next())
+    for(size_t i = 0; i < vertexIds.size(); ++i)
     {
-        Edge::Ptr e = edgeIterator->current();
-        Edge::Ptr e_clone = e->clone();
-        std::map<Vertex::Ptr, Vertex::Ptr>::const_iterator vit;
+        current2Clone[ vertexIds[i] ] = vertexClones[i];
+    }
 
-        vit = current2Clone.find(e->getSourceVertex());
-        if(vit != current2Clone.end())
+    std::vector<GraphElementId> edgeIds(edges.size());
+    std::vector<Edge::Ptr> edgeClones(edges.size());
+    utils::parallelFor(edges.size(), getCloneChunkSize(), [&](size_t begin, size_t end)
         {
-            e_clone->setSourceVertex(vit->second);
-        } else {
-            throw std::runtime_error("graph_analysis::BaseGraph::clone: could not find mapped source vertex -- internal error");
-        }
+            for(size_t i = begin; i < end; ++i)
+            {
+                const Edge::Ptr& e = edges[i];
+                Edge::Ptr e_clone = e->clone();
+
+                GraphElementId sourceId = getVertexId(e->getSourceVertex());
+                if(sourceId < current2Clone.size() && current2Clone[sourceId])
+                {
+                    e_clone->setSourceVertex(current2Clone[sourceId]);
+                } else {
+                    throw std::runtime_error("graph_analysis::BaseGraph::clone: could not find mapped source vertex -- internal error");
+                }
+
+                GraphElementId targetId = getVertexId(e->getTargetVertex());
+                if(targetId < current2Clone.size() && current2Clone[targetId])
+                {
+                    e_clone->setTargetVertex(current2Clone[targetId]);
+                } else {
+                    throw std::runtime_error("graph_analysis::BaseGraph::clone: could not find mapped target vertex -- internal error");
+                }
+                edgeIds[i] = getEdgeId(e);
+                edgeClones[i] = e_clone;
+            }
+        });
 
-        vit = current2Clone.find(e->getTargetVertex());
-        if(vit != current2Clone.end())
-        {
-            e_clone->setTargetVertex(vit->second);
-        } else {
-            throw std::runtime_error("graph_analysis::BaseGraph::clone: could not find mapped target vertex -- internal error");
-        }
-        g_clone->addEdge(e_clone);
-    }
+    BaseGraph::Ptr g_clone = this->newInstance();
+    g_clone->mVertexColumns = mVertexColumns.createEmpty();
+    g_clone->mEdgeColumns = mEdgeColumns.createEmpty();
+    g_clone->addVertices(vertexClones);
+    g_clone->addEdges(edgeClones);
+    g_clone->copyColumns(*this, vertexIds, vertexClones, edgeIds, edgeClones);
 
     return g_clone;
 }
 
 BaseGraph::Ptr BaseGraph::cloneEdges() const
 {
-    std::map<Vertex::Ptr, Vertex::Ptr> current2Clone;
+    std::vector<Vertex::Ptr> vertices = getAllVertices();
+    std::vector<Edge::Ptr> edges = getAllEdges();
 
-    BaseGraph::Ptr g_clone = this->newInstance();
-    VertexIterator::Ptr vertexIterator = getVertexIterator();
-    while(vertexIterator->next())
+    std::vector<GraphElementId> vertexIds(vertices.size());
+    std::vector<GraphElementId> edgeIds(edges.size());
+    std::vector<Edge::Ptr> edgeClones(edges.size());
+    utils::parallelFor(edges.size(), getCloneChunkSize(), [&](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                const Edge::Ptr& e = edges[i];
+                Edge::Ptr e_clone = e->clone();
+                e_clone->setSourceVertex(e->getSourceVertex());
+                e_clone->setTargetVertex(e->getTargetVertex());
+                edgeIds[i] = getEdgeId(e);
+                edgeClones[i] = e_clone;
+            }
+        });
+    for(size_t i = 0; i < vertices.size(); ++i)
     {
-        Vertex::Ptr v = vertexIterator->current();
-        g_clone->addVertex(v);
+        vertexIds[i] = getVertexId(vertices[i]);
     }
 
-    EdgeIterator::Ptr edgeIterator = getEdgeIterator();
-    while(edgeIterator->next())
-    {
-        Edge::Ptr e = edgeIterator->current();
-        Edge::Ptr e_clone = e->clone();
-        e_clone->setSourceVertex(e->getSourceVertex());
-        e_clone->setTargetVertex(e->getTargetVertex());
-        g_clone->addEdge(e_clone);
-    }
+    BaseGraph::Ptr g_clone = this->newInstance();
+    g_clone->mVertexColumns = mVertexColumns.createEmpty();
+    g_clone->mEdgeColumns = mEdgeColumns.createEmpty();
+    g_clone->addVertices(vertices);
+    g_clone->addEdges(edgeClones);
+    g_clone->copyColumns(*this, vertexIds, vertices, edgeIds, edgeClones);
 
     return g_clone;
 }
 
+void BaseGraph::copyColumns(const BaseGraph& other,
+        const std::vector<GraphElementId>& otherVertexIds, const std::vector<Vertex::Ptr>& vertices,
+        const std::vector<GraphElementId>& otherEdgeIds, const std::vector<Edge::Ptr>& edges)
+{
+    if(!other.mVertexColumns.empty())
+    {
+        for(size_t i = 0; i < vertices.size(); ++i)
+        {
+            copyColumnValues(other.mVertexColumns, otherVertexIds[i], mVertexColumns, getVertexId(vertices[i]));
+        }
+    }
+    if(!other.mEdgeColumns.empty())
+    {
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            copyColumnValues(other.mEdgeColumns, otherEdgeIds[i], mEdgeColumns, getEdgeId(edges[i]));
+        }
+    }
+}
+
 SubGraph::Ptr BaseGraph::getSubGraph(const Ptr& graph)
 {
     return graph->createSubGraph(graph);
@@ -171,6 +321,10 @@ GraphElementId BaseGraph::addVertex(const Vertex::Ptr& vertex)
     }
 
     GraphElementId vertexId = addVertexInternal(vertex);
+    ++mVersion;
+    mVertexBuckets.add(vertexId, vertex);
+    mVertexLabels.add(vertexId, vertex->getLabelSymbol());
+    initializeColumns(mVertexColumns, VertexTypeManager::getInstance(), *vertex, vertexId);
 
     // Call observers
     notifyAll(vertex, EVENT_TYPE_ADDED);
@@ -184,8 +338,26 @@ void BaseGraph::removeVertex(const Vertex::Ptr& vertex)
     {
         throw std::runtime_error("BaseGraph: vertex cannot be removed, since it does not exist in this graph");
     }
+    // Edges of the vertex are removed (and observers are notified) before
+    // the vertex itself
+    VertexHandle vertexHandle = getVertexHandle(vertex);
+    std::vector<Edge::Ptr> edges;
+    forEachOutEdge(vertexHandle, [this, &edges](EdgeHandle edge) { edges.push_back(mEdgeBuckets.getElement(edge.id)); });
+    forEachInEdge(vertexHandle, [this, &edges](EdgeHandle edge) { edges.push_back(mEdgeBuckets.getElement(edge.id)); });
+    for(size_t i = 0; i < edges.size(); ++i)
+    {
+        // a loop is reported as out and in edge
+        if(edges[i]->associated(getId()))
+        {
+            removeEdge(edges[i]);
+        }
+    }
+    mVertexBuckets.remove(vertexHandle.id);
+    mVertexLabels.remove(vertexHandle.id);
+
     removeVertexInternal(vertex);
     vertex->disassociate(getId());
+    ++mVersion;
 
     // Call observers
     notifyAll(vertex, EVENT_TYPE_REMOVED);
@@ -216,24 +388,27 @@ GraphElementId BaseGraph::addEdge(const Edge::Ptr& edge)
     }
     else
     {
-        try {
-            addVertex(source);
-        } catch(const std::runtime_error& e)
+        if(!source->associated(getId()))
         {
-            // vertex already part of the graph
+            addVertex(source);
         }
 
-        try {
-            addVertex(target);
-        } catch(const std::runtime_error& e)
+        if(!target->associated(getId()))
         {
-            // vertex already part of the graph
+            addVertex(target);
         }
     }
 
     try {
         GraphElementId retVal =
             addEdgeInternal(edge, getVertexId(source), getVertexId(target));
+        ++mVersion;
+        mEdgeBuckets.add(retVal, edge);
+        if(mAdjacencyIndexEnabled)
+        {
+            mAdjacencyIndex.add(getVertexId(source), getVertexId(target), retVal);
+        }
+        initializeColumns(mEdgeColumns, EdgeTypeManager::getInstance(), *edge, retVal);
 
         // Call observers
         notifyAll(edge, EVENT_TYPE_ADDED);
@@ -246,14 +421,54 @@ GraphElementId BaseGraph::addEdge(const Edge::Ptr& edge)
     }
 }
 
+void BaseGraph::addVertices(const std::vector<Vertex::Ptr>& vertices)
+{
+    reserve(vertices.size(), 0);
+
+    transactionEvent(TRANSACTION_START);
+    try {
+        std::vector<Vertex::Ptr>::const_iterator cit = vertices.begin();
+        for(; cit != vertices.end(); ++cit)
+        {
+            addVertex(*cit);
+        }
+    } catch(...)
+    {
+        transactionEvent(TRANSACTION_STOP);
+        throw;
+    }
+    transactionEvent(TRANSACTION_STOP);
+}
+
+void BaseGraph::addEdges(const std::vector<Edge::Ptr>& edges)
+{
+    reserve(0, edges.size());
+
+    transactionEvent(TRANSACTION_START);
+    try {
+        std::vector<Edge::Ptr>::const_iterator cit = edges.begin();
+        for(; cit != edges.end(); ++cit)
+        {
+            addEdge(*cit);
+        }
+    } catch(...)
+    {
+        transactionEvent(TRANSACTION_STOP);
+        throw;
+    }
+    transactionEvent(TRANSACTION_STOP);
+}
+
 void BaseGraph::removeEdge(const Edge::Ptr& edge)
 {
     if(!edge->associated(getId()) )
     {
         throw std::runtime_error("BaseGraph: edge cannot be removed, since it does not exist in this graph");
     }
+    removeFromIndices(getEdgeHandle(edge));
     removeEdgeInternal(edge);
     edge->disassociate(getId());
+    ++mVersion;
 
     // Call observers
     notifyAll(edge, EVENT_TYPE_REMOVED);
@@ -262,6 +477,26 @@ void BaseGraph::removeEdge(const Edge::Ptr& edge)
 std::vector<Edge::Ptr> BaseGraph::getEdges(const Vertex::Ptr& source, const Vertex::Ptr& target) const
 {
     std::vector<Edge::Ptr> edges;
+    if(mAdjacencyIndexEnabled)
+    {
+        GraphElementId sourceId = getVertexId(source);
+        GraphElementId targetId = getVertexId(target);
+        const AdjacencyIndex::EdgeIdList* edgeIds = mAdjacencyIndex.find(sourceId, targetId);
+        for(size_t i = 0; edgeIds && i < edgeIds->size(); ++i)
+        {
+            edges.push_back(mEdgeBuckets.getElement((*edgeIds)[i]));
+        }
+        if(!isDirected() && sourceId != targetId)
+        {
+            edgeIds = mAdjacencyIndex.find(targetId, sourceId);
+            for(size_t i = 0; edgeIds && i < edgeIds->size(); ++i)
+            {
+                edges.push_back(mEdgeBuckets.getElement((*edgeIds)[i]));
+            }
+        }
+        return edges;
+    }
+
     EdgeIterator::Ptr edgeIt;
     if(isDirected())
     {
@@ -288,30 +523,67 @@ std::vector<Edge::Ptr> BaseGraph::getEdges(const Vertex::Ptr& source, const Vert
     return edges;
 }
 
-size_t BaseGraph::removeEdges(const Vertex::Ptr& a, const Vertex::Ptr& b)
+bool BaseGraph::hasEdge(const Vertex::Ptr& source, const Vertex::Ptr& target) const
 {
-    size_t numberOfEdges = 0;
+    if(mAdjacencyIndexEnabled)
+    {
+        GraphElementId sourceId = getVertexId(source);
+        GraphElementId targetId = getVertexId(target);
+        return mAdjacencyIndex.count(sourceId, targetId) != 0
+            || (!isDirected() && mAdjacencyIndex.count(targetId, sourceId) != 0);
+    }
 
-    std::vector<Edge::Ptr> edgesAB = getEdges(a, b);
-    std::vector<Edge::Ptr> edgesBA = getEdges(b, a);
+    bool found = false;
+    VertexHandle sourceHandle = getVertexHandle(source);
+    VertexHandle targetHandle = getVertexHandle(target);
+    forEachOutEdge(sourceHandle, [this, &found, targetHandle](EdgeHandle edge)
+        {
+            found = found || this->target(edge) == targetHandle;
+        });
+    if(!found && !isDirected())
+    {
+        forEachOutEdge(targetHandle, [this, &found, sourceHandle](EdgeHandle edge)
+            {
+                found = found || this->target(edge) == sourceHandle;
+            });
+    }
+    return found;
+}
 
+void BaseGraph::setAdjacencyIndexEnabled(bool enabled)
+{
+    mAdjacencyIndex.clear();
+    mAdjacencyIndexEnabled = enabled;
+    if(enabled)
     {
-        std::vector<Edge::Ptr>::const_iterator cit = edgesAB.begin();
-        for(; cit != edgesAB.end(); ++cit)
+        std::vector<Edge::Ptr> edges = getAllEdges();
+        mAdjacencyIndex.reserve(edges.size());
+        for(size_t i = 0; i < edges.size(); ++i)
         {
-            removeEdge(*cit);
-            ++numberOfEdges;
+            mAdjacencyIndex.add(getVertexId(edges[i]->getSourceVertex()),
+                    getVertexId(edges[i]->getTargetVertex()),
+                    getEdgeId(edges[i]));
         }
     }
+}
+
+size_t BaseGraph::removeEdges(const Vertex::Ptr& a, const Vertex::Ptr& b)
+{
+    std::vector<Edge::Ptr> edges = getEdges(a, b);
+    // For undirected graphs and loops the edges of both directions have
+    // already been collected
+    if(isDirected() && a != b)
+    {
+        std::vector<Edge::Ptr> edgesBA = getEdges(b, a);
+        edges.insert(edges.end(), edgesBA.begin(), edgesBA.end());
+    }
+
+    std::vector<Edge::Ptr>::const_iterator cit = edges.begin();
+    for(; cit != edges.end(); ++cit)
     {
-        std::vector<Edge::Ptr>::const_iterator cit = edgesBA.begin();
-        for(; cit != edgesBA.end(); ++cit)
-        {
-            removeEdge(*cit);
-            ++numberOfEdges;
-        }
+        removeEdge(*cit);
     }
-    return numberOfEdges;
+    return edges.size();
 }
 
 std::vector<Vertex::Ptr> BaseGraph::getAllVertices() const
@@ -395,6 +667,13 @@ void BaseGraph::clear()
             break;
         }
     }
+
+    mVertexColumns.clearValues();
+    mEdgeColumns.clearValues();
+    mVertexBuckets.clear();
+    mEdgeBuckets.clear();
+    mAdjacencyIndex.clear();
+    mVertexLabels.clear();
 }
 
 bool BaseGraph::empty() const
@@ -425,6 +704,109 @@ std::vector<Edge::Ptr> BaseGraph::getOutEdges(const Vertex::Ptr& vertex) const
     return edges;
 }
 
+void BaseGraph::rebuildIndices()
+{
+    mVertexBuckets.clear();
+    mEdgeBuckets.clear();
+
+    std::vector<Vertex::Ptr> vertices = getAllVertices();
+    for(size_t i = 0; i < vertices.size(); ++i)
+    {
+        mVertexBuckets.add(getVertexId(vertices[i]), vertices[i]);
+    }
+
+    std::vector<Edge::Ptr> edges = getAllEdges();
+    for(size_t i = 0; i < edges.size(); ++i)
+    {
+        mEdgeBuckets.add(getEdgeId(edges[i]), edges[i]);
+    }
+
+    setAdjacencyIndexEnabled(mAdjacencyIndexEnabled);
+    rebuildLabelIndex();
+}
+
+void BaseGraph::copyIndices(const BaseGraph& other)
+{
+    mVertexBuckets = other.mVertexBuckets;
+    mEdgeBuckets = other.mEdgeBuckets;
+    mAdjacencyIndexEnabled = other.mAdjacencyIndexEnabled;
+    mAdjacencyIndex = other.mAdjacencyIndex;
+    mVertexLabels = other.mVertexLabels;
+    mLabelRevision = other.mLabelRevision;
+}
+
+void BaseGraph::rebuildLabelIndex() const
+{
+    mLabelRevision = GraphElement::getLabelRevision();
+    mVertexLabels.clear();
+
+    std::vector< shared_ptr<Vertex> > vertices = mVertexBuckets.getElements<Vertex>();
+    for(size_t i = 0; i < vertices.size(); ++i)
+    {
+        mVertexLabels.add(getVertexId(vertices[i]), vertices[i]->getLabelSymbol());
+    }
+}
+
+std::vector<Vertex::Ptr> BaseGraph::findVerticesByLabel(const std::string& label) const
+{
+    std::vector<Vertex::Ptr> vertices;
+    Symbol symbol;
+    if(!SymbolTable::lookup(label, symbol))
+    {
+        return vertices;
+    }
+
+    if(mLabelRevision != GraphElement::getLabelRevision())
+    {
+        rebuildLabelIndex();
+    }
+
+    const LabelIndex::IdList& ids = mVertexLabels.find(symbol);
+    vertices.reserve(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        vertices.push_back(mVertexBuckets.getElement(ids[i]));
+    }
+    return vertices;
+}
+
+void BaseGraph::removeFromIndices(EdgeHandle edge)
+{
+    mEdgeBuckets.remove(edge.id);
+    if(mAdjacencyIndexEnabled)
+    {
+        mAdjacencyIndex.remove(source(edge).id, target(edge).id, edge.id);
+    }
+}
+
+VertexHandle BaseGraph::source(EdgeHandle edge) const
+{
+    return VertexHandle(getVertexId(getEdge(edge.id)->getSourceVertex()));
+}
+
+VertexHandle BaseGraph::target(EdgeHandle edge) const
+{
+    return VertexHandle(getVertexId(getEdge(edge.id)->getTargetVertex()));
+}
+
+void BaseGraph::visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    EdgeIterator::Ptr edgeIt = getOutEdgeIterator(getVertex(vertex.id));
+    while(edgeIt->next())
+    {
+        visitor(context, EdgeHandle(getEdgeId(edgeIt->current())));
+    }
+}
+
+void BaseGraph::visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    EdgeIterator::Ptr edgeIt = getInEdgeIterator(getVertex(vertex.id));
+    while(edgeIt->next())
+    {
+        visitor(context, EdgeHandle(getEdgeId(edgeIt->current())));
+    }
+}
+
 
 SpecializedIterable<EdgeIterator::Ptr, BaseGraph, Edge::Ptr,Vertex::Ptr> BaseGraph::inEdges(const Vertex::Ptr& vertex) const
 {
@@ -2,6 +2,7 @@
 #define GRAPH_ANALYSIS_BASE_GRAPH_HPP
 
 #include <set>
+#include <type_traits>
 #include "SharedPtr.hpp"
 #include "EdgeIterator.hpp"
 #include "VertexIterator.hpp"
@@ -10,7 +11,13 @@
 #include "Algorithms.hpp"
 #include "BaseIterable.hpp"
 #include "BaseGraphObserver.hpp"
+#include "ObserverEventBatch.hpp"
 #include "HyperEdge.hpp"
+#include "AttributeColumn.hpp"
+#include "ElementHandle.hpp"
+#include "TypeBuckets.hpp"
+#include "AdjacencyIndex.hpp"
+#include "LabelIndex.hpp"
 
 /**
  * The main namespace of this library
@@ -36,7 +43,7 @@ public:
     /**
      * \brief Default deconstructor
      */
-    virtual ~BaseGraph() {}
+    virtual ~BaseGraph() { GraphElement::releaseAssociations(mId); }
 
     /**
      * Get a graph instance of the given implementation type
@@ -46,6 +53,10 @@ public:
 
     /**
      * Add an observer to the set of observers (see BaseGraphObserver.hpp)
+     * \details Observers which accept batches receive the events of a
+     * transaction at once via BaseGraphObserver::notifyBatch. Heavy
+     * observers can be wrapped into an AsyncObserver to process the events
+     * on a separate thread.
      */
     void addObserver(const BaseGraphObserver::Ptr& observer);
 
@@ -77,6 +88,10 @@ public:
      * The copy of the graph and this graph will still share the same set of
      * edges and vertices.
      * If you require complete separation consider calling clone
+     * \details The vertices and edges are not associated with the copy
+     * one by one: the copy uses the same element ids and shares the
+     * associations with this graph until an element is added or removed,
+     * see GraphElement::shareAssociations
      * \return pointer to the copy of this graph
      */
     virtual BaseGraph::Ptr copy() const { throw std::runtime_error("BaseGraph::copy: not implemented"); }
@@ -84,14 +99,33 @@ public:
     /**
      * Clone the graph, i.e. provides a deep copy of this graph so that
      * this graph and the clone do not share any references
+     * \details Elements are cloned in parallel for large graphs if enabled,
+     * see setParallelCloneEnabled
      */
     BaseGraph::Ptr clone() const;
 
     /**
      * Copy the vertices, but clone the edges of the graph
+     * \details Edges are cloned in parallel for large graphs if enabled,
+     * see setParallelCloneEnabled
      */
     BaseGraph::Ptr cloneEdges() const;
 
+    /**
+     * Enable (or disable) cloning the elements in parallel in clone() and
+     * cloneEdges()
+     * \details Disabled by default. Only enable it if getClone of all
+     * element types in this graph is thread-safe, and measure the benefit
+     * (see graph_analysis-bm): the graph is populated with the clones on
+     * the calling thread in either case
+     */
+    void setParallelCloneEnabled(bool enabled) { mParallelCloneEnabled = enabled; }
+
+    /**
+     * Test whether elements are cloned in parallel
+     */
+    bool isParallelCloneEnabled() const { return mParallelCloneEnabled; }
+
     /**
      * Allow to create an instance of the same type of graph
      */
@@ -151,6 +185,8 @@ public:
 
     /**
      * \brief Remove vertex
+     * The edges of the vertex are removed first, so that observers are
+     * notified of their removal as well
      * In order to reimplement, call the base function first
      * BaseGraph::addVertex(v)
      */
@@ -162,6 +198,35 @@ public:
      */
     GraphElementId addEdge(const Edge::Ptr& edge);
 
+    /**
+     * \brief Reserve space for the given number of additional vertices and
+     * edges
+     * \details
+     * This is a hint to the underlying implementation, e.g. to avoid
+     * reallocation when a larger number of elements is inserted in one go.
+     * The default implementation does nothing
+     */
+    virtual void reserve(size_t numberOfVertices, size_t numberOfEdges) { (void) numberOfVertices; (void) numberOfEdges; }
+
+    /**
+     * \brief Add a list of vertices in one go
+     * \details
+     * Space is reserved upfront and the insertion is bracketed by a
+     * TRANSACTION_START / TRANSACTION_STOP event
+     * \throws std::runtime_error if one of the vertices already exists in the graph
+     */
+    void addVertices(const std::vector<Vertex::Ptr>& vertices);
+
+    /**
+     * \brief Add a list of edges in one go
+     * \details
+     * Source and target vertices which are not yet part of the graph will be
+     * added. Space is reserved upfront and the insertion is bracketed by a
+     * TRANSACTION_START / TRANSACTION_STOP event
+     * \throws std::runtime_error if one of the edges already exists in the graph
+     */
+    void addEdges(const std::vector<Edge::Ptr>& edges);
+
     /**
      * Remove an edge and disassociate from this graph
      * In order to reimplement, call the base function first
@@ -218,50 +283,103 @@ public:
      */
     virtual std::vector<Edge::Ptr> getEdges(const Vertex::Ptr& source, const Vertex::Ptr& target) const;
 
+    /**
+     * \brief Test whether there is an edge from source to target -- for
+     * undirected graphs in either direction
+     * \details O(1) expected with the adjacency index, otherwise linear in
+     * the out degree of source
+     */
+    bool hasEdge(const Vertex::Ptr& source, const Vertex::Ptr& target) const;
+
+    /**
+     * Enable (or disable) the index of the edges by the ids of their source
+     * and target vertex
+     * \details The index is built from the current edges and maintained by
+     * adding and removing edges. It turns getEdges(source, target),
+     * getEdges<T>(source, target), hasEdge and removeEdges into O(1)
+     * expected lookups, at the cost of memory and slower modifications.
+     * Copies of the graph inherit the index
+     */
+    void setAdjacencyIndexEnabled(bool enabled);
+
+    /**
+     * Test whether the adjacency index is enabled
+     */
+    bool isAdjacencyIndexEnabled() const { return mAdjacencyIndexEnabled; }
+
     /**
      * \brief Get edges by given vertices and return only edges of a given type
      * that end at target
      * Type should be a subclass of Edge!!
-     * If dynamic_pointer_cast returns null pointer, object is not added
+     * \details The type is checked per class of edges (see TypeBuckets), not
+     * per edge
      */
     template<typename T>
     std::vector< shared_ptr<T> > getEdges(const Vertex::Ptr& source, const Vertex::Ptr& target) const
     {
         std::vector< shared_ptr<T> > edges;
-        EdgeIterator::Ptr edgeIt = getEdgeIterator(source);
-        while(edgeIt->next())
+        std::vector<bool> matching = mEdgeBuckets.template getMatchingBuckets<T>();
+        if(mAdjacencyIndexEnabled)
         {
-            shared_ptr<T> edge = dynamic_pointer_cast<T>( edgeIt->current() );
-            if(edge && edge->getTargetVertex() == target)
+            const AdjacencyIndex::EdgeIdList* edgeIds = mAdjacencyIndex.find(getVertexId(source), getVertexId(target));
+            for(size_t i = 0; edgeIds && i < edgeIds->size(); ++i)
             {
-                edges.push_back(edge);
+                size_t bucket = mEdgeBuckets.getBucketIndex((*edgeIds)[i]);
+                if(bucket != TypeBuckets<Edge>::npos && matching[bucket])
+                {
+                    edges.push_back(static_pointer_cast<T>(mEdgeBuckets.getElement((*edgeIds)[i])));
+                }
             }
+            return edges;
         }
 
+        VertexHandle targetHandle = getVertexHandle(target);
+        forEachOutEdge(getVertexHandle(source), [this, &edges, &matching, targetHandle](EdgeHandle edge)
+            {
+                size_t bucket = mEdgeBuckets.getBucketIndex(edge.id);
+                if(bucket != TypeBuckets<Edge>::npos && matching[bucket] && this->target(edge) == targetHandle)
+                {
+                    edges.push_back(static_pointer_cast<T>(mEdgeBuckets.getElement(edge.id)));
+                }
+            });
+
         return edges;
     }
 
+    /**
+     * \brief Get all vertices with the given label
+     * \details Vertices are indexed by their (interned) label, so this takes
+     * O(k) for k matching vertices. Changing the label of a vertex, which is
+     * part of a graph, invalidates the index of all graphs, which is rebuilt
+     * on the next call
+     */
+    std::vector<Vertex::Ptr> findVerticesByLabel(const std::string& label) const;
+
     /**
      * \brief Get all vertices of a given type
      * Type should be a subclass of vertex
-     * If dynamic_pointer_cast returns null pointer, object is not added
+     * \details Vertices are indexed by their class (see TypeBuckets), so
+     * this takes O(k) for k matching vertices and requires no cast per vertex
      */
     template<typename T>
-    std::vector< shared_ptr<T> > getVertices() const
-    {
-        std::vector< shared_ptr<T> > vertices;
-        VertexIterator::Ptr vertexIt = getVertexIterator();
-        while(vertexIt->next())
-        {
-            shared_ptr<T> vertex = dynamic_pointer_cast<T>( vertexIt->current() );
-            if(vertex)
-            {
-                vertices.push_back(vertex);
-            }
-        }
+    std::vector< shared_ptr<T> > getVertices() const { return mVertexBuckets.template getElements<T>(); }
 
-        return vertices;
-    }
+    /**
+     * \brief Get all edges of a given type
+     * \see getVertices
+     */
+    template<typename T>
+    std::vector< shared_ptr<T> > getEdges() const { return mEdgeBuckets.template getElements<T>(); }
+
+    /**
+     * Get the vertices of this graph indexed by their class
+     */
+    const TypeBuckets<Vertex>& getVertexBuckets() const { return mVertexBuckets; }
+
+    /**
+     * Get the edges of this graph indexed by their class
+     */
+    const TypeBuckets<Edge>& getEdgeBuckets() const { return mEdgeBuckets; }
 
     /**
      * Get the graph id
@@ -269,6 +387,16 @@ public:
      */
     GraphId getId() const { return mId; }
 
+    /**
+     * Get the version of the graph, which is incremented with each added or
+     * removed vertex and edge
+     * \details The version is monotonic for the lifetime of the graph and can
+     * be used as key by caches of derived data. The counter is not synchronized,
+     * i.e. it has to be read from the thread which modifies the graph -- other
+     * threads should use the version of a published GraphSnapshot
+     */
+    uint64_t version() const { return mVersion; }
+
     /**
      * Get the iterator over all vertices in this graph
      * \return the vertex iterator
@@ -351,6 +479,55 @@ public:
     SpecializedIterable<EdgeIterator::Ptr, BaseGraph, Edge::Ptr,Vertex::Ptr> inEdges(const Vertex::Ptr& vertex) const;
     SpecializedIterable<EdgeIterator::Ptr, BaseGraph, Edge::Ptr,Vertex::Ptr> outEdges(const Vertex::Ptr& vertex) const;
 
+    /**
+     * Get the handle of a vertex of this graph
+     */
+    VertexHandle getVertexHandle(const Vertex::Ptr& vertex) const { return VertexHandle(getVertexId(vertex)); }
+
+    /**
+     * Get the handle of an edge of this graph
+     */
+    EdgeHandle getEdgeHandle(const Edge::Ptr& edge) const { return EdgeHandle(getEdgeId(edge)); }
+
+    /**
+     * Get the source vertex of an edge
+     */
+    virtual VertexHandle source(EdgeHandle edge) const;
+
+    /**
+     * Get the target vertex of an edge
+     */
+    virtual VertexHandle target(EdgeHandle edge) const;
+
+    /**
+     * Call function(EdgeHandle) for each out edge of a vertex
+     * \details In contrast to the edge iterators, no shared pointer is
+     * copied, i.e. the reference counts of the elements are not touched.
+     * Hence, multiple threads can traverse the graph concurrently without
+     * competing for the cache lines of the elements
+     \verbatim
+        graph->forEachOutEdge(vertex, [&graph,&reached](EdgeHandle edge)
+            {
+                reached.insert(graph->target(edge));
+            });
+     \endverbatim
+     */
+    template<typename F>
+    void forEachOutEdge(VertexHandle vertex, F&& function) const
+    {
+        visitOutEdges(vertex, &invokeEdgeVisitor<typename std::remove_reference<F>::type>, toContext(function));
+    }
+
+    /**
+     * Call function(EdgeHandle) for each in edge of a vertex
+     * \see forEachOutEdge
+     */
+    template<typename F>
+    void forEachInEdge(VertexHandle vertex, F&& function) const
+    {
+        visitInEdges(vertex, &invokeEdgeVisitor<typename std::remove_reference<F>::type>, toContext(function));
+    }
+
     /**
      * Test if graph is undirected
      */
@@ -361,6 +538,42 @@ public:
      */
     bool isDirected() const { return mDirected; }
 
+    /**
+     * Get the typed attribute columns of the vertices of this graph, which
+     * are indexed by the vertex id
+     * \details Columns that have been registered for a vertex type (see
+     * AttributeManager::registerColumn) are created once the first vertex of
+     * this type is added. The values of an added vertex are reset to the
+     * default value. Columns are transferred by clone() and cloneEdges(), but
+     * not by copy()
+     */
+    AttributeColumns& getVertexColumns() { return mVertexColumns; }
+    const AttributeColumns& getVertexColumns() const { return mVertexColumns; }
+
+    /**
+     * Get the typed attribute columns of the edges of this graph, which
+     * are indexed by the edge id
+     * \see getVertexColumns
+     */
+    AttributeColumns& getEdgeColumns() { return mEdgeColumns; }
+    const AttributeColumns& getEdgeColumns() const { return mEdgeColumns; }
+
+    /**
+     * Get the vertex column with the given name, the column is created if it
+     * does not exist yet
+     * \throw std::invalid_argument if the column exists with a different type
+     */
+    template<typename T>
+    AttributeColumn<T>& getVertexColumn(const std::string& name) { return mVertexColumns.get<T>(name); }
+
+    /**
+     * Get the edge column with the given name, the column is created if it
+     * does not exist yet
+     * \throw std::invalid_argument if the column exists with a different type
+     */
+    template<typename T>
+    AttributeColumn<T>& getEdgeColumn(const std::string& name) { return mEdgeColumns.get<T>(name); }
+
 protected:
 
     /**
@@ -399,6 +612,41 @@ protected:
      */
     virtual SubGraph::Ptr createSubGraph(const Ptr& baseGraph) const { (void) baseGraph; throw std::runtime_error("BaseGraph::createSubGraph: not implemented"); }
 
+    /**
+     * Increment the version, for implementations that modify their internal
+     * representation without using addVertex/addEdge, e.g. when copying
+     */
+    void incrementVersion() { ++mVersion; }
+
+    /**
+     * Rebuild the indices of vertices and edges (by class and by adjacency),
+     * for implementations that modify their internal representation without
+     * using addVertex/addEdge
+     */
+    void rebuildIndices();
+
+    /**
+     * Copy the indices of vertices and edges from another graph, which has
+     * the same elements with the same ids
+     */
+    void copyIndices(const BaseGraph& other);
+
+    /// Callback of visitOutEdges/visitInEdges, which receives the context
+    /// that has been passed to the visit function
+    typedef void (*EdgeVisitor)(void* context, EdgeHandle edge);
+
+    /**
+     * Call the visitor for each out edge of the vertex -- implementations
+     * should override this to avoid the default, iterator based version
+     */
+    virtual void visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+
+    /**
+     * Call the visitor for each in edge of the vertex
+     * \see visitOutEdges
+     */
+    virtual void visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+
 private:
     /// Id of the graph
     GraphId mId;
@@ -411,11 +659,60 @@ private:
 
     // The current hook
     std::set<BaseGraphObserver::Ptr> mObservers;
+    // Observers which receive events as batches
+    std::set<BaseGraphObserver::Ptr> mBatchObservers;
+    // Events of the current transaction for the batch observers
+    ObserverEventBatch mPendingEvents;
+    int mTransactionLevel;
+
+    // Modification counter
+    uint64_t mVersion;
+
+    // Typed attributes, indexed by element id
+    AttributeColumns mVertexColumns;
+    AttributeColumns mEdgeColumns;
+
+    // Vertices and edges by class
+    TypeBuckets<Vertex> mVertexBuckets;
+    TypeBuckets<Edge> mEdgeBuckets;
+
+    /// Clone elements on multiple threads
+    bool mParallelCloneEnabled;
+
+    // Edges by source and target, if enabled
+    bool mAdjacencyIndexEnabled;
+    AdjacencyIndex mAdjacencyIndex;
+
+    // Vertices by label, rebuilt on demand once labels have been changed
+    mutable LabelIndex mVertexLabels;
+    mutable uint64_t mLabelRevision;
 
     // Notification of observers
     void notifyAll(const Vertex::Ptr& vertex, const EventType& event);
     void notifyAll(const Edge::Ptr& edge, const EventType& event);
     void notifyAll(const TransactionType& event);
+    void notifyBatchObservers(const ObserverEvent& event);
+
+    template<typename F>
+    static void invokeEdgeVisitor(void* context, EdgeHandle edge) { (*static_cast<F*>(context))(edge); }
+
+    template<typename F>
+    static void* toContext(F& function) { return const_cast<void*>(static_cast<const void*>(&function)); }
+
+    // Remove an edge from the indices, while it is still part of the graph
+    void removeFromIndices(EdgeHandle edge);
+
+    // Rebuild the index of vertices by label
+    void rebuildLabelIndex() const;
+
+    // Minimum number of elements per thread in clone() and cloneEdges()
+    size_t getCloneChunkSize() const;
+
+    // Copy the column values of the given elements of another graph to
+    // the corresponding elements of this graph
+    void copyColumns(const BaseGraph& other,
+            const std::vector<GraphElementId>& otherVertexIds, const std::vector<Vertex::Ptr>& vertices,
+            const std::vector<GraphElementId>& otherEdgeIds, const std::vector<Edge::Ptr>& edges);
 };
 
 } // end namespace graph_analysis
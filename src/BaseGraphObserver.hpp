@@ -30,6 +30,25 @@ enum TransactionType
     TRANSACTION_STOP
 };
 
+/**
+ * \brief A vertex or edge event, as passed to BaseGraphObserver::notify
+ */
+struct ObserverEvent
+{
+    GraphElement::Ptr element;
+    GraphId origin;
+    EventType event;
+
+    ObserverEvent();
+    ObserverEvent( GraphElement::Ptr element, GraphId origin, EventType event );
+
+    /** @brief return true if a match is found between two events
+     * @return true if events cancel each other out.  This is e.g. the case
+     * when for an add/remove on the same element.
+     */
+    bool match( const ObserverEvent& other ) const;
+};
+
 /**
  * \brief Virtual interface class for observing a base graph
  */
@@ -40,6 +59,36 @@ public:
 
     virtual ~BaseGraphObserver() {}
 
+    /**
+     * \brief Whether this observer receives vertex and edge events as batch
+     * \details The events of a transaction are then collected by the graph
+     * and passed to notifyBatch once the outermost transaction has been
+     * stopped (before the TRANSACTION_STOP event). Within the batch, an
+     * element which has been added and removed again is not reported, and
+     * each element is reported at most once. Events outside of transactions
+     * are passed as batch of a single event.
+     */
+    virtual bool acceptsBatches() const { return false; }
+
+    /**
+     * \brief Notify about a batch of vertex and edge events
+     * \details The default implementation calls notify for each event
+     */
+    virtual void notifyBatch(const std::vector<ObserverEvent>& events)
+    {
+        std::vector<ObserverEvent>::const_iterator cit = events.begin();
+        for(; cit != events.end(); ++cit)
+        {
+            Vertex::Ptr vertex = dynamic_pointer_cast<Vertex>(cit->element);
+            if(vertex)
+            {
+                notify(vertex, cit->event, cit->origin);
+            } else {
+                notify(dynamic_pointer_cast<Edge>(cit->element), cit->event, cit->origin);
+            }
+        }
+    }
+
     virtual void notify(const Vertex::Ptr& vertex, const EventType& event,
                         const GraphId& origin)
     {
@@ -29,6 +29,9 @@ struct Benchmark
     numeric::Stats<double> iterateEdgesStats;
     numeric::Stats<double> iterateStlEdgesStats;
 
+    numeric::Stats<double> cloneStats;
+    numeric::Stats<double> parallelCloneStats;
+
     const numeric::Stats<double>& getAddNodesStats() const { return addNodesStats; }
     const numeric::Stats<double>& getGetNodesStats() const { return getNodesStats; }
     const numeric::Stats<double>& getIterateNodesStats() const { return iterateNodesStats; }
@@ -53,6 +56,8 @@ struct Benchmark
         ss << "    iterate (p edge):   " << iterateEdgesStats.mean() << "+/-" << iterateEdgesStats.stdev() << " s" << std::endl;
         ss << "stl iterate (p node):   " << iterateStlNodesStats.mean() << "+/-" << iterateStlNodesStats.stdev() <<" s" << std::endl;
         ss << "stl iterate (p edge):   " << iterateStlEdgesStats.mean() << "+/-" << iterateStlEdgesStats.stdev() << " s" << std::endl;
+        ss << "    clone   (serial):   " << cloneStats.mean() << "+/-" << cloneStats.stdev() << " s" << std::endl;
+        ss << "    clone   (parallel): " << parallelCloneStats.mean() << "+/-" << parallelCloneStats.stdev() << " s" << std::endl;
         return ss.str();
     }
 
@@ -70,6 +75,9 @@ struct Benchmark
         std::ofstream file_iterateEdges(getLogFilename(logDir,label,"iterateEdges").c_str(), mode);
         std::ofstream file_iterateStlEdges(getLogFilename(logDir,label,"iterateStlEdges").c_str(), mode);
 
+        std::ofstream file_clone(getLogFilename(logDir,label,"clone").c_str(), mode);
+        std::ofstream file_parallelClone(getLogFilename(logDir,label,"parallelClone").c_str(), mode);
+
         if(addNodesStats.n() > 0)
         {
             file_addNodes << numberOfNodes << " "
@@ -134,6 +142,22 @@ struct Benchmark
                 << iterateStlEdgesStats.stdev()
                 << std::endl;
         }
+
+        if(cloneStats.n() > 0)
+        {
+            file_clone << numberOfEdges << " "
+                << cloneStats.mean() << " "
+                << cloneStats.stdev()
+                << std::endl;
+        }
+
+        if(parallelCloneStats.n() > 0)
+        {
+            file_parallelClone << numberOfEdges << " "
+                << parallelCloneStats.mean() << " "
+                << parallelCloneStats.stdev()
+                << std::endl;
+        }
     }
 
     static std::string getLogFilename(const std::string& dir, const std::string& prefix, const std::string& label)
@@ -285,6 +309,20 @@ int main(int argc, char** argv)
                 stop = base::Time::now();
                 graphMark.iterateStlEdgesStats.update((stop-start).toSeconds());
 
+                //std::cout << "    -- clone" << std::endl;
+                graph->setParallelCloneEnabled(false);
+                start = base::Time::now();
+                graph->clone();
+                stop = base::Time::now();
+                graphMark.cloneStats.update((stop-start).toSeconds());
+
+                //std::cout << "    -- clone (parallel)" << std::endl;
+                graph->setParallelCloneEnabled(true);
+                start = base::Time::now();
+                graph->clone();
+                stop = base::Time::now();
+                graphMark.parallelCloneStats.update((stop-start).toSeconds());
+
             } // epochs
             graphMark.save(logDir);
             benchmarks.push_back(graphMark);
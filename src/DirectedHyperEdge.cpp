@@ -32,9 +32,9 @@ std::string DirectedHyperEdge::toString() const
 std::string DirectedHyperEdge::toString(uint32_t indent) const
 {
     std::string hspace(indent,' ');
-    if(!mLabel.empty())
+    if(getLabelSymbol() != SymbolTable::EMPTY)
     {
-        return hspace + mLabel;
+        return hspace + SymbolTable::resolve(getLabelSymbol());
     }
     else
     {
@@ -1,5 +1,7 @@
 #include "Edge.hpp"
+#include <typeinfo>
 #include "BaseGraph.hpp"
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
@@ -20,6 +22,23 @@ Edge::Ptr Edge::clone() const
     return edge;
 }
 
+Edge::Ptr Edge::clone(GraphArena& arena) const
+{
+    Edge::Ptr edge = getClone(arena);
+    edge->disassociateFromAll();
+    return edge;
+}
+
+Edge::Ptr Edge::getClone(GraphArena& arena) const
+{
+    if(typeid(*this) != typeid(Edge))
+    {
+        // Subclass which does not support arena allocation
+        return Edge::Ptr( getClone() );
+    }
+    return arena.create<Edge>(*this);
+}
+
 std::string Edge::getClassName() const
 {
     return "graph_analysis::Edge";
@@ -33,9 +52,9 @@ std::string Edge::toString() const
 std::string Edge::toString(uint32_t indent) const
 {
     std::string hspace(indent, ' ');
-    if(!mLabel.empty())
+    if(getLabelSymbol() != SymbolTable::EMPTY)
     {
-        return hspace + mLabel;
+        return hspace + SymbolTable::resolve(getLabelSymbol());
     }
     else
     {
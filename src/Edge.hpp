@@ -9,6 +9,7 @@ namespace graph_analysis
 
 class BaseGraph;
 class EdgeTypeManager;
+class GraphArena;
 
 /**
  * \brief An Edge represents the link between two vertices
@@ -35,6 +36,12 @@ public:
      */
     Edge::Ptr clone() const;
 
+    /**
+     * Clone this edge into the given arena -- the returned edge will have
+     * no graph association
+     */
+    Edge::Ptr clone(GraphArena& arena) const;
+
     // Get class name
     // \return class name
     virtual std::string getClassName() const;
@@ -129,9 +136,22 @@ public:
 protected:
     /**
      * Get instance of an edge
+     * \details If parallel cloning is enabled for a graph (see
+     * BaseGraph::setParallelCloneEnabled), this method is called concurrently
+     * for different edges and must therefore be thread-safe
      */
     virtual Edge* getClone() const { return new Edge(*this); }
 
+    /**
+     * Create a copy of this edge in the given arena
+     * \details Subclasses should override this method as well
+     \verbatim
+     return arena.create<MyEdge>(*this);
+     \endverbatim
+     * otherwise the copy is created on the heap using getClone()
+     */
+    virtual Edge::Ptr getClone(GraphArena& arena) const;
+
 private:
     Vertex::Ptr mSourceVertex;
     Vertex::Ptr mTargetVertex;
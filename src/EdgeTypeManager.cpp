@@ -1,23 +1,26 @@
 #include "EdgeTypeManager.hpp"
+#include <sstream>
 #include <boost/assign/list_of.hpp>
 #include <base-logging/Logging.hpp>
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
 EdgeTypeManager::EdgeTypeManager()
+    : mPrototypes(NULL)
 {
     Edge::Ptr edge(new Edge());
     registerType(edge);
     setDefaultType(edge->getClassName());
 }
 
-void EdgeTypeManager::registerType(const Edge::Ptr& edge, bool throwOnAlreadyRegistered)
+edge::TypeId EdgeTypeManager::registerType(const Edge::Ptr& edge, bool throwOnAlreadyRegistered)
 {
     //Create a empty structure for this type to make sure getMembers raise if a unregistered edge type is queried
-    registerType(edge->getClassName(), edge, throwOnAlreadyRegistered);
+    return registerType(edge->getClassName(), edge, throwOnAlreadyRegistered);
 }
 
-void EdgeTypeManager::registerType(const edge::Type& type, const Edge::Ptr& edge, bool throwOnAlreadyRegistered)
+edge::TypeId EdgeTypeManager::registerType(const edge::Type& type, const Edge::Ptr& edge, bool throwOnAlreadyRegistered)
 {
     assert(edge);
 
@@ -29,26 +32,76 @@ void EdgeTypeManager::registerType(const edge::Type& type, const Edge::Ptr& edge
                 edge->getClassName() + "'");
     }
 
-    try {
-        edgeByType(type, true);
+    // Check the clone function once, so that edges can be created by type id
+    // without checking each clone
+    Prototype prototype;
+    prototype.edge = edge;
+    prototype.validClone = edge->clone()->getClassName() == type;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::map<edge::Type, edge::TypeId>::const_iterator cit = mTypeIds.find(type);
+    if(cit != mTypeIds.end())
+    {
         LOG_INFO_S << "EdgeType '" + type + "' is already registered.";
-    } catch(...)
+        if(throwOnAlreadyRegistered)
+        {
+            throw std::runtime_error("graph_analysis::EdgeTypeManager::registerType: type '" + type + "' is already registered");
+        }
+        return cit->second;
+    }
+
+    LOG_INFO_S << "EdgeType '" + type + "' is newly registered.";
+    mTypeMap[type] = edge;
+    mRegisteredTypes.insert(type);
+
+    // Publish a new list of prototypes, the previous list is kept alive for
+    // concurrent readers
+    const PrototypeList* prototypes = mPrototypes.load();
+    shared_ptr<PrototypeList> extendedPrototypes = prototypes ? make_shared<PrototypeList>(*prototypes) : make_shared<PrototypeList>();
+    edge::TypeId typeId = extendedPrototypes->size();
+    extendedPrototypes->push_back(prototype);
+    mPrototypeLists.push_back(extendedPrototypes);
+    mPrototypes.store(extendedPrototypes.get());
+    mTypeIds[type] = typeId;
+
+    activateAttributedType(type);
+    return typeId;
+}
+
+edge::TypeId EdgeTypeManager::getTypeId(const edge::Type& type) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::map<edge::Type, edge::TypeId>::const_iterator cit = mTypeIds.find(type);
+    if(cit == mTypeIds.end())
     {
-        LOG_INFO_S << "EdgeType '" + type + "' is newly registered.";
-        mTypeMap[type] = edge;
-        mRegisteredTypes.insert(type);
+        throw std::invalid_argument("graph_analysis::EdgeTypeManager::getTypeId: type '" + type + "' is not registered");
+    }
+    return cit->second;
+}
 
-        activateAttributedType(type);
-        return;
+const Edge::Ptr& EdgeTypeManager::prototype(edge::TypeId typeId) const
+{
+    const PrototypeList* prototypes = mPrototypes.load();
+    if(!prototypes || typeId >= prototypes->size())
+    {
+        std::stringstream ss;
+        ss << "graph_analysis::EdgeTypeManager: unknown type id " << typeId;
+        throw std::invalid_argument(ss.str());
     }
-    if(throwOnAlreadyRegistered)
+
+    const Prototype& prototype = (*prototypes)[typeId];
+    if(!prototype.validClone)
     {
-        throw std::runtime_error("graph_analysis::EdgeTypeManager::registerType: type '" + type + "' is already registered");
+        std::string msg = "graph_analysis::EdgeTypeManager: cannot create cloned edge of type " + prototype.edge->getClassName() + " it seems the 'virtual Edge* getClone() const' function of this class is implemented wrong";
+        LOG_WARN_S << msg;
+        throw std::runtime_error(msg);
     }
+    return prototype.edge;
 }
 
 Edge::Ptr EdgeTypeManager::edgeByType(const edge::Type& type, bool throwOnDefault)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     TypeMap::const_iterator it = mTypeMap.find(type);
     if(it == mTypeMap.end())
     {
@@ -67,6 +120,7 @@ Edge::Ptr EdgeTypeManager::edgeByType(const edge::Type& type, bool throwOnDefaul
 
 void EdgeTypeManager::setDefaultType(const std::string& defaultType)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     if( std::find(mRegisteredTypes.begin(), mRegisteredTypes.end(), defaultType) == mRegisteredTypes.end())
     {
         throw std::runtime_error("graph_analysis::EdgeTypeManager::setDefaultType: type '"
@@ -93,8 +147,80 @@ Edge::Ptr EdgeTypeManager::createEdge(const edge::Type& type, const Vertex::Ptr&
     return clonedEdge;
 }
 
+Edge::Ptr EdgeTypeManager::createEdge(const edge::Type& type, const std::string& label, GraphArena& arena, bool throwOnMissing)
+{
+    Edge::Ptr clonedEdge = edgeByType(type, throwOnMissing)->clone(arena);
+    clonedEdge->setLabel(label);
+    return clonedEdge;
+}
+
+Edge::Ptr EdgeTypeManager::createEdge(const edge::Type& type, const Vertex::Ptr& source, const Vertex::Ptr& target,
+        const std::string& label,
+        GraphArena& arena,
+        bool throwOnMissing)
+{
+    Edge::Ptr clonedEdge = edgeByType(type, throwOnMissing)->clone(arena);
+    clonedEdge->setLabel(label);
+    clonedEdge->setSourceVertex(source);
+    clonedEdge->setTargetVertex(target);
+    return clonedEdge;
+}
+
+Edge::Ptr EdgeTypeManager::createEdge(edge::TypeId typeId, const std::string& label) const
+{
+    Edge::Ptr clonedEdge = prototype(typeId)->clone();
+    clonedEdge->setLabel(label);
+    return clonedEdge;
+}
+
+Edge::Ptr EdgeTypeManager::createEdge(edge::TypeId typeId, const Vertex::Ptr& source, const Vertex::Ptr& target,
+        const std::string& label) const
+{
+    Edge::Ptr clonedEdge = prototype(typeId)->clone();
+    clonedEdge->setLabel(label);
+    clonedEdge->setSourceVertex(source);
+    clonedEdge->setTargetVertex(target);
+    return clonedEdge;
+}
+
+Edge::Ptr EdgeTypeManager::createEdge(edge::TypeId typeId, const Vertex::Ptr& source, const Vertex::Ptr& target,
+        const std::string& label,
+        GraphArena& arena) const
+{
+    Edge::Ptr clonedEdge = prototype(typeId)->clone(arena);
+    clonedEdge->setLabel(label);
+    clonedEdge->setSourceVertex(source);
+    clonedEdge->setTargetVertex(target);
+    return clonedEdge;
+}
+
+std::vector<Edge::Ptr> EdgeTypeManager::createEdges(edge::TypeId typeId, size_t numberOfEdges) const
+{
+    const Edge::Ptr& edge = prototype(typeId);
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(numberOfEdges);
+    for(size_t i = 0; i < numberOfEdges; ++i)
+    {
+        edges.push_back(edge->clone());
+    }
+    return edges;
+}
+
+std::vector<Edge::Ptr> EdgeTypeManager::createEdges(edge::TypeId typeId, size_t numberOfEdges, GraphArena& arena) const
+{
+    const Edge::Ptr& edge = prototype(typeId);
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(numberOfEdges);
+    for(size_t i = 0; i < numberOfEdges; ++i)
+    {
+        edges.push_back(edge->clone(arena));
+    }
+    return edges;
+}
+
 std::set<std::string> EdgeTypeManager::getSupportedTypes()
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mRegisteredTypes;
 }
 
@@ -2,7 +2,9 @@
 #define GRAPH_ANALYSIS_EDGE_TYPE_MANAGER_HPP
 
 #include <base-logging/Singleton.hpp>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -16,6 +18,8 @@ class Edge;
 namespace edge {
     // datatype for edge type specification
     typedef std::string Type;
+    // interned edge type, see EdgeTypeManager::getTypeId
+    typedef uint32_t TypeId;
 } // end namespace edge
 
 /**
@@ -25,6 +29,10 @@ namespace edge {
  * the EdgeTypeManager allows to instanciate edges corresponding to the
  * given class type -- which has to match the type string.
  * Instanciation is done via cloning the corresponding edge instance.
+ *
+ * Registering a type returns a TypeId, which allows to create edges without
+ * looking up the type by name. Registration and creation of edges are
+ * thread-safe, creation via TypeId does not lock.
  */
 class EdgeTypeManager : public base::Singleton<EdgeTypeManager>, public AttributeManager
 {
@@ -38,6 +46,27 @@ private:
     std::set<std::string> mRegisteredTypes;
     /// The default edge type
     std::string mDefaultType;
+    /// interned types
+    std::map<edge::Type, edge::TypeId> mTypeIds;
+
+    struct Prototype
+    {
+        Edge::Ptr edge;
+        /// whether cloning the edge yields the registered type
+        bool validClone;
+    };
+    typedef std::vector<Prototype> PrototypeList;
+    /// example edge instances indexed by type id, replaced on registration
+    /// so that readers do not need to lock
+    std::atomic<const PrototypeList*> mPrototypes;
+    /// all versions of the prototype list, since readers might still use
+    /// an outdated one
+    std::vector< shared_ptr<const PrototypeList> > mPrototypeLists;
+    /// guards the registration and lookup by type name
+    mutable std::mutex mMutex;
+
+    /// Get the example edge instance of the given type id
+    const Edge::Ptr& prototype(edge::TypeId typeId) const;
 
     typedef std::map<std::string, io::AttributeSerializationCallbacks> AttributeSerializationCallbackMap;
     std::map<std::string, AttributeSerializationCallbackMap > mRegisteredCallbacks;
@@ -57,10 +86,18 @@ protected:
 public:
 
     // Register edge class
-    void registerType(const Edge::Ptr& edge, bool throwOnAlreadyRegistered = false);
+    // \return the type id of the edge class
+    edge::TypeId registerType(const Edge::Ptr& edge, bool throwOnAlreadyRegistered = false);
 
     // Register edge class
-    void registerType(const edge::Type& type, const Edge::Ptr& edge, bool throwOnAlreadyRegistered = false);
+    // \return the type id of the edge class
+    edge::TypeId registerType(const edge::Type& type, const Edge::Ptr& edge, bool throwOnAlreadyRegistered = false);
+
+    /**
+     * Get the type id of a registered type
+     * \throw std::invalid_argument if the type is not registered
+     */
+    edge::TypeId getTypeId(const edge::Type& type) const;
 
     /**
      * Select the default edge type from the list of registered types
@@ -84,6 +121,58 @@ public:
     Edge::Ptr createEdge(const edge::Type& type, const Vertex::Ptr& source, const Vertex::Ptr& target
             , const std::string& label = ""
             , bool throwOnMissing = false);
+
+    /**
+     * \brief clones a new edge of a specified type into the given arena
+     * \param type the requested edge type
+     * \param label the requested edge label
+     * \param arena the arena the edge is allocated from
+     * \param throwOnMissing throw when edge type is missing
+     * \return smart pointer to the newly created edge instance
+     */
+    Edge::Ptr createEdge(const edge::Type& type, const std::string& label,
+            GraphArena& arena, bool throwOnMissing = false);
+
+    Edge::Ptr createEdge(const edge::Type& type, const Vertex::Ptr& source, const Vertex::Ptr& target
+            , const std::string& label
+            , GraphArena& arena
+            , bool throwOnMissing = false);
+
+    /**
+     * \brief clones a new edge of a registered type
+     * \param typeId the requested edge type, see registerType
+     * \param label the requested edge label
+     * \return smart pointer to the newly created edge instance
+     * \throw std::invalid_argument if the type id is unknown
+     */
+    Edge::Ptr createEdge(edge::TypeId typeId, const std::string& label = "") const;
+
+    Edge::Ptr createEdge(edge::TypeId typeId, const Vertex::Ptr& source, const Vertex::Ptr& target
+            , const std::string& label = "") const;
+
+    /**
+     * \brief clones a new edge of a registered type into the given arena
+     * \see createEdge(edge::TypeId, const std::string&)
+     */
+    Edge::Ptr createEdge(edge::TypeId typeId, const Vertex::Ptr& source, const Vertex::Ptr& target
+            , const std::string& label
+            , GraphArena& arena) const;
+
+    /**
+     * \brief clones a number of edges of a registered type
+     * \param typeId the requested edge type, see registerType
+     * \param numberOfEdges the number of edges to create
+     * \throw std::invalid_argument if the type id is unknown
+     */
+    std::vector<Edge::Ptr> createEdges(edge::TypeId typeId, size_t numberOfEdges) const;
+
+    /**
+     * \brief clones a number of edges of a registered type into the given
+     * arena, i.e. the edges are allocated contiguously
+     * \see createEdges(edge::TypeId, size_t)
+     */
+    std::vector<Edge::Ptr> createEdges(edge::TypeId typeId, size_t numberOfEdges, GraphArena& arena) const;
+
     /// lists the registered types
     std::set<std::string> getSupportedTypes();
 };
@@ -0,0 +1,62 @@
+#ifndef GRAPH_ANALYSIS_ELEMENT_HANDLE_HPP
+#define GRAPH_ANALYSIS_ELEMENT_HANDLE_HPP
+
+#include <limits>
+#include "GraphElement.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file ElementHandle.hpp
+ * \class VertexHandle
+ * \brief Lightweight reference to a vertex of a particular graph
+ * \details A handle is the plain element id of the vertex in the graph, so
+ * that -- in contrast to Vertex::Ptr -- copying a handle does not touch any
+ * reference count. Convert a handle with BaseGraph::getVertex(handle.id) only
+ * when the vertex itself is needed
+ */
+struct VertexHandle
+{
+    VertexHandle()
+        : id(std::numeric_limits<GraphElementId>::max())
+    {}
+
+    explicit VertexHandle(GraphElementId id)
+        : id(id)
+    {}
+
+    bool valid() const { return id != std::numeric_limits<GraphElementId>::max(); }
+
+    bool operator==(const VertexHandle& other) const { return id == other.id; }
+    bool operator!=(const VertexHandle& other) const { return id != other.id; }
+    bool operator<(const VertexHandle& other) const { return id < other.id; }
+
+    GraphElementId id;
+};
+
+/**
+ * \class EdgeHandle
+ * \brief Lightweight reference to an edge of a particular graph
+ * \see VertexHandle
+ */
+struct EdgeHandle
+{
+    EdgeHandle()
+        : id(std::numeric_limits<GraphElementId>::max())
+    {}
+
+    explicit EdgeHandle(GraphElementId id)
+        : id(id)
+    {}
+
+    bool valid() const { return id != std::numeric_limits<GraphElementId>::max(); }
+
+    bool operator==(const EdgeHandle& other) const { return id == other.id; }
+    bool operator!=(const EdgeHandle& other) const { return id != other.id; }
+    bool operator<(const EdgeHandle& other) const { return id < other.id; }
+
+    GraphElementId id;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_ELEMENT_HANDLE_HPP
@@ -207,6 +207,25 @@ public:
      */
     virtual bool apply(FilterObject o) const { (void)o; return false; }
 
+    /**
+     * \brief Prepare this filter and its subfilters for a concurrent
+     * evaluation
+     * \details SubGraph::applyFilters calls this function before evaluating
+     * the filter on multiple threads, so that filters can precompute their
+     * results per class. It must not be called while the filter is being
+     * evaluated
+     * \param vertexClasses one vertex per class of the vertices to evaluate
+     * \param edgeClasses one edge per class of the edges to evaluate
+     */
+    virtual void prepare(const std::vector<Vertex::Ptr>& vertexClasses, const std::vector<Edge::Ptr>& edgeClasses)
+    {
+        typename FilterList::iterator it = mFilters.begin();
+        for(; it != mFilters.end(); ++it)
+        {
+            (*it)->prepare(vertexClasses, edgeClasses);
+        }
+    }
+
     /**
      * Return Null Filter
      */
@@ -0,0 +1,93 @@
+#include "GraphArena.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace graph_analysis {
+namespace {
+
+/// Pool of the arena storage which has been used last by this thread
+struct PoolCache
+{
+    uint64_t serial;
+    void* pool;
+};
+
+thread_local PoolCache poolCache = { 0, NULL };
+
+std::atomic<uint64_t> nextSerial(1);
+
+} // end anonymous namespace
+
+const size_t GraphArena::DEFAULT_SLAB_SIZE;
+
+GraphArena::Storage::Storage(size_t slabSize)
+    : mSlabSize(slabSize)
+    , mSerial(nextSerial++)
+    , mNumberOfSlabs(0)
+    , mReservedBytes(0)
+{
+    if(mSlabSize == 0)
+    {
+        throw std::invalid_argument("graph_analysis::GraphArena: slab size must be greater than 0");
+    }
+}
+
+GraphArena::Storage::~Storage()
+{
+    std::map<std::thread::id, Pool*>::const_iterator cit = mPools.begin();
+    for(; cit != mPools.end(); ++cit)
+    {
+        for(size_t i = 0; i < cit->second->slabs.size(); ++i)
+        {
+            delete[] cit->second->slabs[i];
+        }
+        delete cit->second;
+    }
+}
+
+void* GraphArena::Storage::allocate(size_t size, size_t alignment)
+{
+    Pool& pool = getPool();
+
+    uintptr_t address = (reinterpret_cast<uintptr_t>(pool.current) + alignment - 1) & ~(alignment - 1);
+    if(pool.current == NULL || address + size > reinterpret_cast<uintptr_t>(pool.end))
+    {
+        // Start a new slab, large objects get a slab of their own
+        size_t slabSize = std::max(mSlabSize, size + alignment);
+        char* slab = new char[slabSize];
+        pool.slabs.push_back(slab);
+        ++mNumberOfSlabs;
+        mReservedBytes += slabSize;
+
+        pool.current = slab;
+        pool.end = slab + slabSize;
+        address = (reinterpret_cast<uintptr_t>(pool.current) + alignment - 1) & ~(alignment - 1);
+    }
+
+    pool.current = reinterpret_cast<char*>(address + size);
+    return reinterpret_cast<void*>(address);
+}
+
+GraphArena::Storage::Pool& GraphArena::Storage::getPool()
+{
+    if(poolCache.serial == mSerial)
+    {
+        return *static_cast<Pool*>(poolCache.pool);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    Pool*& pool = mPools[std::this_thread::get_id()];
+    if(!pool)
+    {
+        pool = new Pool();
+    }
+    poolCache.serial = mSerial;
+    poolCache.pool = pool;
+    return *pool;
+}
+
+GraphArena::GraphArena(size_t slabSize)
+    : mStorage(new Storage(slabSize))
+{}
+
+} // end namespace graph_analysis
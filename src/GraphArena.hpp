@@ -0,0 +1,163 @@
+#ifndef GRAPH_ANALYSIS_GRAPH_ARENA_HPP
+#define GRAPH_ANALYSIS_GRAPH_ARENA_HPP
+
+#include <stdint.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "SharedPtr.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file GraphArena.hpp
+ * \class GraphArena
+ * \brief Pool allocation of graph elements (or any other shared objects)
+ * \details Objects are created with allocate_shared, so that object and
+ * reference count are placed in a single allocation, which is taken from a
+ * contiguous slab of memory. Each thread allocates from its own pool of
+ * slabs, so no locking is required for creating objects.
+ *
+ * The memory of destroyed objects is not reused: all slabs are released at
+ * once, when the arena and all objects created by it have been destroyed.
+ * Hence, an arena fits elements which are created in bulk and dropped
+ * together with their graph.
+ *
+ \verbatim
+    GraphArena arena;
+    for(size_t i = 0; i < n; ++i)
+    {
+        Vertex::Ptr vertex = arena.create<Vertex>();
+        ...
+    }
+    Vertex::Ptr vertex = VertexTypeManager::getInstance()->createVertex("graph_analysis::Vertex", "label", arena);
+ \endverbatim
+ */
+class GraphArena
+{
+public:
+    typedef shared_ptr<GraphArena> Ptr;
+
+    /// Default size of a slab in bytes
+    static const size_t DEFAULT_SLAB_SIZE = 1 << 20;
+
+    /**
+     * \class Storage
+     * \brief Slabs of all threads, kept alive by the arena and all allocated objects
+     */
+    class Storage
+    {
+    public:
+        Storage(size_t slabSize);
+        ~Storage();
+
+        /**
+         * Allocate memory from the slabs of the calling thread
+         */
+        void* allocate(size_t size, size_t alignment);
+
+        size_t getNumberOfSlabs() const { return mNumberOfSlabs; }
+        size_t getReservedBytes() const { return mReservedBytes; }
+
+    private:
+        Storage(const Storage&);
+        Storage& operator=(const Storage&);
+
+        struct Pool
+        {
+            Pool()
+                : current(NULL)
+                , end(NULL)
+            {}
+
+            char* current;
+            char* end;
+            std::vector<char*> slabs;
+        };
+
+        Pool& getPool();
+
+        size_t mSlabSize;
+        /// Unique number, to identify the pool of a thread
+        uint64_t mSerial;
+        std::mutex mMutex;
+        std::map<std::thread::id, Pool*> mPools;
+        std::atomic<size_t> mNumberOfSlabs;
+        std::atomic<size_t> mReservedBytes;
+    };
+
+    /**
+     * \class Allocator
+     * \brief Standard conforming allocator using the slabs of an arena
+     * \details Deallocation is a no-op, memory is released with the arena
+     */
+    template<typename T>
+    class Allocator
+    {
+    public:
+        typedef T value_type;
+
+        explicit Allocator(const shared_ptr<Storage>& storage)
+            : mStorage(storage)
+        {}
+
+        template<typename U>
+        Allocator(const Allocator<U>& other)
+            : mStorage(other.getStorage())
+        {}
+
+        T* allocate(size_t n) { return static_cast<T*>(mStorage->allocate(n*sizeof(T), alignof(T))); }
+
+        void deallocate(T*, size_t) {}
+
+        const shared_ptr<Storage>& getStorage() const { return mStorage; }
+
+        template<typename U>
+        bool operator==(const Allocator<U>& other) const { return mStorage == other.getStorage(); }
+
+        template<typename U>
+        bool operator!=(const Allocator<U>& other) const { return mStorage != other.getStorage(); }
+
+    private:
+        shared_ptr<Storage> mStorage;
+    };
+
+    /**
+     * \param slabSize Size of the slabs in bytes
+     */
+    GraphArena(size_t slabSize = DEFAULT_SLAB_SIZE);
+
+    /**
+     * Create an object in the arena
+     */
+    template<typename T, typename... Args>
+    shared_ptr<T> create(Args&&... args)
+    {
+        return allocate_shared<T>(Allocator<T>(mStorage), std::forward<Args>(args)...);
+    }
+
+    /**
+     * Get an allocator for the arena
+     */
+    template<typename T>
+    Allocator<T> getAllocator() const { return Allocator<T>(mStorage); }
+
+    /**
+     * Get the number of slabs, which have been allocated so far
+     */
+    size_t getNumberOfSlabs() const { return mStorage->getNumberOfSlabs(); }
+
+    /**
+     * Get the total size of the allocated slabs in bytes
+     */
+    size_t getReservedBytes() const { return mStorage->getReservedBytes(); }
+
+private:
+    shared_ptr<Storage> mStorage;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_GRAPH_ARENA_HPP
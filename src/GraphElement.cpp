@@ -1,33 +1,201 @@
 #include "GraphElement.hpp"
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 #include <sstream>
+#include <typeindex>
+#include <boost/unordered_map.hpp>
 
 namespace graph_analysis {
 
+namespace {
+
+/// Id which marks an element as removed from a graph, which shares the
+/// associations of a base graph
+const GraphElementId REMOVED_ELEMENT_ID = std::numeric_limits<GraphElementId>::max();
+
+struct SharedAssociations
+{
+    SharedAssociations()
+        : baseGraph(0)
+        , hasBaseGraph(false)
+        , alive(true)
+    {}
+
+    GraphId baseGraph;
+    bool hasBaseGraph;
+    bool alive;
+    /// Graphs sharing the associations of this graph
+    std::vector<GraphId> sharingGraphs;
+};
+
+typedef std::map<GraphId, SharedAssociations> SharedAssociationsMap;
+
+SharedAssociationsMap sharedAssociations;
+std::mutex sharedAssociationsMutex;
+/// Protects the uuid generator and the registry of elements, so that elements
+/// can be created on multiple threads
+std::mutex elementRegistryMutex;
+
+/// Size of the graph filters below
+const size_t GRAPH_FILTER_SIZE = 4096;
+/// Counting filters, which allow to test without locking whether a graph
+/// might have an entry in sharedAssociations, or an entry with a base graph.
+/// Graph ids are assigned sequentially, so that graphs only collide if their
+/// ids differ by a multiple of the filter size -- graphs which do not share
+/// associations thus (almost) never lock. Being static, the counts are zero
+/// initialized
+std::atomic<uint32_t> associationsFilter[GRAPH_FILTER_SIZE];
+std::atomic<uint32_t> baseGraphFilter[GRAPH_FILTER_SIZE];
+
+bool mayContain(const std::atomic<uint32_t>* filter, GraphId graph)
+{
+    return filter[graph % GRAPH_FILTER_SIZE].load() != 0;
+}
+
+/// Get the entry of a graph, which is created if necessary
+SharedAssociations& getSharedAssociations(GraphId graph)
+{
+    std::pair<SharedAssociationsMap::iterator, bool> result = sharedAssociations.insert(SharedAssociationsMap::value_type(graph, SharedAssociations()));
+    if(result.second)
+    {
+        ++associationsFilter[graph % GRAPH_FILTER_SIZE];
+    }
+    return result.first->second;
+}
+
+const GraphElementId* resolveId(const GraphElementMap& elementMap, GraphId graph)
+{
+    while(true)
+    {
+        GraphElementMap::const_iterator cit = elementMap.find(graph);
+        if(cit != elementMap.end())
+        {
+            return cit->second == REMOVED_ELEMENT_ID ? NULL : &cit->second;
+        }
+
+        SharedAssociationsMap::const_iterator sit = sharedAssociations.find(graph);
+        if(sit == sharedAssociations.end() || !sit->second.hasBaseGraph)
+        {
+            return NULL;
+        }
+        graph = sit->second.baseGraph;
+    }
+}
+
+/// Remove the entry of a graph once it is neither alive nor used by sharing graphs
+void eraseUnusedAssociations(GraphId graph)
+{
+    SharedAssociationsMap::iterator it = sharedAssociations.find(graph);
+    if(it == sharedAssociations.end() || !it->second.sharingGraphs.empty()
+            || (it->second.alive && it->second.hasBaseGraph))
+    {
+        return;
+    }
+
+    bool hasBaseGraph = it->second.hasBaseGraph;
+    GraphId baseGraph = it->second.baseGraph;
+    sharedAssociations.erase(it);
+    --associationsFilter[graph % GRAPH_FILTER_SIZE];
+    if(hasBaseGraph)
+    {
+        --baseGraphFilter[graph % GRAPH_FILTER_SIZE];
+        std::vector<GraphId>& sharingGraphs = getSharedAssociations(baseGraph).sharingGraphs;
+        sharingGraphs.erase(std::remove(sharingGraphs.begin(), sharingGraphs.end(), graph), sharingGraphs.end());
+        eraseUnusedAssociations(baseGraph);
+    }
+}
+
+/// Number of label changes of elements which are part of a graph
+std::atomic<uint64_t> labelRevision(0);
+
+/// Interned class names by class
+std::mutex classSymbolsMutex;
+typedef boost::unordered_map<std::type_index, Symbol, std::hash<std::type_index> > ClassSymbolMap;
+ClassSymbolMap classSymbols;
+
+} // end anonymous namespace
+
 boost::uuids::random_generator GraphElement::msUuidGenerator;
 std::map<GraphElementUuid, function<GraphElement::Ptr()> > GraphElement::msGraphElements;
 
 GraphElement::GraphElement(const std::string& label)
-    : mUuid(msUuidGenerator())
-    , mLabel(label)
+    : mLabel(SymbolTable::intern(label))
 {
+    std::lock_guard<std::mutex> lock(elementRegistryMutex);
+    mUuid = msUuidGenerator();
     msGraphElements[mUuid] = bind(&GraphElement::getSharedFromThis,this);
 }
 
 GraphElement::~GraphElement()
 {
+    std::lock_guard<std::mutex> lock(elementRegistryMutex);
     msGraphElements.erase(mUuid);
 }
 
+void GraphElement::setLabel(const std::string& label)
+{
+    Symbol symbol = SymbolTable::intern(label);
+    if(symbol != mLabel && !mGraphElementMap.empty())
+    {
+        ++labelRevision;
+    }
+    mLabel = symbol;
+}
+
+uint64_t GraphElement::getLabelRevision()
+{
+    return labelRevision.load();
+}
+
+Symbol GraphElement::getClassSymbol() const
+{
+    std::type_index type(typeid(*this));
+    {
+        std::lock_guard<std::mutex> lock(classSymbolsMutex);
+        ClassSymbolMap::const_iterator cit = classSymbols.find(type);
+        if(cit != classSymbols.end())
+        {
+            return cit->second;
+        }
+    }
+
+    Symbol symbol = SymbolTable::intern(getClassName());
+    std::lock_guard<std::mutex> lock(classSymbolsMutex);
+    classSymbols[type] = symbol;
+    return symbol;
+}
+
+void GraphElement::associate(GraphId graph, GraphElementId elementId)
+{
+    if(mayContain(associationsFilter, graph))
+    {
+        detachSharedAssociations(graph);
+    }
+    mGraphElementMap[graph] = elementId;
+}
+
+void GraphElement::disassociate(GraphId graph)
+{
+    if(mayContain(associationsFilter, graph) && detachSharedAssociations(graph))
+    {
+        // Hide the association of the base graph
+        mGraphElementMap[graph] = REMOVED_ELEMENT_ID;
+        return;
+    }
+    mGraphElementMap.erase(graph);
+}
+
 /**
  * Get id of this element within a given graph
  */
 GraphElementId GraphElement::getId(GraphId graphId) const
 {
-    GraphElementMap::const_iterator cit = mGraphElementMap.find(graphId);
-    if( cit != mGraphElementMap.end())
+    const GraphElementId* id = findId(graphId);
+    if(id)
     {
-        return cit->second;
+        return *id;
     }
 
     std::stringstream ss;
@@ -35,9 +203,79 @@ GraphElementId GraphElement::getId(GraphId graphId) const
     throw std::runtime_error(ss.str());
 }
 
+const GraphElementId* GraphElement::findId(GraphId graph) const
+{
+    GraphElementMap::const_iterator cit = mGraphElementMap.find(graph);
+    if(cit != mGraphElementMap.end())
+    {
+        return cit->second == REMOVED_ELEMENT_ID ? NULL : &cit->second;
+    }
+    if(!mayContain(baseGraphFilter, graph))
+    {
+        return NULL;
+    }
+
+    std::lock_guard<std::mutex> lock(sharedAssociationsMutex);
+    return resolveId(mGraphElementMap, graph);
+}
+
+bool GraphElement::detachSharedAssociations(GraphId graph)
+{
+    std::lock_guard<std::mutex> lock(sharedAssociationsMutex);
+    SharedAssociationsMap::const_iterator sit = sharedAssociations.find(graph);
+    if(sit == sharedAssociations.end())
+    {
+        return false;
+    }
+
+    const std::vector<GraphId>& sharingGraphs = sit->second.sharingGraphs;
+    if(!sharingGraphs.empty())
+    {
+        const GraphElementId* id = resolveId(mGraphElementMap, graph);
+        GraphElementId currentId = id ? *id : REMOVED_ELEMENT_ID;
+        std::vector<GraphId>::const_iterator cit = sharingGraphs.begin();
+        for(; cit != sharingGraphs.end(); ++cit)
+        {
+            // Keep an existing association of the sharing graph
+            mGraphElementMap.insert(GraphElementMap::value_type(*cit, currentId));
+        }
+    }
+    return sit->second.hasBaseGraph;
+}
+
+void GraphElement::shareAssociations(GraphId graph, GraphId baseGraph)
+{
+    std::lock_guard<std::mutex> lock(sharedAssociationsMutex);
+    SharedAssociations& shared = getSharedAssociations(graph);
+    if(shared.hasBaseGraph || !shared.sharingGraphs.empty())
+    {
+        throw std::invalid_argument("graph_analysis::GraphElement::shareAssociations: graph already shares associations");
+    }
+    shared.baseGraph = baseGraph;
+    shared.hasBaseGraph = true;
+    ++baseGraphFilter[graph % GRAPH_FILTER_SIZE];
+    getSharedAssociations(baseGraph).sharingGraphs.push_back(graph);
+}
+
+void GraphElement::releaseAssociations(GraphId graph)
+{
+    if(!mayContain(associationsFilter, graph))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(sharedAssociationsMutex);
+    SharedAssociationsMap::iterator it = sharedAssociations.find(graph);
+    if(it != sharedAssociations.end())
+    {
+        it->second.alive = false;
+        eraseUnusedAssociations(graph);
+    }
+}
 
 GraphElement::Ptr GraphElement::fromUuid(const GraphElementUuid& uuid)
 {
+    std::lock_guard<std::mutex> lock(elementRegistryMutex);
     std::map<GraphElementUuid, function<GraphElement::Ptr()> >::iterator it = msGraphElements.find(uuid);
     if(it != msGraphElements.end())
     {
@@ -56,7 +294,10 @@ GraphIdList GraphElement::getGraphAssociations() const
     GraphElementMap::const_iterator cit = mGraphElementMap.begin();
     for(; cit != mGraphElementMap.end(); ++cit)
     {
-        graphList.push_back(cit->first);
+        if(cit->second != REMOVED_ELEMENT_ID)
+        {
+            graphList.push_back(cit->first);
+        }
     }
 
     return graphList;
@@ -71,4 +312,34 @@ std::string GraphElement::toPrefixedString(GraphId graph) const
     return ss.str();
 }
 
+void GraphElement::addPendingAttribute(attribute_restore_func_t restoreFunction, const std::string& data)
+{
+    if(!mPendingAttributes)
+    {
+        mPendingAttributes = shared_ptr<PendingAttributes>(new PendingAttributes());
+    } else if(!mPendingAttributes.unique())
+    {
+        mPendingAttributes = shared_ptr<PendingAttributes>(new PendingAttributes(*mPendingAttributes));
+    }
+
+    PendingAttribute attribute;
+    attribute.restoreFunction = restoreFunction;
+    attribute.data = data;
+    mPendingAttributes->push_back(attribute);
+}
+
+void GraphElement::restorePendingAttributes() const
+{
+    // Reset first, since the restore functions usually access attributes
+    shared_ptr<PendingAttributes> pendingAttributes;
+    pendingAttributes.swap(mPendingAttributes);
+
+    GraphElement* element = const_cast<GraphElement*>(this);
+    PendingAttributes::const_iterator cit = pendingAttributes->begin();
+    for(; cit != pendingAttributes->end(); ++cit)
+    {
+        (element->*cit->restoreFunction)(cit->data);
+    }
+}
+
 }
@@ -8,6 +8,7 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include "SharedPtr.hpp"
+#include "SymbolTable.hpp"
 
 namespace graph_analysis {
 
@@ -42,17 +43,36 @@ public:
     /**
      * Set a label
      */
-    virtual void setLabel(const std::string& label) { mLabel = label; }
+    virtual void setLabel(const std::string& label);
 
     /**
      * Get label
      */
-    virtual const std::string& getLabel() const { return mLabel; }
+    virtual const std::string& getLabel() const { return SymbolTable::resolve(mLabel); }
+
+    /**
+     * Get the interned label, see SymbolTable
+     */
+    Symbol getLabelSymbol() const { return mLabel; }
+
+    /**
+     * Get the number of label changes of elements which are part of a graph
+     * \details Allows graphs to detect that their index of labels is
+     * outdated, see BaseGraph::findVerticesByLabel
+     */
+    static uint64_t getLabelRevision();
 
     // Get class name
     // \return class name
     virtual std::string getClassName() const { return "graph_analysis::GraphElement"; }
 
+    /**
+     * Get the interned class name, see SymbolTable
+     * \details The class name is interned once per class, so that comparing
+     * classes by name does not require to create and compare strings
+     */
+    Symbol getClassSymbol() const;
+
     /**
      * Convert element to string and adding and indentation (in spaces) to the
      * string
@@ -68,24 +88,42 @@ public:
      * Test whether this element has been associated with
      * an edge or node
      */
-    bool associated(GraphId graph) const { return mGraphElementMap.count(graph); }
+    bool associated(GraphId graph) const { return findId(graph) != NULL; }
 
     /**
      * Add the element to a corresponding graph
      * This allows reverse mapping from the element to the graphs it belongs to
      */
-    void associate(GraphId graph, GraphElementId elementId) { mGraphElementMap[graph] = elementId; }
+    void associate(GraphId graph, GraphElementId elementId);
 
     /**
      * Remove the edge that corresponds to a given graph
      */
-    void disassociate(GraphId graph) { mGraphElementMap.erase(graph); }
+    void disassociate(GraphId graph);
 
     /**
      * Get id of this element within a given graph
      */
     GraphElementId getId(GraphId graph) const;
 
+    /**
+     * Let a graph share the associations of all elements with another
+     * graph, i.e. an element which is part of the base graph is also
+     * part of the graph with the same id
+     * \details This allows to copy a graph without associating every
+     * element with the copy (see BaseGraph::copy), the structure of the copy
+     * must use the same element ids as the base graph. Both graphs
+     * can be modified independently afterwards: an association is copied on
+     * write, i.e. only when an element is added to or removed from either
+     * graph
+     */
+    static void shareAssociations(GraphId graph, GraphId baseGraph);
+
+    /**
+     * Release the shared associations of a graph, which is being destroyed
+     */
+    static void releaseAssociations(GraphId graph);
+
     /**
      * Get a universally unique id of this GraphElement
      * \deprecated use getUuid instead
@@ -106,6 +144,8 @@ public:
 
     /**
      * Get list of graph associations this element has
+     * \details Graphs which only share the associations of another graph
+     * are not included
      */
     GraphIdList getGraphAssociations() const;
 
@@ -114,6 +154,37 @@ public:
      */
     std::string toPrefixedString(GraphId graph) const;
 
+    /// Function to deserialize an attribute, see io::AttributeSerializationCallbacks
+    typedef void (GraphElement::*attribute_restore_func_t)(const std::string&);
+
+    /**
+     * Keep serialized attribute data, which will be deserialized with the
+     * given function once restoreAttributes is called
+     * \details This allows readers to skip deserializing attributes which
+     * are never accessed, see io::AttributeSerializationCallbacks::lazy
+     */
+    void addPendingAttribute(attribute_restore_func_t restoreFunction, const std::string& data);
+
+    /**
+     * Test whether attributes have been loaded, but not yet been deserialized
+     */
+    bool hasPendingAttributes() const { return mPendingAttributes.get() != NULL; }
+
+    /**
+     * Deserialize all pending attributes
+     * \details Element types, which register their attributes as lazy, have
+     * to call this function before accessing their attribute members. The
+     * first access is not thread-safe, i.e. call this function before
+     * sharing the element between threads
+     */
+    void restoreAttributes() const
+    {
+        if(mPendingAttributes)
+        {
+            restorePendingAttributes();
+        }
+    }
+
 protected:
     /**
      * Add local method to shared from this to allow using bind
@@ -127,7 +198,30 @@ protected:
     GraphElementUuid mUuid;
     static boost::uuids::random_generator msUuidGenerator;
     static std::map<GraphElementUuid, function<GraphElement::Ptr()> > msGraphElements;
-    std::string mLabel;
+
+private:
+    /// Interned label -- subclasses use getLabel/getLabelSymbol and setLabel
+    Symbol mLabel;
+
+    /// Get the id within the given graph, or NULL if the element is not
+    /// associated with the graph
+    const GraphElementId* findId(GraphId graph) const;
+    /// Copy the current association with the given graph to all graphs
+    /// sharing its associations, before the association is changed
+    /// \return true if the graph itself shares the associations of a base graph
+    bool detachSharedAssociations(GraphId graph);
+
+    struct PendingAttribute
+    {
+        attribute_restore_func_t restoreFunction;
+        std::string data;
+    };
+    typedef std::vector<PendingAttribute> PendingAttributes;
+
+    void restorePendingAttributes() const;
+
+    /// Serialized attributes, shared between copies of this element
+    mutable shared_ptr<PendingAttributes> mPendingAttributes;
 };
 
 } // end namespace graph_analysis
@@ -1,7 +1,14 @@
 #include "GraphIO.hpp"
+#include <fstream>
 #include <sstream>
 #include <boost/regex.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/version.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#if BOOST_VERSION >= 106700
+#include <boost/iostreams/filter/zstd.hpp>
+#endif
 #include "MapInitializer.hpp"
 
 #include "io/GexfWriter.hpp"
@@ -9,6 +16,12 @@
 #include "io/YamlWriter.hpp"
 #include "io/YamlReader.hpp"
 #include "io/GraphvizWriter.hpp"
+#include "io/BinaryWriter.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/EdgeListReader.hpp"
+#include "io/LemonReader.hpp"
+#include "io/MatrixMarketReader.hpp"
+#include "io/JournalObserver.hpp"
 
 #include <base-logging/Logging.hpp>
 
@@ -21,6 +34,9 @@ std::map<Type, std::string> TypeTxt = InitMap<Type, std::string>
     (LEMON, "LEMON")
     (GRAPHVIZ, "GRAPHVIZ")
     (YAML, "YAML")
+    (BINARY, "BINARY")
+    (EDGE_LIST, "EDGE_LIST")
+    (MATRIX_MARKET, "MATRIX_MARKET")
     ;
 // TODO3: "typemanager"
 // -kanten checken: is ein drag-drop event, der false zurückgeben kann
@@ -49,16 +65,39 @@ void Reader::read(const std::string& filename, BaseGraph& graph)
     read(filename, graphPtr);
 }
 
+void Reader::readAll(std::istream& stream, std::vector<char>& buffer)
+{
+    size_t chunkSize = 1 << 16;
+    while(stream)
+    {
+        size_t offset = buffer.size();
+        buffer.resize(offset + chunkSize);
+        stream.read(buffer.data() + offset, chunkSize);
+        buffer.resize(offset + stream.gcount());
+        chunkSize = std::min(chunkSize*2, static_cast<size_t>(1 << 26));
+    }
+
+    if(stream.bad())
+    {
+        throw std::runtime_error("graph_analysis::io::Reader::readAll: failed to read from stream");
+    }
+}
+
 
 GraphIO::WriterMap GraphIO::msWriters = InitMap<representation::Type, Writer::Ptr>
     (representation::GEXF, Writer::Ptr( new GexfWriter()))
     (representation::GRAPHVIZ, Writer::Ptr( new GraphvizWriter()))
     (representation::YAML, Writer::Ptr(new YamlWriter()))
+    (representation::BINARY, Writer::Ptr(new BinaryWriter()))
     ;
 
 GraphIO::ReaderMap GraphIO::msReaders = InitMap<representation::Type, Reader::Ptr>
     (representation::GEXF, Reader::Ptr( new GexfReader()))
     (representation::YAML, Reader::Ptr( new YamlReader()))
+    (representation::LEMON, Reader::Ptr( new LemonReader()))
+    (representation::BINARY, Reader::Ptr( new BinaryReader()))
+    (representation::EDGE_LIST, Reader::Ptr( new EdgeListReader()))
+    (representation::MATRIX_MARKET, Reader::Ptr( new MatrixMarketReader()))
     ;
 
 std::map<representation::Suffix, representation::Type> GraphIO::msSuffixes = InitMap<representation::Suffix, representation::Type>
@@ -69,8 +108,68 @@ std::map<representation::Suffix, representation::Type> GraphIO::msSuffixes = Ini
     ("xml", representation::GEXF)
     ("lemon", representation::LEMON)
     ("dot", representation::GRAPHVIZ)
+    ("gbin", representation::BINARY)
+    ("edges", representation::EDGE_LIST)
+    ("mtx", representation::MATRIX_MARKET)
+    ;
+
+std::map<representation::Suffix, representation::Compression> GraphIO::msCompressionSuffixes = InitMap<representation::Suffix, representation::Compression>
+    ("gz", representation::GZIP)
+    ("zst", representation::ZSTD)
     ;
 
+namespace {
+
+#if BOOST_VERSION < 106700
+void throwUnsupportedCompression(representation::Compression compression)
+{
+    std::stringstream ss;
+    ss << "graph_analysis::GraphIO: unsupported compression " << compression
+        << " -- zstd requires boost iostreams 1.67 or later";
+    throw std::runtime_error(ss.str());
+}
+#endif
+
+void pushCompressor(boost::iostreams::filtering_ostream& stream, representation::Compression compression)
+{
+    switch(compression)
+    {
+        case representation::GZIP:
+            stream.push(boost::iostreams::gzip_compressor());
+            break;
+        case representation::ZSTD:
+#if BOOST_VERSION >= 106700
+            stream.push(boost::iostreams::zstd_compressor());
+#else
+            throwUnsupportedCompression(compression);
+#endif
+            break;
+        default:
+            break;
+    }
+}
+
+void pushDecompressor(boost::iostreams::filtering_istream& stream, representation::Compression compression)
+{
+    switch(compression)
+    {
+        case representation::GZIP:
+            stream.push(boost::iostreams::gzip_decompressor());
+            break;
+        case representation::ZSTD:
+#if BOOST_VERSION >= 106700
+            stream.push(boost::iostreams::zstd_decompressor());
+#else
+            throwUnsupportedCompression(compression);
+#endif
+            break;
+        default:
+            break;
+    }
+}
+
+} // end anonymous namespace
+
 
 void GraphIO::write(const std::string& filename, const BaseGraph& graph, representation::Type format)
 {
@@ -80,9 +179,12 @@ void GraphIO::write(const std::string& filename, const BaseGraph& graph, represe
                 " trying to write empty graph to '" + filename + "'");
     }
 
+    representation::Compression compression = getCompressionFromFilename(filename);
+    std::string uncompressedFilename = removeCompressionSuffix(filename);
+
     if(format == representation::UNKNOWN)
     {
-        format = getTypeFromFilename(filename);
+        format = getTypeFromFilename(uncompressedFilename);
         if(format == representation::UNKNOWN)
         {
             throw std::invalid_argument("graph_analysis::GraphIO::write: "
@@ -93,10 +195,35 @@ void GraphIO::write(const std::string& filename, const BaseGraph& graph, represe
     WriterMap::const_iterator cit = msWriters.find(format);
     if(cit != msWriters.end())
     {
-        std::string filenameWithSuffix = GraphIO::appendSuffix(filename, format);
+        std::string filenameWithSuffix = GraphIO::appendSuffix(uncompressedFilename, format);
 
         Writer::Ptr writer = cit->second;
-        writer->write(filenameWithSuffix, graph);
+        if(compression == representation::NO_COMPRESSION)
+        {
+            writer->write(filenameWithSuffix, graph);
+            return;
+        }
+
+        // Stream through the compressor, the compression suffix is kept
+        filenameWithSuffix += filename.substr(uncompressedFilename.size());
+        std::ofstream file(filenameWithSuffix.c_str(), std::ios::out | std::ios::binary);
+        if(!file.is_open())
+        {
+            throw std::runtime_error("graph_analysis::GraphIO::write: failed to open '" + filenameWithSuffix + "' for writing");
+        }
+
+        boost::iostreams::filtering_ostream stream;
+        pushCompressor(stream, compression);
+        stream.push(file);
+        writer->write(stream, graph);
+        // flush and finalize the compressed data
+        stream.reset();
+
+        file.close();
+        if(file.fail())
+        {
+            throw std::runtime_error("graph_analysis::GraphIO::write: failed to write '" + filenameWithSuffix + "'");
+        }
     } else {
         std::stringstream ss;
         ss << "GraphIO: writing format ";
@@ -107,6 +234,16 @@ void GraphIO::write(const std::string& filename, const BaseGraph& graph, represe
     }
 }
 
+void GraphIO::write(std::ostream& stream, const BaseGraph& graph, representation::Type format)
+{
+    WriterMap::const_iterator cit = msWriters.find(format);
+    if(cit == msWriters.end())
+    {
+        throw std::runtime_error("graph_analysis::GraphIO::write: writing format '" + representation::TypeTxt[format] + "' is not supported");
+    }
+    cit->second->write(stream, graph);
+}
+
 void GraphIO::write(const std::string& filename, const BaseGraph::Ptr& graph, representation::Type format)
 {
     if(!graph)
@@ -125,6 +262,8 @@ void GraphIO::read(const std::string& filename, BaseGraph& graph, representation
         throw std::invalid_argument("graph_analysis::GraphIO::read: file '" + filename + "' does not exist");
     }
 
+    representation::Compression compression = getCompressionFromFilename(filename);
+
     if(format == representation::UNKNOWN)
     {
         format = getTypeFromFilename(filename);
@@ -139,7 +278,23 @@ void GraphIO::read(const std::string& filename, BaseGraph& graph, representation
     if(cit != msReaders.end())
     {
         Reader::Ptr reader = cit->second;
-        reader->read(filename, graph);
+        if(compression == representation::NO_COMPRESSION)
+        {
+            reader->read(filename, graph);
+            return;
+        }
+
+        // Stream through the decompressor
+        std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+        if(!file.is_open())
+        {
+            throw std::runtime_error("graph_analysis::GraphIO::read: failed to open '" + filename + "' for reading");
+        }
+
+        boost::iostreams::filtering_istream stream;
+        pushDecompressor(stream, compression);
+        stream.push(file);
+        reader->read(stream, BaseGraph::Ptr(&graph, null_deleter()));
     } else {
         std::stringstream ss;
         ss << "GraphIO: reading format ";
@@ -150,11 +305,30 @@ void GraphIO::read(const std::string& filename, BaseGraph& graph, representation
     }
 }
 
+void GraphIO::read(std::istream& stream, BaseGraph::Ptr graph, representation::Type format)
+{
+    ReaderMap::const_iterator cit = msReaders.find(format);
+    if(cit == msReaders.end())
+    {
+        throw std::runtime_error("graph_analysis::GraphIO::read: reading format '" + representation::TypeTxt[format] + "' is not supported");
+    }
+    cit->second->read(stream, graph);
+}
+
 void GraphIO::read(const std::string& filename, BaseGraph::Ptr graph, representation::Type format)
 {
     read(filename, *graph.get(), format);
 }
 
+void GraphIO::replay(const std::string& journalFilename, BaseGraph::Ptr graph)
+{
+    if(!boost::filesystem::exists(journalFilename))
+    {
+        throw std::invalid_argument("graph_analysis::GraphIO::replay: file '" + journalFilename + "' does not exist");
+    }
+    JournalObserver::replay(journalFilename, graph);
+}
+
 representation::Type GraphIO::getTypeFromSuffix(representation::Suffix suffix)
 {
     SuffixMap::const_iterator cit = msSuffixes.find(suffix);
@@ -170,8 +344,10 @@ representation::Type GraphIO::getTypeFromFilename(const std::string& filename)
 {
     boost::regex expression(".*\\.([a-z]+$)");
 
+    // the format is given by the suffix before a compression suffix
+    std::string uncompressedFilename = removeCompressionSuffix(filename);
     boost::cmatch what;
-    if(boost::regex_match(filename.c_str(), what, expression))
+    if(boost::regex_match(uncompressedFilename.c_str(), what, expression))
     {
         std::string suffix(what[1].first, what[1].second);
         LOG_DEBUG_S << "Found suffix of filename '" << filename << "' : " << suffix;
@@ -217,5 +393,28 @@ representation::Suffix GraphIO::getSuffix(representation::Type format)
             " could not retrieve suffix for format '" + representation::TypeTxt[format] + "'");
 }
 
+representation::Compression GraphIO::getCompressionFromFilename(const std::string& filename)
+{
+    size_t position = filename.find_last_of('.');
+    if(position != std::string::npos)
+    {
+        std::map<representation::Suffix, representation::Compression>::const_iterator cit = msCompressionSuffixes.find(filename.substr(position + 1));
+        if(cit != msCompressionSuffixes.end())
+        {
+            return cit->second;
+        }
+    }
+    return representation::NO_COMPRESSION;
+}
+
+std::string GraphIO::removeCompressionSuffix(const std::string& filename)
+{
+    if(getCompressionFromFilename(filename) == representation::NO_COMPRESSION)
+    {
+        return filename;
+    }
+    return filename.substr(0, filename.find_last_of('.'));
+}
+
 } // end namespace io
 } // end namespace graph_analysis
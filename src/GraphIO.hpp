@@ -1,6 +1,7 @@
 #ifndef GRAPH_ANALYSIS_IO_HPP
 #define GRAPH_ANALYSIS_IO_HPP
 
+#include <iostream>
 #include <stdexcept>
 #include "Graph.hpp"
 
@@ -8,7 +9,11 @@ namespace graph_analysis {
 
 namespace representation {
 
-enum Type { UNKNOWN = 0, GEXF, LEMON, YAML, GRAPHVIZ, OROGEN_MODEL, END_MARKER };
+enum Type { UNKNOWN = 0, GEXF, LEMON, YAML, GRAPHVIZ, OROGEN_MODEL, BINARY, EDGE_LIST, MATRIX_MARKET, END_MARKER };
+
+/// Compression of a file, which is identified by an additional suffix,
+/// e.g. graph.gexf.gz
+enum Compression { NO_COMPRESSION = 0, GZIP, ZSTD };
 
 typedef std::string Suffix;
 
@@ -46,6 +51,12 @@ public:
      * writing capability
      */
     virtual void write(const std::string& filename, const BaseGraph::Ptr& graph) const { (void)filename; (void)graph; throw std::runtime_error("Writer: writer not implemented"); }
+
+    /**
+     * Subclasses have to implement this function in order to provide
+     * writing to a stream, e.g. to write compressed files
+     */
+    virtual void write(std::ostream& stream, const BaseGraph& graph) const { (void)stream; (void)graph; throw std::runtime_error("Writer: writing to a stream is not implemented"); }
 };
 
 /**
@@ -63,6 +74,18 @@ public:
     void read(const std::string& filename, BaseGraph& graph);
 
     virtual void read(const std::string& filename, BaseGraph::Ptr graph) { (void) filename; (void) graph; throw std::runtime_error("Reader: reader not implemented"); }
+
+    /**
+     * Subclasses have to implement this function in order to provide
+     * reading from a stream, e.g. to read compressed files
+     */
+    virtual void read(std::istream& stream, BaseGraph::Ptr graph) { (void) stream; (void) graph; throw std::runtime_error("Reader: reading from a stream is not implemented"); }
+
+protected:
+    /**
+     * Read the remaining content of a stream into a buffer
+     */
+    static void readAll(std::istream& stream, std::vector<char>& buffer);
 };
 
 /**
@@ -82,6 +105,13 @@ public:
  io::GraphIO::write("test-file.dot", graph);
  \endverbatim
  *
+ * Files with an additional suffix '.gz' or '.zst' are compressed/decompressed
+ * while being written/read (zstd requires boost >= 1.67, otherwise a
+ * std::runtime_error is thrown), e.g.
+ \verbatim
+ io::GraphIO::write("test-file.gexf.gz", graph);
+ io::GraphIO::read("test-file.gexf.gz", graph);
+ \endverbatim
  *
  * In order to allow custom vertices and edges to be serialized and deserialized
  * you need to properly overload the getClassName and getClone methods (as you
@@ -129,11 +159,13 @@ public:
  * Eventually, the reader has to support/take care of proper edge construction and vertex
  * construction, e.g., in GexfReader
  \verbatim
-    libgexf::t_id current = edge_it->next();
-    std::string edgeClass = data.getEdgeAttribute(current, classAttr);
-    std::string edgeLabel = data.getEdgeAttribute(current, labelAttr);
-    Vertex::Ptr sourceVertex = vertexMap[edge_it->currentSource()]; // NOTE: assumes the .gexf(.xml) file is valid
-    Vertex::Ptr targetVertex = vertexMap[edge_it->currentTarget()]; // NOTE: assumes the .gexf(.xml) file is valid
+    // attribute values of the current <edge> element collected by the
+    // xmlTextReader, source and target ids are resolved via the vertex ids
+    // that have been read before
+    const std::string& edgeClass = attValues[edgeClassAttr];
+    const std::string& edgeLabel = attValues[edgeLabelAttr];
+    Vertex::Ptr sourceVertex = vertexMap[sourceId]; // NOTE: assumes the .gexf(.xml) file is valid
+    Vertex::Ptr targetVertex = vertexMap[targetId]; // NOTE: assumes the .gexf(.xml) file is valid
     Edge::Ptr edge = EdgeTypeManager::getInstance()->createEdge(edgeClass, sourceVertex, targetVertex, edgeLabel);
     graph->addEdge(edge);
  \endverbatim
@@ -240,6 +272,24 @@ public:
     static void read(const std::string& filename, BaseGraph::Ptr graph, representation::Type format = representation::UNKNOWN);
     static void read(const std::string& filename, BaseGraph& graph, representation::Type format = representation::UNKNOWN);
 
+    /**
+     * Write the graph in the given format to a stream
+     */
+    static void write(std::ostream& stream, const BaseGraph& graph, representation::Type format);
+
+    /**
+     * Read the graph in the given format from a stream
+     */
+    static void read(std::istream& stream, BaseGraph::Ptr graph, representation::Type format);
+
+    /**
+     * Restore a graph from the snapshot and the mutation records of a
+     * journal, which has been written by a JournalObserver -- the content of
+     * the graph is replaced
+     * \see JournalObserver
+     */
+    static void replay(const std::string& journalFilename, BaseGraph::Ptr graph);
+
     static WriterMap getWriterMap() { return msWriters; }
     static ReaderMap getReaderMap() { return msReaders; }
     static SuffixMap getSuffixMap() { return msSuffixes; }
@@ -249,10 +299,23 @@ public:
     static std::string appendSuffix(const std::string& filename, representation::Type format);
     static representation::Suffix getSuffix(representation::Type format);
 
+    /**
+     * Get the compression from the (last) suffix of a filename
+     * \return NO_COMPRESSION if the filename has no compression suffix
+     */
+    static representation::Compression getCompressionFromFilename(const std::string& filename);
+
+    /**
+     * Remove the compression suffix from a filename, e.g. to infer the format
+     * of the compressed data
+     */
+    static std::string removeCompressionSuffix(const std::string& filename);
+
 private:
     static WriterMap msWriters;
     static ReaderMap msReaders;
     static SuffixMap msSuffixes;
+    static std::map<representation::Suffix, representation::Compression> msCompressionSuffixes;
 };
 
 } // end namespace io
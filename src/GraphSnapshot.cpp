@@ -0,0 +1,116 @@
+#include "GraphSnapshot.hpp"
+#include <algorithm>
+
+namespace graph_analysis {
+
+const size_t GraphSnapshot::npos = static_cast<size_t>(-1);
+
+GraphSnapshot::GraphSnapshot()
+    : mGraphId(0)
+    , mVersion(0)
+{}
+
+GraphSnapshot::ConstPtr GraphSnapshot::create(const BaseGraph& graph)
+{
+    shared_ptr<GraphSnapshot> snapshot(new GraphSnapshot());
+    snapshot->mGraphId = graph.getId();
+    snapshot->mVersion = graph.version();
+
+    // Vertices in iteration order
+    VertexIterator::Ptr vertexIt = graph.getVertexIterator();
+    while(vertexIt->next())
+    {
+        const Vertex::Ptr& vertex = vertexIt->current();
+        GraphElementId id = graph.getVertexId(vertex);
+        if(id >= snapshot->mVertexIndices.size())
+        {
+            snapshot->mVertexIndices.resize(id + 1, npos);
+        }
+        snapshot->mVertexIndices[id] = snapshot->mVertices.size();
+        snapshot->mVertices.push_back(vertex);
+        snapshot->mVertexIds.push_back(id);
+    }
+
+    // Collect the edges with the indices of their source and target
+    std::vector<Edge::Ptr> edges;
+    std::vector<size_t> sources;
+    std::vector<size_t> targets;
+    EdgeIterator::Ptr edgeIt = graph.getEdgeIterator();
+    while(edgeIt->next())
+    {
+        const Edge::Ptr& edge = edgeIt->current();
+        edges.push_back(edge);
+        sources.push_back(snapshot->mVertexIndices[ graph.getVertexId(edge->getSourceVertex()) ]);
+        targets.push_back(snapshot->mVertexIndices[ graph.getVertexId(edge->getTargetVertex()) ]);
+    }
+
+    // Counting sort of the edges by target index and then (stable) by source
+    // index, so that the out-edges of each vertex are sorted by target
+    size_t numberOfVertices = snapshot->mVertices.size();
+    size_t numberOfEdges = edges.size();
+    std::vector<size_t>& outOffsets = snapshot->mOutOffsets;
+    std::vector<size_t>& inOffsets = snapshot->mInOffsets;
+    outOffsets.assign(numberOfVertices + 1, 0);
+    inOffsets.assign(numberOfVertices + 1, 0);
+    for(size_t i = 0; i < numberOfEdges; ++i)
+    {
+        ++outOffsets[sources[i] + 1];
+        ++inOffsets[targets[i] + 1];
+    }
+    for(size_t v = 0; v < numberOfVertices; ++v)
+    {
+        outOffsets[v + 1] += outOffsets[v];
+        inOffsets[v + 1] += inOffsets[v];
+    }
+
+    snapshot->mEdges.resize(numberOfEdges);
+    snapshot->mEdgeIds.resize(numberOfEdges);
+    snapshot->mSources.resize(numberOfEdges);
+    snapshot->mTargets.resize(numberOfEdges);
+    snapshot->mInEdges.resize(numberOfEdges);
+
+    std::vector<size_t> inPosition(inOffsets.begin(), inOffsets.end() - 1);
+    std::vector<size_t> byTarget(numberOfEdges);
+    for(size_t i = 0; i < numberOfEdges; ++i)
+    {
+        byTarget[ inPosition[ targets[i] ]++ ] = i;
+    }
+
+    std::vector<size_t> outPosition(outOffsets.begin(), outOffsets.end() - 1);
+    inPosition.assign(inOffsets.begin(), inOffsets.end() - 1);
+    for(size_t k = 0; k < numberOfEdges; ++k)
+    {
+        size_t i = byTarget[k];
+        size_t edgeIndex = outPosition[ sources[i] ]++;
+        GraphElementId id = graph.getEdgeId(edges[i]);
+
+        snapshot->mEdges[edgeIndex] = edges[i];
+        snapshot->mEdgeIds[edgeIndex] = id;
+        snapshot->mSources[edgeIndex] = sources[i];
+        snapshot->mTargets[edgeIndex] = targets[i];
+        if(id >= snapshot->mEdgeIndices.size())
+        {
+            snapshot->mEdgeIndices.resize(id + 1, npos);
+        }
+        snapshot->mEdgeIndices[id] = edgeIndex;
+    }
+
+    // In-edges in order of the edge index
+    for(size_t edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex)
+    {
+        snapshot->mInEdges[ inPosition[ snapshot->mTargets[edgeIndex] ]++ ] = edgeIndex;
+    }
+
+    return snapshot;
+}
+
+GraphSnapshot::Range GraphSnapshot::getEdges(size_t sourceIndex, size_t targetIndex) const
+{
+    std::vector<size_t>::const_iterator begin = mTargets.begin() + mOutOffsets[sourceIndex];
+    std::vector<size_t>::const_iterator end = mTargets.begin() + mOutOffsets[sourceIndex + 1];
+    std::pair<std::vector<size_t>::const_iterator, std::vector<size_t>::const_iterator> range =
+        std::equal_range(begin, end, targetIndex);
+    return Range(range.first - mTargets.begin(), range.second - mTargets.begin());
+}
+
+} // end namespace graph_analysis
@@ -0,0 +1,147 @@
+#ifndef GRAPH_ANALYSIS_GRAPH_SNAPSHOT_HPP
+#define GRAPH_ANALYSIS_GRAPH_SNAPSHOT_HPP
+
+#include <vector>
+#include "BaseGraph.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file GraphSnapshot.hpp
+ * \class GraphSnapshot
+ * \brief Immutable view on the structure of a graph at a given version
+ * \details The snapshot stores the vertices and edges of a graph in compressed
+ * sparse row form: vertices and edges are addressed by a dense index, edges are
+ * sorted by the index of their source vertex, so that the out-edges of a vertex
+ * form a contiguous range. The out-edges of a vertex are sorted by the index
+ * of their target vertex, so that the edges between two vertices are found by
+ * binary search. The in-edges are available via a separate index list.
+ *
+ * A snapshot never refers to the graph it has been created from, i.e. it can
+ * be read by any number of threads while the graph is being modified. Only the
+ * structure is captured, attributes are read from the (shared) vertices and
+ * edges.
+ *
+ \verbatim
+    GraphSnapshot::ConstPtr snapshot = GraphSnapshot::create(*graph);
+    for(size_t v = 0; v < snapshot->getNumberOfVertices(); ++v)
+    {
+        GraphSnapshot::Range out = snapshot->getOutEdges(v);
+        for(size_t e = out.first; e < out.second; ++e)
+        {
+            const Vertex::Ptr& target = snapshot->getVertex( snapshot->getTargetIndex(e) );
+            ...
+        }
+    }
+ \endverbatim
+ */
+class GraphSnapshot
+{
+public:
+    typedef shared_ptr<const GraphSnapshot> ConstPtr;
+    /// Range of indices [first, second)
+    typedef std::pair<size_t, size_t> Range;
+    typedef std::vector<size_t>::const_iterator IndexIterator;
+    typedef std::pair<IndexIterator, IndexIterator> IndexRange;
+
+    /// Index of elements which are not part of the snapshot
+    static const size_t npos;
+
+    /**
+     * Create a snapshot of the current state of the given graph
+     * \details Has to be called from the thread which modifies the graph
+     */
+    static ConstPtr create(const BaseGraph& graph);
+
+    /**
+     * Get the version of the graph which this snapshot represents
+     */
+    uint64_t getVersion() const { return mVersion; }
+
+    /**
+     * Get the id of the graph this snapshot has been created from
+     */
+    GraphId getGraphId() const { return mGraphId; }
+
+    size_t getNumberOfVertices() const { return mVertices.size(); }
+    size_t getNumberOfEdges() const { return mEdges.size(); }
+
+    const Vertex::Ptr& getVertex(size_t vertexIndex) const { return mVertices[vertexIndex]; }
+    const Edge::Ptr& getEdge(size_t edgeIndex) const { return mEdges[edgeIndex]; }
+
+    const std::vector<Vertex::Ptr>& getVertices() const { return mVertices; }
+    const std::vector<Edge::Ptr>& getEdges() const { return mEdges; }
+
+    /**
+     * Get the element id of a vertex/edge in the graph
+     */
+    GraphElementId getVertexId(size_t vertexIndex) const { return mVertexIds[vertexIndex]; }
+    GraphElementId getEdgeId(size_t edgeIndex) const { return mEdgeIds[edgeIndex]; }
+
+    /**
+     * Get the index of the vertex/edge with the given element id
+     * \return index or npos if the element is not part of the snapshot
+     */
+    size_t getVertexIndex(GraphElementId id) const { return id < mVertexIndices.size() ? mVertexIndices[id] : npos; }
+    size_t getEdgeIndex(GraphElementId id) const { return id < mEdgeIndices.size() ? mEdgeIndices[id] : npos; }
+
+    size_t getSourceIndex(size_t edgeIndex) const { return mSources[edgeIndex]; }
+    size_t getTargetIndex(size_t edgeIndex) const { return mTargets[edgeIndex]; }
+
+    /**
+     * Get the range of edge indices of the out-edges of a vertex
+     */
+    Range getOutEdges(size_t vertexIndex) const { return Range(mOutOffsets[vertexIndex], mOutOffsets[vertexIndex + 1]); }
+
+    /**
+     * Get the edge indices of the in-edges of a vertex
+     */
+    IndexRange getInEdges(size_t vertexIndex) const
+    {
+        return IndexRange(mInEdges.begin() + mInOffsets[vertexIndex], mInEdges.begin() + mInOffsets[vertexIndex + 1]);
+    }
+
+    /**
+     * Get the range of edge indices of the edges from source to target
+     * \details O(log d) with d being the out degree of source
+     */
+    Range getEdges(size_t sourceIndex, size_t targetIndex) const;
+
+    /**
+     * Test whether there is an edge from source to target
+     */
+    bool hasEdge(size_t sourceIndex, size_t targetIndex) const
+    {
+        Range range = getEdges(sourceIndex, targetIndex);
+        return range.first != range.second;
+    }
+
+    size_t getOutDegree(size_t vertexIndex) const { return mOutOffsets[vertexIndex + 1] - mOutOffsets[vertexIndex]; }
+    size_t getInDegree(size_t vertexIndex) const { return mInOffsets[vertexIndex + 1] - mInOffsets[vertexIndex]; }
+
+private:
+    GraphSnapshot();
+
+    GraphId mGraphId;
+    uint64_t mVersion;
+
+    std::vector<Vertex::Ptr> mVertices;
+    std::vector<GraphElementId> mVertexIds;
+    std::vector<size_t> mVertexIndices;
+
+    /// Edges, sorted by source index and then by target index
+    std::vector<Edge::Ptr> mEdges;
+    std::vector<GraphElementId> mEdgeIds;
+    std::vector<size_t> mEdgeIndices;
+    std::vector<size_t> mSources;
+    std::vector<size_t> mTargets;
+
+    /// Out-edges of vertex i: [mOutOffsets[i], mOutOffsets[i+1])
+    std::vector<size_t> mOutOffsets;
+    /// In-edges of vertex i: mInEdges[mInOffsets[i] .. mInOffsets[i+1]-1]
+    std::vector<size_t> mInOffsets;
+    std::vector<size_t> mInEdges;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_GRAPH_SNAPSHOT_HPP
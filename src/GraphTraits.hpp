@@ -0,0 +1,264 @@
+#ifndef GRAPH_ANALYSIS_GRAPH_TRAITS_HPP
+#define GRAPH_ANALYSIS_GRAPH_TRAITS_HPP
+
+#include <stdexcept>
+#include <typeinfo>
+#include "BaseGraph.hpp"
+#include "boost_graph/DirectedGraph.hpp"
+#include "lemon/Graph.hpp"
+#include "snap/Graph.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file GraphTraits.hpp
+ * \class GraphTraits
+ * \brief Compile time traversal of a graph implementation
+ * \details The specializations for the graph implementations traverse the
+ * native graph structure directly, so that the compiler can inline the
+ * function which is called for each element -- in contrast to the virtual
+ * iterators of BaseGraph. Elements are passed as VertexHandle/EdgeHandle.
+ *
+ * The generic version uses the (virtual) handle based traversal of
+ * BaseGraph and works for any graph.
+ *
+ * Use dispatch to select the implementation once per algorithm call:
+ \verbatim
+    struct CountOutEdges
+    {
+        VertexHandle vertex;
+        size_t count;
+
+        template<typename Backend>
+        void operator()(const Backend& graph)
+        {
+            visitOutEdges(graph, vertex, [this](EdgeHandle) { ++count; });
+        }
+    };
+
+    CountOutEdges counter = { graph->getVertexHandle(vertex), 0 };
+    dispatch(*graph, counter);
+ \endverbatim
+ */
+template<typename Backend>
+struct GraphTraits
+{
+    typedef Backend graph_t;
+
+    template<typename F>
+    static void forEachVertex(const Backend& graph, F&& function)
+    {
+        VertexIterator::Ptr vertexIt = graph.getVertexIterator();
+        while(vertexIt->next())
+        {
+            function(graph.getVertexHandle(vertexIt->current()));
+        }
+    }
+
+    template<typename F>
+    static void visitOutEdges(const Backend& graph, VertexHandle vertex, F&& function)
+    {
+        graph.forEachOutEdge(vertex, function);
+    }
+
+    template<typename F>
+    static void visitInEdges(const Backend& graph, VertexHandle vertex, F&& function)
+    {
+        graph.forEachInEdge(vertex, function);
+    }
+
+    static VertexHandle source(const Backend& graph, EdgeHandle edge) { return graph.source(edge); }
+    static VertexHandle target(const Backend& graph, EdgeHandle edge) { return graph.target(edge); }
+};
+
+template<>
+struct GraphTraits<boost_graph::DirectedGraph>
+{
+    typedef boost_graph::DirectedGraph graph_t;
+
+    template<typename F>
+    static void forEachVertex(const graph_t& graph, F&& function)
+    {
+        boost_graph::VertexIteratorImpl it, end;
+        for(boost::tie(it, end) = boost::vertices(graph.raw()); it != end; ++it)
+        {
+            function(VertexHandle( graph.raw()[*it]->getId(graph.getId()) ));
+        }
+    }
+
+    template<typename F>
+    static void visitOutEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        boost::graph_traits<boost_graph::BidirectionalGraph>::out_edge_iterator it, end;
+        for(boost::tie(it, end) = boost::out_edges(graph.getVertexDescriptor(vertex), graph.raw()); it != end; ++it)
+        {
+            function(EdgeHandle( graph.raw()[*it]->getId(graph.getId()) ));
+        }
+    }
+
+    template<typename F>
+    static void visitInEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        boost::graph_traits<boost_graph::BidirectionalGraph>::in_edge_iterator it, end;
+        for(boost::tie(it, end) = boost::in_edges(graph.getVertexDescriptor(vertex), graph.raw()); it != end; ++it)
+        {
+            function(EdgeHandle( graph.raw()[*it]->getId(graph.getId()) ));
+        }
+    }
+
+    static VertexHandle source(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw()[ boost::source(graph.getEdgeDescriptor(edge), graph.raw()) ]->getId(graph.getId()) );
+    }
+
+    static VertexHandle target(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw()[ boost::target(graph.getEdgeDescriptor(edge), graph.raw()) ]->getId(graph.getId()) );
+    }
+};
+
+template<>
+struct GraphTraits<lemon::DirectedGraph>
+{
+    typedef lemon::DirectedGraph graph_t;
+
+    template<typename F>
+    static void forEachVertex(const graph_t& graph, F&& function)
+    {
+        for(graph_t::graph_t::NodeIt n(graph.raw()); n != ::lemon::INVALID; ++n)
+        {
+            function(VertexHandle( graph.raw().id(n) ));
+        }
+    }
+
+    template<typename F>
+    static void visitOutEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        for(graph_t::graph_t::OutArcIt a(graph.raw(), graph.raw().nodeFromId(vertex.id)); a != ::lemon::INVALID; ++a)
+        {
+            function(EdgeHandle( graph.raw().id(a) ));
+        }
+    }
+
+    template<typename F>
+    static void visitInEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        for(graph_t::graph_t::InArcIt a(graph.raw(), graph.raw().nodeFromId(vertex.id)); a != ::lemon::INVALID; ++a)
+        {
+            function(EdgeHandle( graph.raw().id(a) ));
+        }
+    }
+
+    static VertexHandle source(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw().id( graph.raw().source( graph.raw().arcFromId(edge.id))) );
+    }
+
+    static VertexHandle target(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw().id( graph.raw().target( graph.raw().arcFromId(edge.id))) );
+    }
+};
+
+template<>
+struct GraphTraits<snap::DirectedGraph>
+{
+    typedef snap::DirectedGraph graph_t;
+
+    template<typename F>
+    static void forEachVertex(const graph_t& graph, F&& function)
+    {
+        for(graph_t::graph_t::TNodeI n = graph.raw().BegNI(); n != graph.raw().EndNI(); n++)
+        {
+            function(VertexHandle( n.GetId() ));
+        }
+    }
+
+    template<typename F>
+    static void visitOutEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        graph_t::graph_t::TNodeI nodeIt = graph.raw().GetNI(vertex.id);
+        for(int i = 0; i < nodeIt.GetOutDeg(); ++i)
+        {
+            function(EdgeHandle( nodeIt.GetOutEId(i) ));
+        }
+    }
+
+    template<typename F>
+    static void visitInEdges(const graph_t& graph, VertexHandle vertex, F&& function)
+    {
+        graph_t::graph_t::TNodeI nodeIt = graph.raw().GetNI(vertex.id);
+        for(int i = 0; i < nodeIt.GetInDeg(); ++i)
+        {
+            function(EdgeHandle( nodeIt.GetInEId(i) ));
+        }
+    }
+
+    static VertexHandle source(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw().GetEI(edge.id).GetSrcNId() );
+    }
+
+    static VertexHandle target(const graph_t& graph, EdgeHandle edge)
+    {
+        return VertexHandle( graph.raw().GetEI(edge.id).GetDstNId() );
+    }
+};
+
+/**
+ * Call function(VertexHandle) for each vertex of the graph
+ */
+template<typename Backend, typename F>
+void forEachVertex(const Backend& graph, F&& function)
+{
+    GraphTraits<Backend>::forEachVertex(graph, function);
+}
+
+/**
+ * Call function(EdgeHandle) for each out edge of the vertex
+ */
+template<typename Backend, typename F>
+void visitOutEdges(const Backend& graph, VertexHandle vertex, F&& function)
+{
+    GraphTraits<Backend>::visitOutEdges(graph, vertex, function);
+}
+
+/**
+ * Call function(EdgeHandle) for each in edge of the vertex
+ */
+template<typename Backend, typename F>
+void visitInEdges(const Backend& graph, VertexHandle vertex, F&& function)
+{
+    GraphTraits<Backend>::visitInEdges(graph, vertex, function);
+}
+
+/**
+ * Call the function with the graph cast to its implementation type, i.e.
+ * with const boost_graph::DirectedGraph&, const lemon::DirectedGraph& or
+ * const snap::DirectedGraph&
+ * \details The implementation type is checked once, so the function should
+ * run the whole algorithm. It requires a templated call operator (or a
+ * generic lambda in C++14)
+ * \throw std::invalid_argument if the implementation type is unknown
+ */
+template<typename F>
+void dispatch(const BaseGraph& graph, F&& function)
+{
+    switch(graph.getImplementationType())
+    {
+        case BaseGraph::BOOST_DIRECTED_GRAPH:
+            function(dynamic_cast<const boost_graph::DirectedGraph&>(graph));
+            break;
+        case BaseGraph::LEMON_DIRECTED_GRAPH:
+            function(dynamic_cast<const lemon::DirectedGraph&>(graph));
+            break;
+        case BaseGraph::SNAP_DIRECTED_GRAPH:
+            function(dynamic_cast<const snap::DirectedGraph&>(graph));
+            break;
+        default:
+            throw std::invalid_argument("graph_analysis::dispatch: unknown implementation type of graph");
+    }
+}
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_GRAPH_TRAITS_HPP
@@ -28,9 +28,9 @@ std::string HyperEdge::toString() const
 std::string HyperEdge::toString(uint32_t indent) const
 {
     std::string hspace(indent,' ');
-    if(!mLabel.empty())
+    if(getLabelSymbol() != SymbolTable::EMPTY)
     {
-        return hspace + mLabel;
+        return hspace + SymbolTable::resolve(getLabelSymbol());
     }
     else
     {
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <boost/lexical_cast.hpp>
+#include <boost/filesystem.hpp>
+#include <base/Time.hpp>
+#include <numeric/Stats.hpp>
+
+#include "GraphIO.hpp"
+
+using namespace graph_analysis;
+
+/**
+ * Benchmark the import of graphs for the supported file formats
+ * and report the throughput in MB/s
+ */
+struct IOBenchmark
+{
+    IOBenchmark(const std::string& _label)
+        : label(_label)
+        , fileSize(0)
+    {}
+
+    std::string label;
+
+    int numberOfNodes;
+    int numberOfEdges;
+    uintmax_t fileSize;
+
+    numeric::Stats<double> writeStats;
+    numeric::Stats<double> readStats;
+    numeric::Stats<double> throughputStats;
+
+    std::string getReport() const
+    {
+        std::stringstream ss;
+        ss << "IOBenchmark: " << label << std::endl;
+        ss << "    number of nodes:    " << numberOfNodes << std::endl;
+        ss << "    number of edges:    " << numberOfEdges << std::endl;
+        ss << "    file size:          " << fileSize << " bytes" << std::endl;
+        ss << "    write:              " << writeStats.mean() << "+/-" << writeStats.stdev() << " s" << std::endl;
+        ss << "    read:               " << readStats.mean() << "+/-" << readStats.stdev() << " s" << std::endl;
+        ss << "    read throughput:    " << throughputStats.mean() << "+/-" << throughputStats.stdev() << " MB/s" << std::endl;
+        return ss.str();
+    }
+
+    void save(const std::string& logDir)
+    {
+        std::ios_base::openmode mode = std::ofstream::out | std::ofstream::app;
+        std::ofstream file_read((logDir + "/" + label + "_read.dat").c_str(), mode);
+        if(readStats.n() > 0)
+        {
+            file_read << fileSize << " "
+                << readStats.mean() << " "
+                << readStats.stdev() << " "
+                << throughputStats.mean() << " "
+                << throughputStats.stdev()
+                << std::endl;
+        }
+    }
+};
+
+int main(int argc, char** argv)
+{
+    int numberOfNodes = 100000;
+    int numberOfEdges = 100000;
+    int epochs = 10;
+
+    if(argc < 3 || argc > 4)
+    {
+        printf("usage: %s [-h|--help] <number-of-nodes> <number-of-edges> [<number-of-epochs>]\n", argv[0]);
+        exit(0);
+    }
+    numberOfNodes = ::boost::lexical_cast<int>(argv[1]);
+    numberOfEdges = ::boost::lexical_cast<int>(argv[2]);
+    if(argc == 4)
+    {
+        epochs = ::boost::lexical_cast<int>(argv[3]);
+    }
+
+    std::string currentTime = base::Time::now().toString(base::Time::Seconds);
+    std::string logDir = "/tmp/" + currentTime + "_graph_analysis-io-benchmark";
+    if(! boost::filesystem::create_directories( boost::filesystem::path(logDir.c_str())) )
+    {
+        throw std::runtime_error("graph_analysis-io-bm: failed to create log directory: " + logDir);
+    }
+
+    // Generate a random graph which is used for all formats
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(numberOfNodes);
+    for(int i = 0; i < numberOfNodes; ++i)
+    {
+        vertices.push_back(Vertex::Ptr(new Vertex("vertex-" + boost::lexical_cast<std::string>(i))));
+    }
+    graph->addVertices(vertices);
+
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(numberOfEdges);
+    for(int i = 0; i < numberOfEdges && numberOfNodes > 0; ++i)
+    {
+        Vertex::Ptr source = vertices[rand() % numberOfNodes];
+        Vertex::Ptr target = vertices[rand() % numberOfNodes];
+        edges.push_back(Edge::Ptr(new Edge(source, target, "edge-" + boost::lexical_cast<std::string>(i))));
+    }
+    graph->addEdges(edges);
+
+    representation::Type formats[] = { representation::YAML, representation::GEXF, representation::BINARY };
+    std::vector<IOBenchmark> benchmarks;
+
+    base::Time start,stop;
+    for(size_t f = 0; f < sizeof(formats)/sizeof(formats[0]); ++f)
+    {
+        representation::Type format = formats[f];
+        IOBenchmark ioMark(io::GraphIO::getSuffix(format));
+        ioMark.numberOfNodes = numberOfNodes;
+        ioMark.numberOfEdges = numberOfEdges;
+
+        std::string filename = io::GraphIO::appendSuffix(logDir + "/graph", format);
+        for(int e = 0; e < epochs; ++e)
+        {
+            start = base::Time::now();
+            io::GraphIO::write(filename, graph, format);
+            stop = base::Time::now();
+            ioMark.writeStats.update((stop-start).toSeconds());
+
+            ioMark.fileSize = boost::filesystem::file_size(filename);
+
+            BaseGraph::Ptr readGraph = BaseGraph::getInstance();
+            start = base::Time::now();
+            io::GraphIO::read(filename, readGraph, format);
+            stop = base::Time::now();
+
+            double seconds = (stop-start).toSeconds();
+            ioMark.readStats.update(seconds);
+            if(seconds > 0)
+            {
+                ioMark.throughputStats.update(ioMark.fileSize / (1024.0*1024.0) / seconds);
+            }
+
+            if(readGraph->order() != graph->order() || readGraph->size() != graph->size())
+            {
+                throw std::runtime_error("graph_analysis-io-bm: read graph of format '" + ioMark.label + "' differs from the written graph");
+            }
+        } // epochs
+        ioMark.save(logDir);
+        benchmarks.push_back(ioMark);
+    }
+
+    std::vector<IOBenchmark>::const_iterator cit = benchmarks.begin();
+    for(; cit != benchmarks.end(); ++cit)
+    {
+        std::cout << cit->getReport() << std::endl;
+    }
+    std::cout << "Logfiles have been written to: " << logDir << std::endl;
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "LabelIndex.hpp"
+
+namespace graph_analysis {
+
+const size_t LabelIndex::npos;
+const LabelIndex::IdList LabelIndex::msEmptyList;
+
+void LabelIndex::add(GraphElementId id, Symbol label)
+{
+    if(id >= mPositions.size())
+    {
+        mPositions.resize(id + 1);
+    }
+
+    IdList& ids = mIds[label];
+    mPositions[id] = Position(label, ids.size());
+    ids.push_back(id);
+}
+
+void LabelIndex::remove(GraphElementId id)
+{
+    if(id >= mPositions.size() || mPositions[id].index == npos)
+    {
+        return;
+    }
+
+    Position position = mPositions[id];
+    boost::unordered_map<Symbol, IdList>::iterator it = mIds.find(position.label);
+    IdList& ids = it->second;
+    GraphElementId lastId = ids.back();
+    ids[position.index] = lastId;
+    mPositions[lastId].index = position.index;
+    ids.pop_back();
+    mPositions[id] = Position();
+
+    if(ids.empty())
+    {
+        mIds.erase(it);
+    }
+}
+
+const LabelIndex::IdList& LabelIndex::find(Symbol label) const
+{
+    boost::unordered_map<Symbol, IdList>::const_iterator cit = mIds.find(label);
+    if(cit == mIds.end())
+    {
+        return msEmptyList;
+    }
+    return cit->second;
+}
+
+void LabelIndex::clear()
+{
+    mIds.clear();
+    mPositions.clear();
+}
+
+} // end namespace graph_analysis
@@ -0,0 +1,62 @@
+#ifndef GRAPH_ANALYSIS_LABEL_INDEX_HPP
+#define GRAPH_ANALYSIS_LABEL_INDEX_HPP
+
+#include <limits>
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "GraphElement.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \class LabelIndex
+ * \brief Hash index of the elements of a graph by their (interned) label
+ * \details Elements are added and removed in O(1) via their id, removal does
+ * not preserve the order of the elements with the same label,
+ * see BaseGraph::findVerticesByLabel
+ */
+class LabelIndex
+{
+public:
+    typedef std::vector<GraphElementId> IdList;
+
+    /**
+     * Add an element with the given id and label
+     */
+    void add(GraphElementId id, Symbol label);
+
+    /**
+     * Remove the element with the given id -- ignores unknown ids
+     */
+    void remove(GraphElementId id);
+
+    /**
+     * Get the ids of the elements with the given label
+     */
+    const IdList& find(Symbol label) const;
+
+    void clear();
+
+private:
+    static const size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Position
+    {
+        Position(Symbol label = 0, size_t index = npos)
+            : label(label)
+            , index(index)
+        {}
+
+        Symbol label;
+        size_t index;
+    };
+
+    boost::unordered_map<Symbol, IdList> mIds;
+    /// Position of the elements, indexed by id
+    std::vector<Position> mPositions;
+
+    static const IdList msEmptyList;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_LABEL_INDEX_HPP
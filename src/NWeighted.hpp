@@ -1,8 +1,11 @@
 #ifndef GRAPH_ANALYSIS_NWEIGHTED_HPP
 #define GRAPH_ANALYSIS_NWEIGHTED_HPP
 
+#include <algorithm>
+#include <array>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 #include <iomanip>
 
@@ -11,12 +14,16 @@
 #include <boost/archive/text_oarchive.hpp>
 
 #include "SharedPtr.hpp"
+#include "io/AttributeCodec.hpp"
 
 namespace graph_analysis {
 
 /**
  * \brief NWeighted is a template to associate N-weights with either a vertex
  * or an edge, i.e., adds a vector of weights
+ * \details The weights are stored inline, i.e. without an extra allocation
+ * per element. Use getWeight<Index>() when the dimension is known at compile
+ * time, and exportWeights to read one dimension of many elements
  *
  * \tparam T value type of the weights
  * \tparam Dim dimensions / number of weights
@@ -35,10 +42,9 @@ public:
      */
     NWeighted(const T& weight)
         : GraphElementType()
-        , mWeights(Dim)
     {
+        mWeights.fill(T());
         setWeight(weight, 0);
-        validateDimensions(mWeights);
     }
 
     /**
@@ -46,13 +52,14 @@ public:
      */
     NWeighted(const std::vector<T>& weights = std::vector<T>(Dim))
         : GraphElementType()
-        , mWeights(weights)
     {
-        validateDimensions(mWeights);
+        validateDimensions(weights);
+        std::copy(weights.begin(), weights.end(), mWeights.begin());
     }
 
     NWeighted(const NWeighted& other)
     {
+        other.restoreAttributes();
         mWeights = other.mWeights;
     }
 
@@ -62,15 +69,21 @@ public:
     // \return class name
     virtual std::string getClassName() const { return "graph_analysis::NWeighted"; }
 
+    /**
+     * Get the number of weights
+     */
+    static constexpr size_t getDimensions() { return Dim; }
+
     /**
      * Convert element to string
      */
     virtual std::string toString() const
     {
+        this->restoreAttributes();
         std::stringstream ss;
         ss << GraphElementType::toString();
         ss << ": " << "[";
-        typename std::vector<T>::const_iterator cit = mWeights.begin();
+        typename std::array<T, Dim>::const_iterator cit = mWeights.begin();
         for(;; ++cit)
         {
             ss << *cit;
@@ -88,16 +101,19 @@ public:
     void setWeights(const std::vector<T>& weights)
     {
         validateDimensions(weights);
-        mWeights = weights;
+        this->restoreAttributes();
+        std::copy(weights.begin(), weights.end(), mWeights.begin());
     }
 
     std::vector<T> getWeights() const
     {
-        return mWeights;
+        this->restoreAttributes();
+        return std::vector<T>(mWeights.begin(), mWeights.end());
     }
 
     void setWeight(T value, size_t index = 0)
     {
+        this->restoreAttributes();
         try {
             mWeights.at(index) = value;
         } catch(const std::out_of_range& e)
@@ -115,6 +131,7 @@ public:
      */
     const T& getWeight(size_t index = 0) const
     {
+        this->restoreAttributes();
         try {
             return mWeights.at(index);
         } catch(const std::out_of_range& e)
@@ -123,20 +140,124 @@ public:
         }
     }
 
+    /**
+     * Set weight at the given index, which is checked at compile time
+     */
+    template<size_t Index>
+    void setWeight(T value)
+    {
+        static_assert(Index < Dim, "graph_analysis::NWeighted::setWeight: index exceeds the number of weights");
+        this->restoreAttributes();
+        mWeights[Index] = value;
+    }
+
+    /**
+     * Get weight at the given index, which is checked at compile time
+     */
+    template<size_t Index>
+    const T& getWeight() const
+    {
+        static_assert(Index < Dim, "graph_analysis::NWeighted::getWeight: index exceeds the number of weights");
+        this->restoreAttributes();
+        return mWeights[Index];
+    }
+
+    /**
+     * Export the weight at the given index (dimension) of all elements into
+     * a contiguous array, e.g. for algorithms which read one weight per
+     * element repeatedly
+     * \param elements elements of this type, e.g. from
+     * BaseGraph::getEdges<WeightedEdge>()
+     * \param index dimension of the weight
+     * \param weights array with at least elements.size() entries
+     * \throw std::out_of_range if the index exceeds the number of weights
+     */
+    template<typename Element>
+    static void exportWeights(const std::vector< shared_ptr<Element> >& elements, size_t index, T* weights)
+    {
+        static_assert(std::is_base_of<NWeighted, Element>::value, "graph_analysis::NWeighted::exportWeights: elements have to be of this type");
+        if(index >= Dim)
+        {
+            std::stringstream ss;
+            ss << "graph_analysis::NWeighted::exportWeights: dim: is " << Dim << ", tried access at: " << index;
+            throw std::out_of_range(ss.str());
+        }
+
+        for(size_t i = 0; i < elements.size(); ++i)
+        {
+            const NWeighted& element = *elements[i];
+            element.restoreAttributes();
+            weights[i] = element.mWeights[index];
+        }
+    }
+
+    /**
+     * Export the weight at the given index (dimension) of all elements
+     * \see exportWeights(const std::vector< shared_ptr<Element> >&, size_t, T*)
+     */
+    template<typename Element>
+    static std::vector<T> exportWeights(const std::vector< shared_ptr<Element> >& elements, size_t index)
+    {
+        std::vector<T> weights(elements.size());
+        exportWeights(elements, index, weights.data());
+        return weights;
+    }
+
+    /**
+     * Serialize the weights, which can be registered as attribute together
+     * with deserializeWeights, see AttributeManager::registerAttribute
+     */
     std::string serializeWeights()
     {
+        // Serialized as vector to remain compatible with existing files
+        const std::vector<T> weights = getWeights();
         std::stringstream ss;
         boost::archive::text_oarchive oarch(ss);
-        oarch << mWeights;
+        oarch << weights;
         return ss.str();
     }
 
     void deserializeWeights(const std::string& s)
     {
+        std::vector<T> weights;
         std::stringstream ss;
         ss << s;
         boost::archive::text_iarchive iarch(ss);
-        iarch >> mWeights;
+        iarch >> weights;
+        validateDimensions(weights);
+        std::copy(weights.begin(), weights.end(), mWeights.begin());
+    }
+
+    /**
+     * Serialize the weights in the binary encoding, see AttributeCodec.hpp
+     * \details The weights can be registered as lazy attribute, since all
+     * accessors restore pending attributes
+     \verbatim
+        io::AttributeSerializationCallbacks callbacks = {
+            (io::AttributeSerializationCallbacks::serialize_func_t) &WeightedEdge::serializeWeights,
+            (io::AttributeSerializationCallbacks::deserialize_func_t) &WeightedEdge::deserializeWeights,
+            (io::AttributeSerializationCallbacks::print_func_t) &WeightedEdge::serializeWeights,
+            (io::AttributeSerializationCallbacks::serialize_func_t) &WeightedEdge::serializeBinaryWeights,
+            (io::AttributeSerializationCallbacks::deserialize_func_t) &WeightedEdge::deserializeBinaryWeights,
+            true
+        };
+        eManager->registerAttribute(WeightedEdge().getClassName(), "weights", callbacks);
+     \endverbatim
+     */
+    std::string serializeBinaryWeights()
+    {
+        io::AttributeEncoder encoder;
+        encoder << getWeights();
+        return encoder.str();
+    }
+
+    void deserializeBinaryWeights(const std::string& s)
+    {
+        std::vector<T> weights;
+        io::AttributeDecoder decoder(s);
+        decoder >> weights;
+        validateDimensions(weights);
+        std::copy(weights.begin(), weights.end(), mWeights.begin());
     }
 
 protected:
@@ -153,7 +274,7 @@ protected:
 
     virtual GraphElementType* getClone() const { return new NWeighted(*this); }
 
-    std::vector<T> mWeights;
+    std::array<T, Dim> mWeights;
 };
 
 } // end namespace graph_analysis
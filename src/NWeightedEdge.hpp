@@ -2,8 +2,10 @@
 #define GRAPH_ANALYSIS_NWEIGHTED_EDGE_HPP
 
 #include <iostream>
+#include <typeinfo>
 #include "NWeighted.hpp"
 #include "Edge.hpp"
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
@@ -47,6 +49,15 @@ public:
 
 protected:
     virtual Edge* getClone() const { return new NWeightedEdge<T,Dim>(*this); }
+
+    virtual Edge::Ptr getClone(GraphArena& arena) const
+    {
+        if(typeid(*this) != typeid(NWeightedEdge<T,Dim>))
+        {
+            return Edge::getClone(arena);
+        }
+        return arena.create< NWeightedEdge<T,Dim> >(*this);
+    }
 };
 
 } // end namespace graph_analysis
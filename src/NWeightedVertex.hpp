@@ -2,8 +2,10 @@
 #define GRAPH_ANALYSIS_NWEIGHTED_VERTEX_HPP
 
 #include <iostream>
+#include <typeinfo>
 #include "NWeighted.hpp"
 #include "Vertex.hpp"
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
@@ -29,6 +31,15 @@ public:
 
 protected:
     virtual Vertex* getClone() const { return new NWeightedVertex<T,Dim>(*this); }
+
+    virtual Vertex::Ptr getClone(GraphArena& arena) const
+    {
+        if(typeid(*this) != typeid(NWeightedVertex<T,Dim>))
+        {
+            return Vertex::getClone(arena);
+        }
+        return arena.create< NWeightedVertex<T,Dim> >(*this);
+    }
 };
 
 } // end namespace graph_analysis
@@ -0,0 +1,88 @@
+#include "ObserverEventBatch.hpp"
+
+namespace graph_analysis {
+
+ObserverEventBatch::ObserverEventBatch()
+    : mNumberOfCancelledEvents(0)
+{}
+
+void ObserverEventBatch::add(const ObserverEvent& event)
+{
+    Key key(event.element.get(), event.origin);
+    boost::unordered_map<Key, size_t>::iterator it = mIndex.find(key);
+    if(it == mIndex.end())
+    {
+        mIndex[key] = mEvents.size();
+        mEvents.push_back(event);
+        return;
+    }
+
+    ObserverEvent& pendingEvent = mEvents[it->second];
+    if(pendingEvent.event == event.event)
+    {
+        return;
+    }
+
+    if(pendingEvent.event == EVENT_TYPE_ADDED && event.event == EVENT_TYPE_REMOVED)
+    {
+        // Events cancel out, keep the slot to preserve the order
+        pendingEvent.element.reset();
+        mIndex.erase(it);
+        if(2*++mNumberOfCancelledEvents > mEvents.size())
+        {
+            compact();
+        }
+    } else {
+        // An element which is added again after its removal is reported
+        // with both events
+        it->second = mEvents.size();
+        mEvents.push_back(event);
+    }
+}
+
+void ObserverEventBatch::compact()
+{
+    size_t position = 0;
+    for(size_t i = 0; i < mEvents.size(); ++i)
+    {
+        if(!mEvents[i].element)
+        {
+            continue;
+        }
+        if(position != i)
+        {
+            mEvents[position] = mEvents[i];
+        }
+        // The latest event of an element is the last one to be moved
+        mIndex[Key(mEvents[position].element.get(), mEvents[position].origin)] = position;
+        ++position;
+    }
+    mEvents.resize(position);
+    mNumberOfCancelledEvents = 0;
+}
+
+void ObserverEventBatch::take(std::vector<ObserverEvent>& events)
+{
+    events.clear();
+    events.reserve(size());
+
+    std::vector<ObserverEvent>::const_iterator cit = mEvents.begin();
+    for(; cit != mEvents.end(); ++cit)
+    {
+        if(!cit->element)
+        {
+            continue;
+        }
+        events.push_back(*cit);
+    }
+    clear();
+}
+
+void ObserverEventBatch::clear()
+{
+    mEvents.clear();
+    mIndex.clear();
+    mNumberOfCancelledEvents = 0;
+}
+
+} // end namespace graph_analysis
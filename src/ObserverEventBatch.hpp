@@ -0,0 +1,67 @@
+#ifndef GRAPH_ANALYSIS_OBSERVER_EVENT_BATCH_HPP
+#define GRAPH_ANALYSIS_OBSERVER_EVENT_BATCH_HPP
+
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "BaseGraphObserver.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \class ObserverEventBatch
+ * \brief Collection of vertex and edge events which coalesces events of the
+ * same element
+ * \details An add which is followed by a remove of the same element and
+ * graph cancels out, and repeated events of the same type are reported only
+ * once. A remove which is followed by an add is kept, since the element
+ * might have been changed in between.
+ *
+ * Slots of cancelled events are compacted once they make up the majority
+ * of the batch, so that the memory of the batch is bounded by the number
+ * of pending events.
+ */
+class ObserverEventBatch
+{
+public:
+    ObserverEventBatch();
+
+    /**
+     * Add an event to the batch
+     */
+    void add(const ObserverEvent& event);
+
+    /**
+     * Get the number of events after coalescing
+     */
+    size_t size() const { return mEvents.size() - mNumberOfCancelledEvents; }
+
+    bool empty() const { return size() == 0; }
+
+    /**
+     * Get the coalesced events in the order of their first occurrence and
+     * clear the batch
+     * \details The removal of a vertex reports the removal of its edges as
+     * well, so that edges which have been added and removed together with a
+     * vertex cancel out
+     */
+    void take(std::vector<ObserverEvent>& events);
+
+    void clear();
+
+private:
+    typedef std::pair<const GraphElement*, GraphId> Key;
+
+    /**
+     * Remove the slots of cancelled events
+     */
+    void compact();
+
+    std::vector<ObserverEvent> mEvents;
+    /// Index of the latest pending event of an element in mEvents
+    boost::unordered_map<Key, size_t> mIndex;
+    /// Number of slots in mEvents whose event has been cancelled
+    size_t mNumberOfCancelledEvents;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_OBSERVER_EVENT_BATCH_HPP
@@ -23,6 +23,7 @@ namespace graph_analysis
     using ::boost::weak_ptr;
     using ::boost::enable_shared_from_this;
     using ::boost::make_shared;
+    using ::boost::allocate_shared;
     using ::boost::dynamic_pointer_cast;
     using ::boost::static_pointer_cast;
     using ::boost::const_pointer_cast;
@@ -32,6 +33,7 @@ namespace graph_analysis
     using ::std::shared_ptr;
     using ::std::weak_ptr;
     using ::std::make_shared;
+    using ::std::allocate_shared;
     using ::std::dynamic_pointer_cast;
     using ::std::static_pointer_cast;
     using ::std::const_pointer_cast;
@@ -1,62 +1,173 @@
 #include "SubGraph.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <typeindex>
 #include <boost/bind.hpp>
 #include "BaseGraph.hpp"
 #include "filters/EdgeContextFilter.hpp"
 #include "filters/CommonFilters.hpp"
+#include "utils/Parallel.hpp"
 
 namespace graph_analysis {
 
 SubGraph::SubGraph(const BaseGraph::Ptr& baseGraph)
     : mpBaseGraph(baseGraph)
+    , mParallelFiltersEnabled(false)
 {}
 
+namespace {
+
+/// Minimum number of elements a thread evaluates filters for
+const size_t MIN_FILTER_CHUNK_SIZE = 1024;
+
+/**
+ * Collect all elements of an iterator, so that they can be addressed by index
+ */
+template<typename T, typename IteratorPtr>
+std::vector<T> collect(const IteratorPtr& iterator)
+{
+    std::vector<T> elements;
+    while(iterator->next())
+    {
+        elements.push_back(iterator->current());
+    }
+    return elements;
+}
+
+/**
+ * Evaluate a predicate for all elements over chunks of the elements, which
+ * are evaluated in parallel if the chunk size permits
+ * \details Each chunk is evaluated into its own mask, the masks are merged
+ * once all chunks have been evaluated
+ * \return mask, which holds the result of the predicate per element
+ */
+template<typename T, typename F>
+std::vector<bool> evaluateParallel(const std::vector<T>& elements, size_t minChunkSize, const F& predicate)
+{
+    typedef std::pair<size_t, std::vector<bool> > ChunkMask;
+    std::vector<ChunkMask> chunkMasks;
+    std::mutex mutex;
+
+    utils::parallelFor(elements.size(), minChunkSize, [&elements, &predicate, &chunkMasks, &mutex](size_t begin, size_t end)
+        {
+            std::vector<bool> mask(end - begin, false);
+            for(size_t i = begin; i < end; ++i)
+            {
+                mask[i - begin] = predicate(elements[i]);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            chunkMasks.push_back(ChunkMask(begin, std::vector<bool>()));
+            chunkMasks.back().second.swap(mask);
+        });
+
+    std::vector<bool> mask(elements.size(), false);
+    for(size_t c = 0; c < chunkMasks.size(); ++c)
+    {
+        const ChunkMask& chunkMask = chunkMasks[c];
+        std::copy(chunkMask.second.begin(), chunkMask.second.end(), mask.begin() + chunkMask.first);
+    }
+    return mask;
+}
+
+/**
+ * Collect one element per class of the given elements, see Filter::prepare
+ * \details Pending attributes are restored if requested, since the lazy
+ * restore is not safe to be triggered from multiple threads
+ * \return one element per class of the given elements
+ */
+template<typename T>
+std::vector<T> prepareElements(const std::vector<T>& elements, bool restoreAttributes)
+{
+    std::vector<T> classes;
+    std::vector<std::type_index> types;
+    for(size_t i = 0; i < elements.size(); ++i)
+    {
+        if(restoreAttributes)
+        {
+            elements[i]->restoreAttributes();
+        }
+
+        std::type_index type(typeid(*elements[i]));
+        if(std::find(types.begin(), types.end(), type) == types.end())
+        {
+            types.push_back(type);
+            classes.push_back(elements[i]);
+        }
+    }
+    return classes;
+}
+
+} // end anonymous namespace
+
 /**
  * Apply filters to this subgraph, pass filters::Filter<Vertex::Ptr>::Null() or
  * filters::Filter<Edge::Ptr>::Null() to skip filter for vertices or nodes
+ *
+ * The filters are prepared (see Filter::prepare) on the calling thread. If
+ * parallel evaluation is enabled, pending attributes of the elements which
+ * are evaluated are restored beforehand as well. The enable state of the
+ * subgraph is updated afterwards in a single pass on the calling thread.
  */
 void SubGraph::applyFilters(const Filter<Vertex::Ptr>::Ptr& vertexFilter, const Filter<Edge::Ptr>::Ptr& edgeFilter)
 {
-    if(edgeFilter)
+    if(!vertexFilter && !edgeFilter)
     {
-        filters::EdgeContextFilter::Ptr contextFilter = dynamic_pointer_cast<filters::EdgeContextFilter>(edgeFilter);
+        return;
+    }
 
-        EdgeIterator::Ptr edgeIterator = getBaseGraph()->getEdgeIterator();
+    // A single chunk is evaluated on the calling thread
+    size_t minChunkSize = mParallelFiltersEnabled ? MIN_FILTER_CHUNK_SIZE : std::numeric_limits<size_t>::max();
 
-        while(edgeIterator->next())
-        {
-            Edge::Ptr edge = edgeIterator->current();
-            // By default we enable
-            enable(edge);
+    // Edges are only evaluated by context filters, which evaluate the source
+    // and target vertices as well
+    filters::EdgeContextFilter::Ptr contextFilter = dynamic_pointer_cast<filters::EdgeContextFilter>(edgeFilter);
+    std::vector<Vertex::Ptr> vertices = collect<Vertex::Ptr>(getBaseGraph()->getVertexIterator());
+    std::vector<Edge::Ptr> edges = collect<Edge::Ptr>(getBaseGraph()->getEdgeIterator());
+    std::vector<Vertex::Ptr> vertexClasses = prepareElements(vertices, mParallelFiltersEnabled && (vertexFilter || contextFilter));
+    std::vector<Edge::Ptr> edgeClasses = prepareElements(edges, mParallelFiltersEnabled && contextFilter);
 
-            if( edgeFilter->matches(edge) )
+    if(edgeFilter)
+    {
+        edgeFilter->prepare(vertexClasses, edgeClasses);
+        std::vector<bool> disabledEdges = evaluateParallel(edges, minChunkSize, [&edgeFilter, &contextFilter](const Edge::Ptr& edge)
             {
-                // A context filter should apply to source / target nodes -- no need to filter this edge specifically then
-                if(contextFilter)
-                {
-                    bool filterTarget = contextFilter->matchesTarget(edge);
-                    bool filterSource = contextFilter->matchesSource(edge);
-
-                    if(filterSource && filterTarget)
-                    {
-                        disable(edge);
-                    }
-                }
+                // A context filter should apply to source / target nodes --
+                // an edge is only disabled if both of them are matched
+                return contextFilter
+                    && edgeFilter->matches(edge)
+                    && contextFilter->matchesSource(edge)
+                    && contextFilter->matchesTarget(edge);
+            });
+
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            if(disabledEdges[i])
+            {
+                disable(edges[i]);
+            } else {
+                enable(edges[i]);
             }
         }
     }
 
     if(vertexFilter)
     {
-        VertexIterator::Ptr vertexIterator = getBaseGraph()->getVertexIterator();
-        while(vertexIterator->next())
+        vertexFilter->prepare(vertexClasses, edgeClasses);
+        std::vector<bool> disabledVertices = evaluateParallel(vertices, minChunkSize, [&vertexFilter](const Vertex::Ptr& vertex)
+            {
+                return vertexFilter->matches(vertex);
+            });
+
+        for(size_t i = 0; i < vertices.size(); ++i)
         {
-            Vertex::Ptr vertex = vertexIterator->current();
-            if( vertexFilter->matches(vertex) )
+            if(disabledVertices[i])
             {
-                disable(vertex);
+                disable(vertices[i]);
             } else {
-                enable(vertex);
+                enable(vertices[i]);
             }
         }
     }
@@ -38,6 +38,9 @@ protected:
     std::set<GraphElementId> mDisabledVertices;
     std::set<GraphElementId> mDisabledEdges;
 
+    /// Evaluate filters on multiple threads
+    bool mParallelFiltersEnabled;
+
 public:
     /**
      * Default constructor
@@ -125,9 +128,28 @@ public:
 
     /**
      * Apply filters to this subgraph
+     * \details The filters are prepared on the calling thread, and evaluated
+     * concurrently over chunks of the vertices and edges if enabled (see
+     * setParallelFiltersEnabled)
+     * \see Filter::prepare
      */
     void applyFilters(const Filter<Vertex::Ptr>::Ptr& vertexFilter, const Filter<Edge::Ptr>::Ptr& edgeFilter);
 
+    /**
+     * Enable (or disable) evaluating filters in parallel in applyFilters
+     * \details Disabled by default. Only enable it if the filters are safe
+     * to be called concurrently, i.e. do not modify shared state. Since the
+     * lazy restore of attributes is not thread-safe, pending attributes of
+     * the elements the filters evaluate by content are restored on the
+     * calling thread beforehand
+     */
+    void setParallelFiltersEnabled(bool enabled) { mParallelFiltersEnabled = enabled; }
+
+    /**
+     * Test whether filters are evaluated in parallel
+     */
+    bool isParallelFiltersEnabled() const { return mParallelFiltersEnabled; }
+
     /**
      * Convert the subgraph into a base graph by copying only the enabled nodes
      * and edges
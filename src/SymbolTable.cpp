@@ -0,0 +1,129 @@
+#include "SymbolTable.hpp"
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <boost/unordered_map.hpp>
+
+namespace graph_analysis {
+
+namespace {
+
+/// The strings are stored in blocks of growing size, block b holds
+/// 2^(FIRST_BLOCK_BITS + b) strings. Blocks are never moved, so that strings
+/// can be resolved while new ones are being added
+const uint32_t FIRST_BLOCK_BITS = 10;
+const size_t NUMBER_OF_BLOCKS = 32 - FIRST_BLOCK_BITS + 1;
+
+struct Table
+{
+    Table()
+        : size(1)
+    {
+        for(size_t b = 0; b < NUMBER_OF_BLOCKS; ++b)
+        {
+            blocks[b] = NULL;
+        }
+        blocks[0] = new std::string[1 << FIRST_BLOCK_BITS];
+        symbols[std::string()] = SymbolTable::EMPTY;
+    }
+
+    std::mutex mutex;
+    boost::unordered_map<std::string, Symbol> symbols;
+    std::atomic<std::string*> blocks[NUMBER_OF_BLOCKS];
+    std::atomic<uint64_t> size;
+};
+
+Table& getTable()
+{
+    // Never destroyed, since elements may resolve their labels during
+    // static destruction
+    static Table* table = new Table();
+    return *table;
+}
+
+void locate(Symbol symbol, size_t& block, size_t& offset)
+{
+    uint64_t position = static_cast<uint64_t>(symbol) + (1 << FIRST_BLOCK_BITS);
+    block = 0;
+    while(position >> (block + FIRST_BLOCK_BITS + 1))
+    {
+        ++block;
+    }
+    offset = position - (static_cast<uint64_t>(1) << (block + FIRST_BLOCK_BITS));
+}
+
+} // end anonymous namespace
+
+const Symbol SymbolTable::EMPTY;
+
+Symbol SymbolTable::intern(const std::string& name)
+{
+    if(name.empty())
+    {
+        return EMPTY;
+    }
+
+    Table& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    boost::unordered_map<std::string, Symbol>::const_iterator cit = table.symbols.find(name);
+    if(cit != table.symbols.end())
+    {
+        return cit->second;
+    }
+
+    uint64_t size = table.size.load(std::memory_order_relaxed);
+    if(size > static_cast<uint64_t>(static_cast<Symbol>(-1)))
+    {
+        throw std::runtime_error("graph_analysis::SymbolTable::intern: maximum number of symbols reached");
+    }
+
+    Symbol symbol = static_cast<Symbol>(size);
+    size_t block, offset;
+    locate(symbol, block, offset);
+    std::string* strings = table.blocks[block].load(std::memory_order_relaxed);
+    if(!strings)
+    {
+        strings = new std::string[static_cast<size_t>(1) << (block + FIRST_BLOCK_BITS)];
+        table.blocks[block].store(strings, std::memory_order_release);
+    }
+    strings[offset] = name;
+    table.symbols[name] = symbol;
+    table.size.store(size + 1, std::memory_order_release);
+    return symbol;
+}
+
+bool SymbolTable::lookup(const std::string& name, Symbol& symbol)
+{
+    Table& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    boost::unordered_map<std::string, Symbol>::const_iterator cit = table.symbols.find(name);
+    if(cit == table.symbols.end())
+    {
+        return false;
+    }
+    symbol = cit->second;
+    return true;
+}
+
+const std::string& SymbolTable::resolve(Symbol symbol)
+{
+    Table& table = getTable();
+    if(symbol >= table.size.load(std::memory_order_acquire))
+    {
+        std::stringstream ss;
+        ss << "graph_analysis::SymbolTable::resolve: unknown symbol " << symbol;
+        throw std::out_of_range(ss.str());
+    }
+
+    size_t block, offset;
+    locate(symbol, block, offset);
+    return table.blocks[block].load(std::memory_order_acquire)[offset];
+}
+
+size_t SymbolTable::size()
+{
+    return getTable().size.load(std::memory_order_acquire);
+}
+
+} // end namespace graph_analysis
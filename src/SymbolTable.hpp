@@ -0,0 +1,54 @@
+#ifndef GRAPH_ANALYSIS_SYMBOL_TABLE_HPP
+#define GRAPH_ANALYSIS_SYMBOL_TABLE_HPP
+
+#include <stdint.h>
+#include <string>
+
+namespace graph_analysis {
+
+/// Interned string, see SymbolTable
+typedef uint32_t Symbol;
+
+/**
+ * \class SymbolTable
+ * \brief Global table of interned strings, e.g. labels and class names
+ * \details Each distinct string is stored once and is identified by a 32 bit
+ * symbol, so that elements sharing a label only store the symbol and labels
+ * can be compared without comparing strings. Interned strings are never
+ * released.
+ *
+ * Interning is thread-safe, resolving a symbol does not lock.
+ * The empty string is always represented by the symbol 0.
+ */
+class SymbolTable
+{
+public:
+    /// Symbol of the empty string
+    static const Symbol EMPTY = 0;
+
+    /**
+     * Get the symbol for a string, intern the string if necessary
+     */
+    static Symbol intern(const std::string& name);
+
+    /**
+     * Get the symbol for a string, without interning it
+     * \return true if the string has been interned, false otherwise
+     */
+    static bool lookup(const std::string& name, Symbol& symbol);
+
+    /**
+     * Get the string of a symbol
+     * \return reference which stays valid for the lifetime of the program
+     * \throw std::out_of_range if the symbol is unknown
+     */
+    static const std::string& resolve(Symbol symbol);
+
+    /**
+     * Get the number of interned strings
+     */
+    static size_t size();
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_SYMBOL_TABLE_HPP
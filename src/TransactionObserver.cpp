@@ -1,7 +1,32 @@
 #include "TransactionObserver.hpp"
+#include <algorithm>
 
 using namespace graph_analysis;
 
+namespace {
+
+/// Default number of held events after which events are logged
+const size_t DEFAULT_SPILL_THRESHOLD = 100000;
+
+/// Position of a logged event, ordered by element
+struct LogPosition
+{
+    const GraphElement* element;
+    GraphId origin;
+    size_t index;
+
+    bool operator<( const LogPosition& other ) const
+    {
+        if( element != other.element )
+            return element < other.element;
+        if( origin != other.origin )
+            return origin < other.origin;
+        return index < other.index;
+    }
+};
+
+} // end anonymous namespace
+
 ObserverEvent::ObserverEvent() {}
 
 ObserverEvent::ObserverEvent( GraphElement::Ptr element, GraphId origin, EventType event )
@@ -33,7 +58,8 @@ TransactionObserver::Ptr TransactionObserver::getInstance( BaseGraphObserver::Pt
 }
 
 TransactionObserver::TransactionObserver( BaseGraphObserver::Ptr &observer )
-    : mpObserver( observer )
+    : mSpillThreshold( DEFAULT_SPILL_THRESHOLD )
+    , mpObserver( observer )
     , mTransactionLevel( 0 ) {} 
 
 TransactionObserver::~TransactionObserver() {}
@@ -52,18 +78,16 @@ void TransactionObserver::notify(const Edge::Ptr& edge, const EventType& event,
 
 void TransactionObserver::notify( const TransactionType& event, const GraphId& origin )
 {
-    // for a TRANSACTION_STOP event, we will emit all the events collected so far
+    // for the outermost TRANSACTION_STOP event, we will emit all the events collected so far
     if( event == TRANSACTION_STOP )
     {
-        for( std::vector<ObserverEvent>::iterator it = mEvents.begin(); it != mEvents.end(); ++it )
-        {
-            emitEvent( *it );
-        }
-        mEvents.clear();
         mTransactionLevel -= 1;
 
         if( mTransactionLevel < 0 )
             throw std::runtime_error("Got TRANSACTION_STOP event without a corresponding start.");
+
+        if( mTransactionLevel == 0 )
+            emitEvents();
     }
 
     if( event == TRANSACTION_START )
@@ -82,30 +106,135 @@ bool TransactionObserver::inTransaction()
     return mTransactionLevel > 0;
 }
 
-void TransactionObserver::addEvent( ObserverEvent event )
+void TransactionObserver::addEvent( const ObserverEvent& event )
 {
-    // TODO we need to filter here, that paired add/remove events 
-    // result in removal of both events alltogether.
-
     // only hold events when in a transaction
-    if( inTransaction() )
-        mEvents.push_back( event );
-    else
+    if( !inTransaction() )
+    {
         emitEvent( event );
+        return;
+    }
+
+    if( !mLog.empty() )
+    {
+        logEvent( event );
+        return;
+    }
+
+    mEvents.add( event );
+    if( mEvents.size() > mSpillThreshold )
+    {
+        // move the coalesced events to the log
+        std::vector<ObserverEvent> events;
+        mEvents.take( events );
+        mLog.reserve( events.size() );
+        for( std::vector<ObserverEvent>::const_iterator it = events.begin(); it != events.end(); ++it )
+        {
+            logEvent( *it );
+        }
+    }
+}
+
+void TransactionObserver::logEvent( const ObserverEvent& event )
+{
+    LoggedEvent loggedEvent;
+    loggedEvent.element = event.element;
+    loggedEvent.origin = event.origin;
+    loggedEvent.event = event.event;
+    mLog.push_back( loggedEvent );
+
+    if( event.event == EVENT_TYPE_REMOVED )
+        mRemovedElements.push_back( event.element );
 }
 
-void TransactionObserver::emitEvent( ObserverEvent event )
+void TransactionObserver::emitEvent( const ObserverEvent& event )
 {
-    Vertex::Ptr vertex = dynamic_pointer_cast<Vertex>( event.element );
-    if( vertex )
+    mpObserver->notifyBatch( std::vector<ObserverEvent>( 1, event ) );
+}
+
+void TransactionObserver::emitEvents()
+{
+    if( !mLog.empty() )
     {
-        mpObserver->notify( vertex, event.event, event.origin );
-        return; 
+        emitLog();
+        return;
     }
-    Edge::Ptr edge = dynamic_pointer_cast<Edge>( event.element );
-    if( edge )
-    {
-        mpObserver->notify( edge, event.event, event.origin );
+
+    if( mEvents.empty() )
         return;
+
+    std::vector<ObserverEvent> events;
+    mEvents.take( events );
+    mpObserver->notifyBatch( events );
+}
+
+void TransactionObserver::emitLog()
+{
+    // Order the events by element -- all elements are still alive, except
+    // for added elements which have been dropped from the graph
+    std::vector<LogPosition> positions;
+    positions.reserve( mLog.size() );
+    for( size_t i = 0; i < mLog.size(); ++i )
+    {
+        GraphElement::Ptr element = mLog[i].element.lock();
+        if( element )
+        {
+            LogPosition position = { element.get(), mLog[i].origin, i };
+            positions.push_back( position );
+        }
+    }
+    std::sort( positions.begin(), positions.end() );
+
+    // Keep a single event per element at its first position, if the element
+    // has been part of the graph before the transaction (the first event is a
+    // removal) and is no longer, or vice versa. An element which has been
+    // removed and added again is reported with both events -- as in
+    // ObserverEventBatch only an add followed by a remove cancels out
+    std::vector<bool> selected( mLog.size(), false );
+    for( std::vector<LogPosition>::const_iterator it = positions.begin(); it != positions.end(); )
+    {
+        std::vector<LogPosition>::const_iterator first = it;
+        while( it != positions.end() && it->element == first->element && it->origin == first->origin )
+            ++it;
+
+        bool wasPresent = mLog[first->index].event == EVENT_TYPE_REMOVED;
+        bool isPresent = first->element->associated( first->origin );
+        if( wasPresent != isPresent )
+        {
+            mLog[first->index].event = isPresent ? EVENT_TYPE_ADDED : EVENT_TYPE_REMOVED;
+            selected[first->index] = true;
+        } else if( wasPresent && it - first > 1 )
+        {
+            size_t last = (it - 1)->index;
+            mLog[last].event = EVENT_TYPE_ADDED;
+            selected[first->index] = true;
+            selected[last] = true;
+        }
+    }
+    std::vector<LogPosition>().swap( positions );
+
+    // Emit in groups to limit the number of referenced elements
+    std::vector<ObserverEvent> events;
+    events.reserve( std::min( mLog.size(), mSpillThreshold + 1 ) );
+    for( size_t i = 0; i < mLog.size(); ++i )
+    {
+        if( !selected[i] )
+            continue;
+
+        GraphElement::Ptr element = mLog[i].element.lock();
+        if( element )
+            events.push_back( ObserverEvent( element, mLog[i].origin, mLog[i].event ) );
+
+        if( events.size() > mSpillThreshold )
+        {
+            mpObserver->notifyBatch( events );
+            events.clear();
+        }
     }
+
+    std::vector<LoggedEvent>().swap( mLog );
+    std::vector<GraphElement::Ptr>().swap( mRemovedElements );
+
+    if( !events.empty() )
+        mpObserver->notifyBatch( events );
 }
@@ -2,28 +2,13 @@
 #define GRAPH_ANALYSIS_TRANSACTION_OBSERVER_HPP__
 
 #include "BaseGraphObserver.hpp"
+#include "ObserverEventBatch.hpp"
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
 
 namespace graph_analysis
 {
 
-struct ObserverEvent
-{
-    GraphElement::Ptr element;
-    GraphId origin;
-    EventType event;
-
-    ObserverEvent();
-    ObserverEvent( GraphElement::Ptr element, GraphId origin, EventType event );
-
-    /** @brief return true if a match is found between two events
-     * @return true if events cancel each other out.  This is e.g. the case
-     * when for an add/remove on the same element.
-     */
-    bool match( const ObserverEvent& other ) const;
-};
-
 /**
  * \brief A transaction observer
  *
@@ -36,6 +21,15 @@ struct ObserverEvent
  * The transaction events TRANSACTION_START and TRANSACTION_STOP can be nested.
  * Events are then held until the outermost transaction has been finished.
  *
+ * Events are coalesced (see ObserverEventBatch), i.e. an element which has
+ * been added and removed again is not reported at all and each element is
+ * reported at most once. The events are forwarded as groups via
+ * BaseGraphObserver::notifyBatch.
+ *
+ * Once the number of held events exceeds the spill threshold, new events
+ * are appended to a compact log, which refers to added elements only
+ * weakly. The log is coalesced when it is emitted.
+ *
  * \verbatim
  * Usage:
  * 
@@ -76,11 +70,38 @@ public:
      */
     bool inTransaction();
 
+    /** @brief set the number of held events after which further events are
+     * appended to the log
+     */
+    void setSpillThreshold( size_t numberOfEvents ) { mSpillThreshold = numberOfEvents; }
+    size_t getSpillThreshold() const { return mSpillThreshold; }
+
+    /** @brief return the number of events which are currently held
+     */
+    size_t getNumberOfPendingEvents() const { return mEvents.size() + mLog.size(); }
+
 private:
-    void addEvent( ObserverEvent event );
-    void emitEvent( ObserverEvent event );
+    /// Entry of the event log
+    struct LoggedEvent
+    {
+        GraphElement::WeakPtr element;
+        GraphId origin;
+        EventType event;
+    };
+
+    void addEvent( const ObserverEvent& event );
+    void logEvent( const ObserverEvent& event );
+    void emitEvent( const ObserverEvent& event );
+    void emitEvents();
+    void emitLog();
+
+    ObserverEventBatch mEvents;
+    std::vector<LoggedEvent> mLog;
+    /// Elements which have been removed while logging -- they are kept until
+    /// the log has been emitted
+    std::vector<GraphElement::Ptr> mRemovedElements;
+    size_t mSpillThreshold;
 
-    std::vector<ObserverEvent> mEvents;
     BaseGraphObserver::Ptr mpObserver;
     int mTransactionLevel;
 
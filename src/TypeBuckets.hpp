@@ -0,0 +1,224 @@
+#ifndef GRAPH_ANALYSIS_TYPE_BUCKETS_HPP
+#define GRAPH_ANALYSIS_TYPE_BUCKETS_HPP
+
+#include <limits>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+#include "SharedPtr.hpp"
+#include "GraphElement.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file TypeBuckets.hpp
+ * \class TypeBuckets
+ * \brief Index of the vertices or edges of a graph by their class
+ * \details Elements are stored contiguously in one bucket per class, so that
+ * all elements of a class can be retrieved in O(k). Membership of a bucket
+ * is tested once per bucket and query, so that no dynamic cast per element
+ * is required. Elements are added and removed in O(1) via their id, removal
+ * does not preserve the order within a bucket.
+ */
+template<typename T>
+class TypeBuckets
+{
+public:
+    typedef shared_ptr<T> ElementPtr;
+    typedef std::vector<ElementPtr> ElementList;
+
+    static const size_t npos = std::numeric_limits<size_t>::max();
+
+    /**
+     * Add an element with the given id
+     */
+    void add(GraphElementId id, const ElementPtr& element)
+    {
+        size_t bucketIndex = getOrCreateBucket(std::type_index(typeid(*element)));
+        if(id >= mPositions.size())
+        {
+            mPositions.resize(id + 1);
+        }
+
+        Bucket& bucket = mBuckets[bucketIndex];
+        mPositions[id] = Position(bucketIndex, bucket.elements.size());
+        bucket.elements.push_back(element);
+        bucket.ids.push_back(id);
+    }
+
+    /**
+     * Remove the element with the given id -- ignores unknown ids
+     */
+    void remove(GraphElementId id)
+    {
+        if(id >= mPositions.size() || mPositions[id].bucket == npos)
+        {
+            return;
+        }
+
+        Position position = mPositions[id];
+        Bucket& bucket = mBuckets[position.bucket];
+        GraphElementId lastId = bucket.ids.back();
+        bucket.elements[position.index] = bucket.elements.back();
+        bucket.ids[position.index] = lastId;
+        mPositions[lastId].index = position.index;
+        bucket.elements.pop_back();
+        bucket.ids.pop_back();
+        mPositions[id] = Position();
+    }
+
+    /**
+     * Remove all elements
+     */
+    void clear()
+    {
+        mBuckets.clear();
+        mPositions.clear();
+    }
+
+    /**
+     * Get the element with the given id
+     * \return the element or an empty pointer, if the id is unknown
+     */
+    ElementPtr getElement(GraphElementId id) const
+    {
+        size_t bucketIndex = getBucketIndex(id);
+        if(bucketIndex == npos)
+        {
+            return ElementPtr();
+        }
+        return mBuckets[bucketIndex].elements[mPositions[id].index];
+    }
+
+    /**
+     * Get the index of the bucket the element with the given id belongs to
+     * \return the bucket index or npos, if the id is unknown
+     */
+    size_t getBucketIndex(GraphElementId id) const
+    {
+        return id < mPositions.size() ? mPositions[id].bucket : npos;
+    }
+
+    /**
+     * Get the number of buckets
+     */
+    size_t getNumberOfBuckets() const { return mBuckets.size(); }
+
+    /**
+     * Get the elements of a bucket
+     */
+    const ElementList& getBucket(size_t bucketIndex) const { return mBuckets.at(bucketIndex).elements; }
+
+    /**
+     * Get the class of the elements of a bucket
+     */
+    const std::type_index& getBucketType(size_t bucketIndex) const { return mBuckets.at(bucketIndex).type; }
+
+    /**
+     * Get the elements of exactly the given class
+     */
+    const ElementList& getElementsOfClass(const std::type_index& type) const
+    {
+        for(size_t i = 0; i < mBuckets.size(); ++i)
+        {
+            if(mBuckets[i].type == type)
+            {
+                return mBuckets[i].elements;
+            }
+        }
+        return msEmptyList;
+    }
+
+    /**
+     * Test for each bucket, whether its elements are of type U (or a
+     * subclass of U)
+     */
+    template<typename U>
+    std::vector<bool> getMatchingBuckets() const
+    {
+        std::vector<bool> matching(mBuckets.size(), false);
+        for(size_t i = 0; i < mBuckets.size(); ++i)
+        {
+            const Bucket& bucket = mBuckets[i];
+            matching[i] = !bucket.elements.empty() && dynamic_cast<const U*>(bucket.elements.front().get());
+        }
+        return matching;
+    }
+
+    /**
+     * Get all elements of type U (or a subclass of U)
+     */
+    template<typename U>
+    std::vector< shared_ptr<U> > getElements() const
+    {
+        std::vector< shared_ptr<U> > elements;
+        std::vector<bool> matching = getMatchingBuckets<U>();
+        for(size_t i = 0; i < mBuckets.size(); ++i)
+        {
+            if(matching[i])
+            {
+                const ElementList& bucket = mBuckets[i].elements;
+                elements.reserve(elements.size() + bucket.size());
+                for(size_t e = 0; e < bucket.size(); ++e)
+                {
+                    elements.push_back(static_pointer_cast<U>(bucket[e]));
+                }
+            }
+        }
+        return elements;
+    }
+
+private:
+    struct Position
+    {
+        Position(size_t bucket = npos, size_t index = 0)
+            : bucket(bucket)
+            , index(index)
+        {}
+
+        size_t bucket;
+        size_t index;
+    };
+
+    struct Bucket
+    {
+        Bucket(const std::type_index& type)
+            : type(type)
+        {}
+
+        std::type_index type;
+        ElementList elements;
+        /// Ids of the elements, to update the positions on removal
+        std::vector<GraphElementId> ids;
+    };
+
+    size_t getOrCreateBucket(const std::type_index& type)
+    {
+        // The number of classes per graph is small, so a linear search is
+        // sufficient
+        for(size_t i = 0; i < mBuckets.size(); ++i)
+        {
+            if(mBuckets[i].type == type)
+            {
+                return i;
+            }
+        }
+        mBuckets.push_back(Bucket(type));
+        return mBuckets.size() - 1;
+    }
+
+    std::vector<Bucket> mBuckets;
+    /// Position of the elements, indexed by id
+    std::vector<Position> mPositions;
+
+    static const ElementList msEmptyList;
+};
+
+template<typename T>
+const size_t TypeBuckets<T>::npos;
+
+template<typename T>
+const typename TypeBuckets<T>::ElementList TypeBuckets<T>::msEmptyList;
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_TYPE_BUCKETS_HPP
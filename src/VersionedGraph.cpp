@@ -0,0 +1,34 @@
+#include "VersionedGraph.hpp"
+#include <stdexcept>
+
+namespace graph_analysis {
+
+VersionedGraph::VersionedGraph(const BaseGraph::Ptr& graph)
+    : mGraph(graph)
+{
+    if(!mGraph)
+    {
+        throw std::invalid_argument("graph_analysis::VersionedGraph: graph is not set");
+    }
+    std::atomic_store(&mSnapshot, GraphSnapshot::create(*mGraph));
+}
+
+GraphSnapshot::ConstPtr VersionedGraph::publish()
+{
+    // Only the writer replaces the snapshot, so no atomic access is required here
+    if(mSnapshot->getVersion() == mGraph->version())
+    {
+        return mSnapshot;
+    }
+
+    GraphSnapshot::ConstPtr snapshot = GraphSnapshot::create(*mGraph);
+    std::atomic_store(&mSnapshot, snapshot);
+    return snapshot;
+}
+
+GraphSnapshot::ConstPtr VersionedGraph::acquire() const
+{
+    return std::atomic_load(&mSnapshot);
+}
+
+} // end namespace graph_analysis
@@ -0,0 +1,70 @@
+#ifndef GRAPH_ANALYSIS_VERSIONED_GRAPH_HPP
+#define GRAPH_ANALYSIS_VERSIONED_GRAPH_HPP
+
+#include "GraphSnapshot.hpp"
+
+namespace graph_analysis {
+
+/**
+ * \file VersionedGraph.hpp
+ * \class VersionedGraph
+ * \brief Concurrent reading of a graph, which is modified by a single writer
+ * \details The writer modifies the graph and publishes its current state as
+ * new epoch, i.e. an immutable GraphSnapshot. Readers pin an epoch by acquiring
+ * the latest snapshot and see a consistent view of the graph as long as they
+ * hold it, without any further synchronization with the writer. A snapshot is
+ * released when the last reader drops it.
+ *
+ * Publishing is cheap when the graph has not been modified since the last
+ * epoch (see BaseGraph::version), otherwise the snapshot is rebuilt in a
+ * single linear pass over the graph.
+ *
+ \verbatim
+    VersionedGraph versioned(graph);
+
+    // writer thread
+    graph->addEdge(edge);
+    versioned.publish();
+
+    // reader threads
+    GraphSnapshot::ConstPtr snapshot = versioned.acquire();
+ \endverbatim
+ */
+class VersionedGraph
+{
+public:
+    typedef shared_ptr<VersionedGraph> Ptr;
+
+    /**
+     * Create the versioned graph and publish the first epoch
+     * \details Has to be called from the writer thread
+     */
+    VersionedGraph(const BaseGraph::Ptr& graph);
+
+    /**
+     * Get the graph -- only the writer thread may access it
+     */
+    const BaseGraph::Ptr& getGraph() const { return mGraph; }
+
+    /**
+     * Publish the current state of the graph as new epoch, if it has been
+     * modified since the last epoch
+     * \details Has to be called from the writer thread
+     * \return the latest snapshot
+     */
+    GraphSnapshot::ConstPtr publish();
+
+    /**
+     * Get the snapshot of the latest published epoch
+     * \details Can be called from any thread
+     */
+    GraphSnapshot::ConstPtr acquire() const;
+
+private:
+    BaseGraph::Ptr mGraph;
+    /// Latest snapshot, accessed atomically only
+    GraphSnapshot::ConstPtr mSnapshot;
+};
+
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_VERSIONED_GRAPH_HPP
@@ -1,5 +1,7 @@
 #include "Vertex.hpp"
+#include <typeinfo>
 #include "BaseGraph.hpp"
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
@@ -15,6 +17,23 @@ Vertex::Ptr Vertex::clone() const
     return vertex;
 }
 
+Vertex::Ptr Vertex::clone(GraphArena& arena) const
+{
+    Vertex::Ptr vertex = getClone(arena);
+    vertex->disassociateFromAll();
+    return vertex;
+}
+
+Vertex::Ptr Vertex::getClone(GraphArena& arena) const
+{
+    if(typeid(*this) != typeid(Vertex))
+    {
+        // Subclass which does not support arena allocation
+        return Vertex::Ptr( getClone() );
+    }
+    return arena.create<Vertex>(*this);
+}
+
 Vertex::Ptr Vertex::getSharedPointerFromGraph(const shared_ptr<BaseGraph> &pGraph) const
 {
     return const_pointer_cast<Vertex>( getPtr() );
@@ -38,9 +57,9 @@ std::string Vertex::toString() const
 std::string Vertex::toString(uint32_t indent) const
 {
     std::string hspace(indent,' ');
-    if(!mLabel.empty())
+    if(getLabelSymbol() != SymbolTable::EMPTY)
     {
-        return hspace + mLabel;
+        return hspace + SymbolTable::resolve(getLabelSymbol());
     }
     else
     {
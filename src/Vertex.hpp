@@ -10,6 +10,7 @@ namespace graph_analysis
 
 class BaseGraph;
 class VertexTypeManager;
+class GraphArena;
 
 /**
  * \brief A vertex inherited to allow storing data of any type
@@ -34,6 +35,12 @@ public:
      */
     Vertex::Ptr clone() const;
 
+    /**
+     * Clone this vertex into the given arena -- the returned vertex will have
+     * no graph association
+     */
+    Vertex::Ptr clone(GraphArena& arena) const;
+
     /** Get class name
      * \return class name
      */
@@ -102,9 +109,22 @@ protected:
      \verbatim
      return new MyVertex(*this);
      \endverbatim
+     * If parallel cloning is enabled for a graph (see
+     * BaseGraph::setParallelCloneEnabled), this method is called concurrently
+     * for different vertices and must therefore be thread-safe
      */
     virtual Vertex* getClone() const { return new Vertex(*this); }
 
+    /**
+     * Create a copy of this vertex in the given arena
+     * \details Subclasses should override this method as well
+     \verbatim
+     return arena.create<MyVertex>(*this);
+     \endverbatim
+     * otherwise the copy is created on the heap using getClone()
+     */
+    virtual Vertex::Ptr getClone(GraphArena& arena) const;
+
 };
 
 } // end namespace graph_analysis
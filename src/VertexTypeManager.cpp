@@ -1,13 +1,16 @@
 #include "VertexTypeManager.hpp"
 
+#include <sstream>
 #include <boost/assign/list_of.hpp>
 #include <base-logging/Logging.hpp>
+#include "GraphArena.hpp"
 
 namespace graph_analysis {
 
 VertexTypeManager::VertexTypeManager()
     : base::Singleton<VertexTypeManager>()
     , AttributeManager()
+    , mPrototypes(NULL)
 {
     Vertex::Ptr vertex(new Vertex());
     registerType(vertex);
@@ -15,13 +18,13 @@ VertexTypeManager::VertexTypeManager()
 
 }
 
-void VertexTypeManager::registerType(const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered)
+vertex::TypeId VertexTypeManager::registerType(const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered)
 {
     //Create a empty structure for this type to make sure getAttributes raise if a unregistered vertex type is queried
-    registerType(vertex->getClassName(), vertex, throwOnAlreadyRegistered);
+    return registerType(vertex->getClassName(), vertex, throwOnAlreadyRegistered);
 }
 
-void VertexTypeManager::registerType(const vertex::Type& type, const Vertex::Ptr& node, bool throwOnAlreadyRegistered)
+vertex::TypeId VertexTypeManager::registerType(const vertex::Type& type, const Vertex::Ptr& node, bool throwOnAlreadyRegistered)
 {
     assert(node);
 
@@ -33,26 +36,76 @@ void VertexTypeManager::registerType(const vertex::Type& type, const Vertex::Ptr
             node->getClassName() + "'");
     }
 
-    try {
-        vertexByType(type, true);
+    // Check the clone function once, so that vertices can be created by
+    // type id without checking each clone
+    Prototype prototype;
+    prototype.vertex = node;
+    prototype.validClone = node->clone()->getClassName() == type;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::map<vertex::Type, vertex::TypeId>::const_iterator cit = mTypeIds.find(type);
+    if(cit != mTypeIds.end())
+    {
         LOG_INFO_S << "VertexType '" + type + "' is already registered.";
-    } catch(...)
+        if(throwOnAlreadyRegistered)
+        {
+            throw std::runtime_error("graph_analysis::VertexTypeManager::registerType: type '" + type + "' is already registered");
+        }
+        return cit->second;
+    }
+
+    LOG_INFO_S << "VertexType '" + type + "' is newly registered";
+    mTypeMap[type] = node;
+    mRegisteredTypes.insert(type);
+
+    // Publish a new list of prototypes, the previous list is kept alive for
+    // concurrent readers
+    const PrototypeList* prototypes = mPrototypes.load();
+    shared_ptr<PrototypeList> extendedPrototypes = prototypes ? make_shared<PrototypeList>(*prototypes) : make_shared<PrototypeList>();
+    vertex::TypeId typeId = extendedPrototypes->size();
+    extendedPrototypes->push_back(prototype);
+    mPrototypeLists.push_back(extendedPrototypes);
+    mPrototypes.store(extendedPrototypes.get());
+    mTypeIds[type] = typeId;
+
+    activateAttributedType(type);
+    return typeId;
+}
+
+vertex::TypeId VertexTypeManager::getTypeId(const vertex::Type& type) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::map<vertex::Type, vertex::TypeId>::const_iterator cit = mTypeIds.find(type);
+    if(cit == mTypeIds.end())
     {
-        LOG_INFO_S << "VertexType '" + type + "' is newly registered";
-        mTypeMap[type] = node;
-        mRegisteredTypes.insert(type);
+        throw std::invalid_argument("graph_analysis::VertexTypeManager::getTypeId: type '" + type + "' is not registered");
+    }
+    return cit->second;
+}
 
-        activateAttributedType(type);
-        return;
+const Vertex::Ptr& VertexTypeManager::prototype(vertex::TypeId typeId) const
+{
+    const PrototypeList* prototypes = mPrototypes.load();
+    if(!prototypes || typeId >= prototypes->size())
+    {
+        std::stringstream ss;
+        ss << "graph_analysis::VertexTypeManager: unknown type id " << typeId;
+        throw std::invalid_argument(ss.str());
     }
-    if(throwOnAlreadyRegistered)
+
+    const Prototype& prototype = (*prototypes)[typeId];
+    if(!prototype.validClone)
     {
-        throw std::runtime_error("graph_analysis::VertexTypeManager::registerType: type '" + type + "' is already registered");
+        std::string msg = "graph_analysis::VertexTypeManager: cannot create cloned vertex of type " + prototype.vertex->getClassName() + " it seems the 'virtual Vertex* getClone() const' function of this class is implemented wrong";
+        LOG_WARN_S << msg;
+        throw std::runtime_error(msg);
     }
+    return prototype.vertex;
 }
 
 Vertex::Ptr VertexTypeManager::vertexByType(const vertex::Type& type, bool throwOnDefault)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     TypeMap::const_iterator it = mTypeMap.find(type);
     if(it == mTypeMap.end())
     {
@@ -71,6 +124,7 @@ Vertex::Ptr VertexTypeManager::vertexByType(const vertex::Type& type, bool throw
 
 void VertexTypeManager::setDefaultType(const std::string& defaultType)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     if( std::find(mRegisteredTypes.begin(), mRegisteredTypes.end(), defaultType) == mRegisteredTypes.end())
     {
         throw std::runtime_error("graph_analysis::VertexTypeManager::setDefaultVertexType: type '"
@@ -98,8 +152,66 @@ Vertex::Ptr VertexTypeManager::createVertex(const vertex::Type& type, const std:
     return clonedVertex;
 }
 
+Vertex::Ptr VertexTypeManager::createVertex(const vertex::Type& type, const std::string& label, GraphArena& arena, bool throwOnMissing)
+{
+    Vertex::Ptr v = vertexByType(type, throwOnMissing);
+    if(!v){
+        throw std::invalid_argument("graph_analysis::VertexTypeManager: cannot get node for type: " + type + " and label " + label);
+    }
+    Vertex::Ptr clonedVertex = v->clone(arena);
+    if(v->getClassName() != clonedVertex->getClassName())
+    {
+        std::stringstream ss;
+        ss << "graph_analysis::VertexTypeManager: cannot create cloned vertex of type " + v->getClassName() + " it seems the 'virtual Vertex::Ptr getClone(GraphArena&) const' function of this class is implemented wrong";
+        LOG_WARN_S << ss.str();
+        throw std::runtime_error(ss.str());
+    }
+
+    clonedVertex->setLabel(label);
+    return clonedVertex;
+}
+
+Vertex::Ptr VertexTypeManager::createVertex(vertex::TypeId typeId, const std::string& label) const
+{
+    Vertex::Ptr clonedVertex = prototype(typeId)->clone();
+    clonedVertex->setLabel(label);
+    return clonedVertex;
+}
+
+Vertex::Ptr VertexTypeManager::createVertex(vertex::TypeId typeId, const std::string& label, GraphArena& arena) const
+{
+    Vertex::Ptr clonedVertex = prototype(typeId)->clone(arena);
+    clonedVertex->setLabel(label);
+    return clonedVertex;
+}
+
+std::vector<Vertex::Ptr> VertexTypeManager::createVertices(vertex::TypeId typeId, size_t numberOfVertices) const
+{
+    const Vertex::Ptr& vertex = prototype(typeId);
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(numberOfVertices);
+    for(size_t i = 0; i < numberOfVertices; ++i)
+    {
+        vertices.push_back(vertex->clone());
+    }
+    return vertices;
+}
+
+std::vector<Vertex::Ptr> VertexTypeManager::createVertices(vertex::TypeId typeId, size_t numberOfVertices, GraphArena& arena) const
+{
+    const Vertex::Ptr& vertex = prototype(typeId);
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(numberOfVertices);
+    for(size_t i = 0; i < numberOfVertices; ++i)
+    {
+        vertices.push_back(vertex->clone(arena));
+    }
+    return vertices;
+}
+
 std::set<std::string> VertexTypeManager::getSupportedTypes()
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mRegisteredTypes;
 }
 
@@ -1,7 +1,9 @@
 #ifndef GRAPH_ANALYSIS_VERTEX_TYPE_MANAGER_HPP
 #define GRAPH_ANALYSIS_VERTEX_TYPE_MANAGER_HPP
 
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <base-logging/Singleton.hpp>
@@ -14,6 +16,8 @@ namespace graph_analysis {
 namespace vertex {
     // datatype for vertex type specification
     typedef std::string Type;
+    // interned vertex type, see VertexTypeManager::getTypeId
+    typedef uint32_t TypeId;
 } // end namespace vertex
 
 /**
@@ -24,6 +28,17 @@ namespace vertex {
  * the VertexTypeManager allows to instanciate vertices corresponding to the
  * given class type -- which has to match the type string.
  * Instanciation is done via cloning the corresponding vertex instance.
+ *
+ * Registering a type returns a TypeId, which allows to create vertices
+ * without looking up the type by name. Registration and creation of vertices
+ * are thread-safe, creation via TypeId does not lock.
+ \verbatim
+    VertexTypeManager* vManager = VertexTypeManager::getInstance();
+    vertex::TypeId typeId = vManager->registerType(Vertex::Ptr(new MyVertex()));
+
+    GraphArena arena;
+    std::vector<Vertex::Ptr> vertices = vManager->createVertices(typeId, 1000, arena);
+ \endverbatim
  */
 class VertexTypeManager : public base::Singleton<VertexTypeManager>, public AttributeManager
 {
@@ -37,6 +52,27 @@ private:
     /// registration list - maintains a complete list of all registered types
     std::set<std::string> mRegisteredTypes;
     std::string mDefaultVertexType;
+    /// interned types
+    std::map<vertex::Type, vertex::TypeId> mTypeIds;
+
+    struct Prototype
+    {
+        Vertex::Ptr vertex;
+        /// whether cloning the vertex yields the registered type
+        bool validClone;
+    };
+    typedef std::vector<Prototype> PrototypeList;
+    /// example vertex instances indexed by type id, replaced on registration
+    /// so that readers do not need to lock
+    std::atomic<const PrototypeList*> mPrototypes;
+    /// all versions of the prototype list, since readers might still use
+    /// an outdated one
+    std::vector< shared_ptr<const PrototypeList> > mPrototypeLists;
+    /// guards the registration and lookup by type name
+    mutable std::mutex mMutex;
+
+    /// Get the example vertex instance of the given type id
+    const Vertex::Ptr& prototype(vertex::TypeId typeId) const;
 
     /**
      * \brief internal method for type identification
@@ -63,10 +99,18 @@ public:
     const std::string& getDefaultType() const { return mDefaultVertexType; }
 
     // Register vertex class
-    void registerType(const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered = false);
+    // \return the type id of the vertex class
+    vertex::TypeId registerType(const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered = false);
 
     // Register vertex class
-    void registerType(const vertex::Type& type, const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered = false);
+    // \return the type id of the vertex class
+    vertex::TypeId registerType(const vertex::Type& type, const Vertex::Ptr& vertex, bool throwOnAlreadyRegistered = false);
+
+    /**
+     * Get the type id of a registered type
+     * \throw std::invalid_argument if the type is not registered
+     */
+    vertex::TypeId getTypeId(const vertex::Type& type) const;
 
     /**
      * \brief clones a new vertex of a specified type
@@ -79,6 +123,48 @@ public:
     Vertex::Ptr createVertex(const vertex::Type& type, const std::string& label = std::string(),
             bool throwOnMissing = false);
 
+    /**
+     * \brief clones a new vertex of a specified type into the given arena
+     * \param type the requested vertex type
+     * \param label the requested vertex label
+     * \param arena the arena the vertex is allocated from
+     * \param throwOnMissing Throw exception when the vertex type is unknown,
+     * otherwise a default vertex will be created
+     * \return smart pointer to the newly created vertex instance
+     */
+    Vertex::Ptr createVertex(const vertex::Type& type, const std::string& label,
+            GraphArena& arena, bool throwOnMissing = false);
+
+    /**
+     * \brief clones a new vertex of a registered type
+     * \param typeId the requested vertex type, see registerType
+     * \param label the requested vertex label
+     * \return smart pointer to the newly created vertex instance
+     * \throw std::invalid_argument if the type id is unknown
+     */
+    Vertex::Ptr createVertex(vertex::TypeId typeId, const std::string& label = std::string()) const;
+
+    /**
+     * \brief clones a new vertex of a registered type into the given arena
+     * \see createVertex(vertex::TypeId, const std::string&)
+     */
+    Vertex::Ptr createVertex(vertex::TypeId typeId, const std::string& label, GraphArena& arena) const;
+
+    /**
+     * \brief clones a number of vertices of a registered type
+     * \param typeId the requested vertex type, see registerType
+     * \param numberOfVertices the number of vertices to create
+     * \throw std::invalid_argument if the type id is unknown
+     */
+    std::vector<Vertex::Ptr> createVertices(vertex::TypeId typeId, size_t numberOfVertices) const;
+
+    /**
+     * \brief clones a number of vertices of a registered type into the given
+     * arena, i.e. the vertices are allocated contiguously
+     * \see createVertices(vertex::TypeId, size_t)
+     */
+    std::vector<Vertex::Ptr> createVertices(vertex::TypeId typeId, size_t numberOfVertices, GraphArena& arena) const;
+
     /**
      * Lists the registered types
      * \return list of registered types
@@ -43,7 +43,7 @@ void CorrelationClustering::prepare()
         // Set the coefficient for this column, i.e. the weight
         Edge::Ptr edgePtr = edgeIt->current();
 
-        double weight = mEdgeWeightFunction(edgePtr);
+        double weight = mEdgeWeights(edgePtr);
         glp_set_obj_coef(mpProblem, col, weight);
 
         mColumnToEdge.push_back(edgePtr);
@@ -201,7 +201,7 @@ double CorrelationClustering::cut(Ball ball)
                 if(!ball.graph->contains(edge->getSourceVertex()) || !ball.graph->contains(edge->getTargetVertex()))
                 {
                     // Check if this a positive edge
-                    double edgeWeight = mEdgeWeightFunction(edge);
+                    double edgeWeight = mEdgeWeights(edge);
                     if(edgeWeight > 0)
                     {
                          sumOfCutPositiveEdges += edgeWeight;
@@ -236,7 +236,7 @@ double CorrelationClustering::volume(Ball ball)
         {
             Edge::Ptr edge = edgeIt->current();
             // Check if this a positive edge
-            double edgeWeight = mEdgeWeightFunction(edge);
+            double edgeWeight = mEdgeWeights(edge);
             if(edgeWeight > 0)
             {
                 // Check if this is a cut edge
@@ -440,10 +440,19 @@ void CorrelationClustering::round()
 }
 
 CorrelationClustering::CorrelationClustering(BaseGraph::Ptr graph, EdgeWeightFunction weightfunction)
+    : CorrelationClustering(graph, WeightColumn(graph, weightfunction))
+{}
+
+CorrelationClustering::CorrelationClustering(BaseGraph::Ptr graph, const WeightColumn& edgeWeights)
     : mpGraph(graph)
-    , mEdgeWeightFunction(weightfunction)
+    , mEdgeWeights(edgeWeights)
     , mpProblem(NULL)
 {
+    if(edgeWeights.getGraph() != graph)
+    {
+        throw std::invalid_argument("graph_analysis::algorithms::CorrelationClustering: edge weights belong to another graph");
+    }
+
     Ball ball;
     ball.graph = mpGraph;
     // Prevent premature use of radius in volume(S)
@@ -8,13 +8,12 @@
 #include "../EdgeIterator.hpp"
 #include "../Graph.hpp"
 #include "../SharedPtr.hpp"
+#include "WeightColumn.hpp"
 
 
 namespace graph_analysis {
 namespace algorithms {
 
-typedef function1<double, Edge::Ptr> EdgeWeightFunction;
-
 /**
  * \brief A Ball representation for the CorrelationClustering
  */
@@ -50,7 +49,8 @@ struct Ball
 class CorrelationClustering
 {
     BaseGraph::Ptr mpGraph;
-    EdgeWeightFunction mEdgeWeightFunction;
+    /// Edge weights, evaluated once per edge
+    WeightColumn mEdgeWeights;
 
     std::map<Edge::Ptr, double> mEdgeActivation;
     std::vector<Edge::Ptr> mColumnToEdge;
@@ -73,8 +73,20 @@ class CorrelationClustering
     bool areFormingTriangle(const std::vector<size_t>& triangleIndices) const;
 
 public:
+    /**
+     * Compute the clustering
+     * \param weightfunction function that allows retrieving the weight of an
+     * edge, it is called once per edge on the calling thread
+     */
     CorrelationClustering(BaseGraph::Ptr graph, EdgeWeightFunction weightfunction);
 
+    /**
+     * Compute the clustering using precomputed edge weights, e.g. evaluated
+     * in parallel (see WeightColumn)
+     * \throw std::invalid_argument if the weights belong to another graph
+     */
+    CorrelationClustering(BaseGraph::Ptr graph, const WeightColumn& edgeWeights);
+
     static std::string toString(const std::map<Edge::Ptr, double>& solution);
 
     void round();
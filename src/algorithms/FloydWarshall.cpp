@@ -22,6 +22,16 @@ double FloydWarshall::getDistanceLazy(DistanceMatrix& distanceMatrix, Vertex::Pt
 
 DistanceMatrix FloydWarshall::allShortestPaths(const BaseGraph::Ptr& graph, EdgeWeightFunction edgeWeightFunction, bool detectNegativeCycle)
 {
+    return allShortestPaths(graph, WeightColumn(graph, edgeWeightFunction), detectNegativeCycle);
+}
+
+DistanceMatrix FloydWarshall::allShortestPaths(const BaseGraph::Ptr& graph, const WeightColumn& edgeWeights, bool detectNegativeCycle)
+{
+    if(edgeWeights.getGraph() != graph)
+    {
+        throw std::invalid_argument("graph_analysis::algorithms::FloydWarshall::allShortestPaths: edge weights belong to another graph");
+    }
+
     DistanceMatrix distanceMatrix;
 
     // Initialize the distance matrix
@@ -36,7 +46,7 @@ DistanceMatrix FloydWarshall::allShortestPaths(const BaseGraph::Ptr& graph, Edge
     while(edgeIt->next())
     {
         Edge::Ptr edge = edgeIt->current();
-        distanceMatrix[ std::pair<Vertex::Ptr, Vertex::Ptr>(edge->getSourceVertex(), edge->getTargetVertex()) ] = edgeWeightFunction(edge);
+        distanceMatrix[ std::pair<Vertex::Ptr, Vertex::Ptr>(edge->getSourceVertex(), edge->getTargetVertex()) ] = edgeWeights(edge);
     }
 
     VertexIterator::Ptr i_vertexIt = graph->getVertexIterator();
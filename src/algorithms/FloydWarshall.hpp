@@ -4,12 +4,11 @@
 #include "../Edge.hpp"
 #include "../BaseGraph.hpp"
 #include "DistanceMatrix.hpp"
+#include "WeightColumn.hpp"
 
 namespace graph_analysis {
 namespace algorithms {
 
-typedef function1<double, Edge::Ptr> EdgeWeightFunction;
-
 /**
  * \brief Implements Floyd-Warshall algorithm
  * \param control exception throwing when a negative cycle is detected
@@ -24,11 +23,21 @@ public:
     /**
      * \param graph The graph to search on
      * \param edgeWeightFunction function that allows retrieving the weight of
-     * an edge
+     * an edge, it is called once per edge on the calling thread
      * \param detectNegativeCycle whether to throw as soon as a negative cycle
      * has been detected
      */
     static DistanceMatrix allShortestPaths(const BaseGraph::Ptr& graph, EdgeWeightFunction edgeWeightFunction, bool detectNegativeCycle = true);
+
+    /**
+     * \param graph The graph to search on
+     * \param edgeWeights weights of the edges of the graph, which can be
+     * reused for multiple calls (and evaluated in parallel, see WeightColumn)
+     * \param detectNegativeCycle whether to throw as soon as a negative cycle
+     * has been detected
+     * \throw std::invalid_argument if the weights belong to another graph
+     */
+    static DistanceMatrix allShortestPaths(const BaseGraph::Ptr& graph, const WeightColumn& edgeWeights, bool detectNegativeCycle = true);
 };
 
 } // end namespace algorithms
@@ -41,9 +41,10 @@ uint32_t MinCostFlow::run()
                 edge_t::Ptr edge = dynamic_pointer_cast< edge_t >(edgeIt->current());
                 assert(edge);
 
-                lowerMap[diGraph->getArc(edge)] = edge->getWeight(LOWER_BOUND);
-                upperMap[diGraph->getArc(edge)] = edge->getWeight(UPPER_BOUND);
-                costMap[diGraph->getArc(edge)]  = edge->getWeight(COST);
+                graph_analysis::lemon::DirectedGraph::graph_t::Arc arc = diGraph->getArc(edge);
+                lowerMap[arc] = edge->getWeight<LOWER_BOUND>();
+                upperMap[arc] = edge->getWeight<UPPER_BOUND>();
+                costMap[arc]  = edge->getWeight<COST>();
             }
 
             NodeMap supplyMap(diGraph->raw());
@@ -53,7 +54,7 @@ uint32_t MinCostFlow::run()
             {
                 vertex_t::Ptr vertex = dynamic_pointer_cast< vertex_t >(vertexIt->current());
                 assert(vertex);
-                supplyMap[diGraph->getNode(vertex)] = (supply_t) vertex->getWeight(SUPPLY_DEMAND);
+                supplyMap[diGraph->getNode(vertex)] = (supply_t) vertex->getWeight<SUPPLY_DEMAND>();
             }
 
             typedef ::lemon::NetworkSimplex<graph_analysis::lemon::DirectedGraph::graph_t, value_and_cost_t> NetworkSimplex;
@@ -79,7 +80,7 @@ uint32_t MinCostFlow::run()
                         edge_t::Ptr edge = dynamic_pointer_cast< edge_t >(edgeIt->current());
                         assert(edge);
 
-                        edge->setWeight( simplex.flow( diGraph->getArc(edge)), RESULT_FLOW );
+                        edge->setWeight<RESULT_FLOW>( simplex.flow( diGraph->getArc(edge)) );
                     }
 
                     VertexIterator::Ptr vertexIt = mpGraph->getVertexIterator();
@@ -87,7 +88,7 @@ uint32_t MinCostFlow::run()
                     {
                         vertex_t::Ptr vertex = dynamic_pointer_cast< vertex_t >(vertexIt->current());
                         assert(vertex);
-                        vertex->setWeight( simplex.potential( diGraph->getNode(vertex) ), RESULT_POTENTIAL);
+                        vertex->setWeight<RESULT_POTENTIAL>( simplex.potential( diGraph->getNode(vertex) ) );
                     }
 
                     return simplex.totalCost();
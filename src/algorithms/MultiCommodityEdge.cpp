@@ -6,12 +6,14 @@
 #include <boost/serialization/vector.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
-
+#include "../io/AttributeCodec.hpp"
+#include "../BaseGraph.hpp"
 
 namespace graph_analysis {
 namespace algorithms {
 
 const EdgeRegistration<MultiCommodityEdge> MultiCommodityEdge::msRegistration;
+const std::string MultiCommodityEdge::CAPACITY_UPPER_BOUND_COLUMN = "capacityUpperBound";
 
 MultiCommodityEdge::MultiCommodityEdge(const std::string& label)
     : Edge(label)
@@ -31,11 +33,13 @@ MultiCommodityEdge::~MultiCommodityEdge()
 
 void MultiCommodityEdge::setCommodityCapacityUpperBound(uint32_t commodity, uint32_t capacity)
 {
+    restoreAttributes();
     mCommodityCapacityUpperBound.at(commodity) = capacity;
 }
 
 std::string MultiCommodityEdge::toString() const
 {
+    restoreAttributes();
     std::stringstream ss;
     ss << getClassName() << ": UB:" << mCapacityUpperBound << std::endl;
     for(size_t i = 0; i < numberOfCommodities(); ++i)
@@ -48,14 +52,64 @@ std::string MultiCommodityEdge::toString() const
 
 void MultiCommodityEdge::registerAttributes(EdgeTypeManager* eManager) const
 {
-    eManager->registerAttribute( getClassName(), "edge_attributes",
-       (io::AttributeSerializationCallbacks::serialize_func_t)&MultiCommodityEdge::serializeAttributes,
-       (io::AttributeSerializationCallbacks::deserialize_func_t)&MultiCommodityEdge::deserializeAttributes,
-        (io::AttributeSerializationCallbacks::print_func_t)&MultiCommodityEdge::serializeAttributes);
+    io::AttributeSerializationCallbacks callbacks = {
+        (io::AttributeSerializationCallbacks::serialize_func_t)&MultiCommodityEdge::serializeAttributes,
+        (io::AttributeSerializationCallbacks::deserialize_func_t)&MultiCommodityEdge::deserializeAttributes,
+        (io::AttributeSerializationCallbacks::print_func_t)&MultiCommodityEdge::serializeAttributes,
+        (io::AttributeSerializationCallbacks::serialize_func_t)&MultiCommodityEdge::serializeBinaryAttributes,
+        (io::AttributeSerializationCallbacks::deserialize_func_t)&MultiCommodityEdge::deserializeBinaryAttributes,
+        true
+    };
+    eManager->registerAttribute(getClassName(), "edge_attributes", callbacks);
+}
+
+std::string MultiCommodityEdge::getCommodityCapacityUpperBoundColumn(uint32_t commodity)
+{
+    std::stringstream ss;
+    ss << "commodityCapacityUpperBound" << commodity;
+    return ss.str();
+}
+
+std::string MultiCommodityEdge::getCommodityCostColumn(uint32_t commodity)
+{
+    std::stringstream ss;
+    ss << "commodityCost" << commodity;
+    return ss.str();
+}
+
+void MultiCommodityEdge::writeColumns(const BaseGraph& graph, uint32_t commodities, AttributeColumns& columns)
+{
+    AttributeColumn<int64_t>& capacityUpperBounds = columns.get<int64_t>(CAPACITY_UPPER_BOUND_COLUMN);
+    std::vector<AttributeColumn<int64_t>*> commodityCapacityUpperBounds;
+    std::vector<AttributeColumn<double>*> commodityCosts;
+    for(uint32_t k = 0; k < commodities; ++k)
+    {
+        commodityCapacityUpperBounds.push_back( &columns.get<int64_t>(getCommodityCapacityUpperBoundColumn(k)) );
+        commodityCosts.push_back( &columns.get<double>(getCommodityCostColumn(k)) );
+    }
+
+    EdgeIterator::Ptr edgeIt = graph.getEdgeIterator();
+    while(edgeIt->next())
+    {
+        MultiCommodityEdge::Ptr edge = dynamic_pointer_cast<MultiCommodityEdge>( edgeIt->current() );
+        if(!edge)
+        {
+            continue;
+        }
+
+        GraphElementId edgeId = graph.getEdgeId(edge);
+        capacityUpperBounds.set(edgeId, edge->getCapacityUpperBound());
+        for(uint32_t k = 0; k < commodities; ++k)
+        {
+            commodityCapacityUpperBounds[k]->set(edgeId, edge->getCommodityCapacityUpperBound(k));
+            commodityCosts[k]->set(edgeId, edge->getCommodityCost(k));
+        }
+    }
 }
 
 std::string MultiCommodityEdge::serializeAttributes() const
 {
+    restoreAttributes();
     std::stringstream ss;
     boost::archive::text_oarchive oarch(ss);
 
@@ -78,6 +132,29 @@ void MultiCommodityEdge::deserializeAttributes(const std::string& data)
     iarch >> mCommodityFlow;
 }
 
+std::string MultiCommodityEdge::serializeBinaryAttributes() const
+{
+    restoreAttributes();
+
+    io::AttributeEncoder encoder;
+    encoder << mCapacityUpperBound;
+    encoder << mCommodityCapacityUpperBound;
+    encoder << mCommodityCost;
+    encoder << mCommodityFlow;
+
+    return encoder.str();
+}
+
+void MultiCommodityEdge::deserializeBinaryAttributes(const std::string& data)
+{
+    io::AttributeDecoder decoder(data);
+
+    decoder >> mCapacityUpperBound;
+    decoder >> mCommodityCapacityUpperBound;
+    decoder >> mCommodityCost;
+    decoder >> mCommodityFlow;
+}
+
 
 } // end namespace algorithms
 } // end namespace graph_analysis
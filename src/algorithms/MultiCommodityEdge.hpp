@@ -3,8 +3,12 @@
 
 #include "../Edge.hpp"
 #include "../EdgeRegistration.hpp"
+#include "../AttributeColumn.hpp"
 
 namespace graph_analysis {
+
+class BaseGraph;
+
 namespace algorithms {
 
 /**
@@ -20,6 +24,9 @@ public:
     /// particular sets of commodites
     typedef std::map<CommoditySet, uint32_t> SubCapacityUpperBounds;
 
+    /// Name of the (int) edge column holding the general capacity bound
+    static const std::string CAPACITY_UPPER_BOUND_COLUMN;
+
     /**
      * Default constructor to support serialization
      */
@@ -50,13 +57,13 @@ public:
      * Set the general capacity bound for this edge
      * sum of all flows on this edge cannot exceed this bound
      */
-    void setCapacityUpperBound(uint32_t capacity) { mCapacityUpperBound = capacity; }
+    void setCapacityUpperBound(uint32_t capacity) { restoreAttributes(); mCapacityUpperBound = capacity; }
 
     /***
      * Get the general capacity bound for this edge
      * \return Upper capacity bound
      */
-    uint32_t getCapacityUpperBound() const { return mCapacityUpperBound; }
+    uint32_t getCapacityUpperBound() const { restoreAttributes(); return mCapacityUpperBound; }
 
     /**
      * Set the commodity specific bound for this edge, i.e.
@@ -70,54 +77,76 @@ public:
      * Get the commodity specific bound for this edge
      * \param commodity Index of the commodity
      */
-    uint32_t getCommodityCapacityUpperBound(uint32_t commodity) const { return mCommodityCapacityUpperBound.at(commodity); }
+    uint32_t getCommodityCapacityUpperBound(uint32_t commodity) const { restoreAttributes(); return mCommodityCapacityUpperBound.at(commodity); }
 
     /**
      * Set the cost for a particular commodity
      * \param commodity Index of the commodity
      * \param cost Cost for this commodity
      */
-    void setCommodityCost(uint32_t commodity, double cost) { mCommodityCost.at(commodity) = cost; }
+    void setCommodityCost(uint32_t commodity, double cost) { restoreAttributes(); mCommodityCost.at(commodity) = cost; }
 
     /**
      * Get the cost of the commodity with the given index
      * \param commodity Index of the commodity
      */
-    double getCommodityCost(uint32_t commodity) { return mCommodityCost.at(commodity); }
+    double getCommodityCost(uint32_t commodity) { restoreAttributes(); return mCommodityCost.at(commodity); }
 
     /**
      * Set the commodity flow (after a solution has been computed)
      * \param commodity Index of the commodity
      * \param flow (Integral) flow of this commodity
      */
-    void setCommodityFlow(uint32_t commodity, uint32_t flow) { mCommodityFlow.at(commodity) = flow; }
+    void setCommodityFlow(uint32_t commodity, uint32_t flow) { restoreAttributes(); mCommodityFlow.at(commodity) = flow; }
 
     /**
      * Set the commodity sub flow limit, i.e.
      */
-    void setSubCapacityUpperBound(const CommoditySet& commodities, uint32_t flow) { mSubCapacityUpperBounds[commodities] = flow; }
+    void setSubCapacityUpperBound(const CommoditySet& commodities, uint32_t flow) { restoreAttributes(); mSubCapacityUpperBounds[commodities] = flow; }
 
     /**
      * Get the existing flow limits
      */
-    const SubCapacityUpperBounds& getSubCapacityBounds() const { return mSubCapacityUpperBounds; }
+    const SubCapacityUpperBounds& getSubCapacityBounds() const { restoreAttributes(); return mSubCapacityUpperBounds; }
 
     /**
      * Get the assigned commodity flow
      * \return flow assigned to the commodity with the given index
      */
-    uint32_t getCommodityFlow(uint32_t commodity) const { return mCommodityFlow.at(commodity); }
+    uint32_t getCommodityFlow(uint32_t commodity) const { restoreAttributes(); return mCommodityFlow.at(commodity); }
 
     /**
      * Get the number of commodities in this optimization instance
      */
-    size_t numberOfCommodities() const { return mCommodityFlow.size(); }
+    size_t numberOfCommodities() const { restoreAttributes(); return mCommodityFlow.size(); }
 
     /**
-     * Register attributes for serialization
+     * Register attributes for serialization -- the attributes are
+     * deserialized on first access
      */
     virtual void registerAttributes(EdgeTypeManager*) const;
 
+    /**
+     * Get the name of the (int) edge column holding the capacity bound of
+     * the given commodity
+     */
+    static std::string getCommodityCapacityUpperBoundColumn(uint32_t commodity);
+
+    /**
+     * Get the name of the (double) edge column holding the cost of the given
+     * commodity
+     */
+    static std::string getCommodityCostColumn(uint32_t commodity);
+
+    /**
+     * Write capacity bounds and costs of all MultiCommodityEdges of the
+     * graph into the given edge columns (indexed by edge id)
+     * \param graph Graph whose edges are exported
+     * \param commodities Number of commodities to export
+     * \param columns Columns to fill, e.g. the edge columns of the graph
+     */
+    static void writeColumns(const BaseGraph& graph, uint32_t commodities, AttributeColumns& columns);
+
 private:
     /// Upper bound on the overall capacity
     uint32_t mCapacityUpperBound;
@@ -148,6 +177,16 @@ private:
      */
     void deserializeAttributes(const std::string& data);
 
+    /**
+     * Serialize all attributes of this edge in the binary encoding
+     */
+    std::string serializeBinaryAttributes() const;
+
+    /**
+     * Restore attributes of this edge from given binary data
+     */
+    void deserializeBinaryAttributes(const std::string& data);
+
 };
 
 } // end namespace algorithms
@@ -119,6 +119,23 @@ std::string MultiCommodityMinCostFlow::createProblemCPLEX()
     size_t col = columnBaseLine;
     size_t row = 1;
 
+    // Capacities and costs are read from the edge columns
+    AttributeColumns edgeColumns;
+    if(mpGraph->getEdgeColumns().has(MultiCommodityEdge::CAPACITY_UPPER_BOUND_COLUMN))
+    {
+        edgeColumns = mpGraph->getEdgeColumns();
+    } else {
+        MultiCommodityEdge::writeColumns(*mpGraph, mCommodities, edgeColumns);
+    }
+    const AttributeColumn<int64_t>& capacityUpperBounds = edgeColumns.get<int64_t>(MultiCommodityEdge::CAPACITY_UPPER_BOUND_COLUMN);
+    std::vector<const AttributeColumn<int64_t>*> commodityCapacityUpperBounds;
+    std::vector<const AttributeColumn<double>*> commodityCosts;
+    for(uint32_t k = 0; k < mCommodities; ++k)
+    {
+        commodityCapacityUpperBounds.push_back( &edgeColumns.get<int64_t>(MultiCommodityEdge::getCommodityCapacityUpperBoundColumn(k)) );
+        commodityCosts.push_back( &edgeColumns.get<double>(MultiCommodityEdge::getCommodityCostColumn(k)) );
+    }
+
     // columns: e0-k1 e0-k2 e0-k2 e0-k3 ... e1-k1 e1-k2 e1-k3 ...
     EdgeIterator::Ptr edgeIt = mpGraph->getEdgeIterator();
     while(edgeIt->next())
@@ -134,6 +151,7 @@ std::string MultiCommodityMinCostFlow::createProblemCPLEX()
         // Start column --> mColumnToEdge*numberOfCommodities + commodityOffset
         // commodityOffset := 1 .. K
         mColumnToEdge.push_back(edge);
+        GraphElementId edgeId = mpGraph->getEdgeId(edge);
 
         // Bound on total capacity
         std::stringstream rs;
@@ -142,7 +160,7 @@ std::string MultiCommodityMinCostFlow::createProblemCPLEX()
         lp::Row lpRow;
         lpRow.name = rs.str();
 
-        uint32_t capacityUpperBound = edge->getCapacityUpperBound();
+        int64_t capacityUpperBound = capacityUpperBounds.get(edgeId);
         if(capacityUpperBound == 0)
         {
             LOG_INFO_S
@@ -159,10 +177,10 @@ std::string MultiCommodityMinCostFlow::createProblemCPLEX()
 
             // Create column
             // set the bound for the column to 0 as lower and commodity capacity upper bound
-            uint32_t commodityCapacityUpperBound = edge->getCommodityCapacityUpperBound(k);
+            int64_t commodityCapacityUpperBound = commodityCapacityUpperBounds[k]->get(edgeId);
 
             lp::Column column;
-            double commodityCost = edge->getCommodityCost(k);
+            double commodityCost = commodityCosts[k]->get(edgeId);
             if(commodityCapacityUpperBound == 0)
             {
                 column = lp::Column(cs, lp::Bounds(0.0, 0.0, lp::Exact), commodityCost );
@@ -175,7 +193,7 @@ std::string MultiCommodityMinCostFlow::createProblemCPLEX()
             lp::MatrixEntry entry(cs, 1.0);
             lpRow.entries.push_back(entry);
 
-            LOG_DEBUG_S << "Adding column '" << cs << "' for edge: '" << edge->toString() << "' (id: " << mpGraph->getEdgeId(edge) << ") and commodity '" << k  << "' -- lb: 0.0, ub: " << edge->getCommodityCapacityUpperBound(k);
+            LOG_DEBUG_S << "Adding column '" << cs << "' for edge: '" << edge->toString() << "' (id: " << edgeId << ") and commodity '" << k  << "' -- lb: 0.0, ub: " << commodityCapacityUpperBound;
         }
         problem.addRow(lpRow);
 
@@ -209,6 +209,9 @@ public:
     /**
      * Creates the problem instance and return the temporary file in which the
      * problem is saved
+     * \details Capacity bounds and costs are read from the edge columns of
+     * the graph (see MultiCommodityEdge::CAPACITY_UPPER_BOUND_COLUMN), if the
+     * graph has them, otherwise from the MultiCommodityEdges themselves
      */
     std::string createProblem(LPSolver::ProblemFormat format = LPSolver::CPLEX);
 
@@ -6,6 +6,7 @@
 #include <boost/serialization/set.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include "../io/AttributeCodec.hpp"
 
 namespace graph_analysis {
 namespace algorithms {
@@ -29,6 +30,7 @@ MultiCommodityVertex::~MultiCommodityVertex() {}
 
 std::string MultiCommodityVertex::toString() const
 {
+    restoreAttributes();
     std::stringstream ss;
     {
         ss << getLabel() << "(" << getClassName() << ")" << " supply/demand: [";
@@ -74,14 +76,20 @@ std::string MultiCommodityVertex::toString() const
 
 void MultiCommodityVertex::registerAttributes(VertexTypeManager* vManager) const
 {
-    vManager->registerAttribute( getClassName(), "vertex_attributes",
+    io::AttributeSerializationCallbacks callbacks = {
             (io::AttributeSerializationCallbacks::serialize_func_t) &MultiCommodityVertex::serializeAttributes,
             (io::AttributeSerializationCallbacks::deserialize_func_t) &MultiCommodityVertex::deserializeAttributes,
-            (io::AttributeSerializationCallbacks::print_func_t) &MultiCommodityVertex::serializeAttributes);
+            (io::AttributeSerializationCallbacks::print_func_t) &MultiCommodityVertex::serializeAttributes,
+            (io::AttributeSerializationCallbacks::serialize_func_t) &MultiCommodityVertex::serializeBinaryAttributes,
+            (io::AttributeSerializationCallbacks::deserialize_func_t) &MultiCommodityVertex::deserializeBinaryAttributes,
+            true
+    };
+    vManager->registerAttribute(getClassName(), "vertex_attributes", callbacks);
 }
 
 std::string MultiCommodityVertex::serializeAttributes() const
 {
+    restoreAttributes();
     std::stringstream ss;
     boost::archive::text_oarchive oarch(ss);
 
@@ -104,9 +112,33 @@ void MultiCommodityVertex::deserializeAttributes(const std::string& data)
     iarch >> mCombinedCommoditiesInFlowBounds;
 }
 
+std::string MultiCommodityVertex::serializeBinaryAttributes() const
+{
+    restoreAttributes();
+
+    io::AttributeEncoder encoder;
+    encoder << mCommoditySupply;
+    encoder << mCommodityMinTransFlow;
+    encoder << mCommodityMaxTransFlow;
+    encoder << mCombinedCommoditiesInFlowBounds;
+
+    return encoder.str();
+}
+
+void MultiCommodityVertex::deserializeBinaryAttributes(const std::string& data)
+{
+    io::AttributeDecoder decoder(data);
+
+    decoder >> mCommoditySupply;
+    decoder >> mCommodityMinTransFlow;
+    decoder >> mCommodityMaxTransFlow;
+    decoder >> mCombinedCommoditiesInFlowBounds;
+}
+
 void MultiCommodityVertex::setCommoditiesMaxInFlow(const CommoditySet& commodities,
         uint32_t maxFlow)
 {
+    restoreAttributes();
     CombinedFlowBounds::iterator it = mCombinedCommoditiesInFlowBounds.find(commodities);
     if(it == mCombinedCommoditiesInFlowBounds.end())
     {
@@ -121,6 +153,7 @@ void MultiCommodityVertex::setCommoditiesMaxInFlow(const CommoditySet& commoditi
 void MultiCommodityVertex::setCommoditiesMinInFlow(const CommoditySet& commodities,
         uint32_t minFlow)
 {
+    restoreAttributes();
     CombinedFlowBounds::iterator it = mCombinedCommoditiesInFlowBounds.find(commodities);
     if(it == mCombinedCommoditiesInFlowBounds.end())
     {
@@ -33,13 +33,13 @@ public:
      * \param commodity Index of the commodity
      * \param supply (Integral) supply value of this commodity
      */
-    void setCommoditySupply(uint32_t commodity, int32_t supply) { mCommoditySupply.at(commodity) = supply; }
+    void setCommoditySupply(uint32_t commodity, int32_t supply) { restoreAttributes(); mCommoditySupply.at(commodity) = supply; }
 
     /**
      * Get the supply for a given commodity
      * \param commodity Index of the commodity
      */
-    int32_t getCommoditySupply(uint32_t commodity) const { return mCommoditySupply.at(commodity); }
+    int32_t getCommoditySupply(uint32_t commodity) const { restoreAttributes(); return mCommoditySupply.at(commodity); }
 
     /**
      * Set the inflow bounds (minimum/maximum) for a set of commodities, e.g.,
@@ -47,7 +47,7 @@ public:
      * \param commodities Set of commodities
      * \param minMaxFlow Pair of lower and upper bound
      */
-    void setCommoditiesInFlowBounds(const CommoditySet& commodities, std::pair<uint32_t,uint32_t> minMaxFlow) { mCombinedCommoditiesInFlowBounds[commodities] = minMaxFlow; }
+    void setCommoditiesInFlowBounds(const CommoditySet& commodities, std::pair<uint32_t,uint32_t> minMaxFlow) { restoreAttributes(); mCombinedCommoditiesInFlowBounds[commodities] = minMaxFlow; }
 
     /**
      * Set the upper bound for the inflow of a set of commodities, e.g.,
@@ -69,41 +69,42 @@ public:
     /**
      * Get the combined maximum inflows for a set of commodities
      */
-    const CombinedFlowBounds& getCommoditiesInFlowBounds() const { return mCombinedCommoditiesInFlowBounds; }
+    const CombinedFlowBounds& getCommoditiesInFlowBounds() const { restoreAttributes(); return mCombinedCommoditiesInFlowBounds; }
 
     /**
      * Request a trans-flow through this vertex for a given commodity
      * \param commodity Index of the commodity
      * \param flow (Integral) flow of the commodity
      */
-    void setCommodityMinTransFlow(uint32_t commodity, uint32_t flow) { mCommodityMinTransFlow.at(commodity) = flow; }
+    void setCommodityMinTransFlow(uint32_t commodity, uint32_t flow) { restoreAttributes(); mCommodityMinTransFlow.at(commodity) = flow; }
 
     /**
      * Request a maximum trans-flow through this vertex for a given commodity
      * \param commodity Index of the commodity
      * \param flow (Integral) flow of the commodity
      */
-    void setCommodityMaxTransFlow(uint32_t commodity, uint32_t flow) { mCommodityMaxTransFlow.at(commodity) = flow; }
+    void setCommodityMaxTransFlow(uint32_t commodity, uint32_t flow) { restoreAttributes(); mCommodityMaxTransFlow.at(commodity) = flow; }
 
     /**
      * Retrieve the set trans-flow through this vertex for a given commodity
      * \param commodity Index of the commodity
      * \return minimum trans-flow for the given commodity through this vertex
      */
-    uint32_t getCommodityMinTransFlow(uint32_t commodity) const { return mCommodityMinTransFlow.at(commodity); }
+    uint32_t getCommodityMinTransFlow(uint32_t commodity) const { restoreAttributes(); return mCommodityMinTransFlow.at(commodity); }
 
     /**
      * Retrieve the set max trans-flow through this vertex for a given commodity
      * \param commodity Index of the commodity
      * \return minimum trans-flow for the given commodity through this vertex
      */
-    uint32_t getCommodityMaxTransFlow(uint32_t commodity) const { return mCommodityMaxTransFlow.at(commodity); }
+    uint32_t getCommodityMaxTransFlow(uint32_t commodity) const { restoreAttributes(); return mCommodityMaxTransFlow.at(commodity); }
 
     virtual std::string getClassName() const override { return "MultiCommodityVertex"; }
     virtual std::string toString() const override;
 
     /**
-     * Register attributes of this vertex for serialization
+     * Register attributes of this vertex for serialization -- the attributes
+     * are deserialized on first access
      */
     virtual void registerAttributes(VertexTypeManager*) const override;
 
@@ -120,6 +121,9 @@ private:
 
     std::string serializeAttributes() const;
     void deserializeAttributes(const std::string& data);
+
+    std::string serializeBinaryAttributes() const;
+    void deserializeBinaryAttributes(const std::string& data);
 };
 
 } // end namespace algorithms
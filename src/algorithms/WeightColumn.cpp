@@ -0,0 +1,59 @@
+#include "WeightColumn.hpp"
+#include <algorithm>
+#include <limits>
+#include "../utils/Parallel.hpp"
+
+namespace graph_analysis {
+namespace algorithms {
+
+namespace {
+
+/// Minimum number of edges which are evaluated per thread
+const size_t MIN_EVALUATION_CHUNK_SIZE = 1024;
+
+} // end anonymous namespace
+
+WeightColumn::WeightColumn(const BaseGraph::Ptr& graph, EdgeWeightFunction edgeWeightFunction, bool parallel)
+    : mpGraph(graph)
+    , mEdgeWeightFunction(edgeWeightFunction)
+    , mParallel(parallel)
+    , mVersion(0)
+{
+    if(!mpGraph)
+    {
+        throw std::invalid_argument("graph_analysis::algorithms::WeightColumn: graph is not set");
+    }
+    evaluate();
+}
+
+void WeightColumn::evaluate() const
+{
+    uint64_t version = mpGraph->version();
+    std::vector<Edge::Ptr> edges = mpGraph->getAllEdges();
+
+    std::vector<GraphElementId> edgeIds(edges.size());
+    for(size_t i = 0; i < edges.size(); ++i)
+    {
+        edgeIds[i] = mpGraph->getEdgeId(edges[i]);
+    }
+
+    mWeights.assign(edgeIds.empty() ? 0 : *std::max_element(edgeIds.begin(), edgeIds.end()) + 1,
+            std::numeric_limits<double>::quiet_NaN());
+
+    const EdgeWeightFunction& edgeWeightFunction = mEdgeWeightFunction;
+    std::vector<double>& weights = mWeights;
+    // A single chunk is evaluated on the calling thread
+    size_t minChunkSize = mParallel ? MIN_EVALUATION_CHUNK_SIZE : std::numeric_limits<size_t>::max();
+    utils::parallelFor(edges.size(), minChunkSize, [&](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+            {
+                weights[ edgeIds[i] ] = edgeWeightFunction(edges[i]);
+            }
+        });
+
+    mVersion = version;
+}
+
+} // end namespace algorithms
+} // end namespace graph_analysis
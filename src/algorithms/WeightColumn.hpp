@@ -0,0 +1,99 @@
+#ifndef GRAPH_ANALYSIS_ALGORITHMS_WEIGHT_COLUMN_HPP
+#define GRAPH_ANALYSIS_ALGORITHMS_WEIGHT_COLUMN_HPP
+
+#include <vector>
+#include "../Edge.hpp"
+#include "../BaseGraph.hpp"
+
+namespace graph_analysis {
+namespace algorithms {
+
+typedef function1<double, Edge::Ptr> EdgeWeightFunction;
+
+/**
+ * \class WeightColumn
+ * \brief Weights of all edges of a graph, indexed by edge id
+ * \details The edge weight function is evaluated once per edge and the
+ * weights are kept until the graph is modified (see BaseGraph::version).
+ * Accessing the weights after a modification evaluates the weight function
+ * again. The weight function is called on the calling thread, unless
+ * parallel evaluation has been requested.
+ \verbatim
+    WeightColumn weights(graph, getWeight);
+    EdgeIterator::Ptr edgeIt = graph->getEdgeIterator();
+    while(edgeIt->next())
+    {
+        double weight = weights(edgeIt->current());
+        ...
+    }
+ \endverbatim
+ */
+class WeightColumn
+{
+public:
+    /**
+     * Evaluate the weight function for all edges of the graph
+     * \param parallel Evaluate the weight function over chunks of the edges
+     * on multiple threads, which requires the weight function to be
+     * thread-safe
+     */
+    WeightColumn(const BaseGraph::Ptr& graph, EdgeWeightFunction edgeWeightFunction, bool parallel = false);
+
+    /**
+     * Get the weight of an edge of the graph
+     */
+    double operator()(const Edge::Ptr& edge) const { return getWeight(mpGraph->getEdgeId(edge)); }
+
+    /**
+     * Get the weight of the edge with the given id
+     */
+    double getWeight(GraphElementId edgeId) const
+    {
+        update();
+        return mWeights[edgeId];
+    }
+
+    /**
+     * Get the weights indexed by edge id, unused ids are NaN
+     */
+    const std::vector<double>& getWeights() const
+    {
+        update();
+        return mWeights;
+    }
+
+    /**
+     * Test whether the weights correspond to the current state of the graph
+     */
+    bool isUpToDate() const { return mVersion == mpGraph->version(); }
+
+    /**
+     * Evaluate the weight function again, if the graph has been modified
+     */
+    void update() const
+    {
+        if(!isUpToDate())
+        {
+            evaluate();
+        }
+    }
+
+    const BaseGraph::Ptr& getGraph() const { return mpGraph; }
+
+    bool isParallel() const { return mParallel; }
+
+private:
+    void evaluate() const;
+
+    BaseGraph::Ptr mpGraph;
+    EdgeWeightFunction mEdgeWeightFunction;
+    bool mParallel;
+
+    mutable std::vector<double> mWeights;
+    /// Version of the graph the weights have been evaluated for
+    mutable uint64_t mVersion;
+};
+
+} // end namespace algorithms
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_ALGORITHMS_WEIGHT_COLUMN_HPP
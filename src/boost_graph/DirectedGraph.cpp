@@ -35,7 +35,36 @@ DirectedGraph::DirectedGraph()
 DirectedGraph::DirectedGraph(const DirectedGraph& other)
     : TypedGraph(BOOST_DIRECTED_GRAPH, true)
 {
-    *this = other;
+    // Vertex descriptors refer to the storage of the other graph, so the
+    // graph is rebuilt -- using the same element ids
+    boost::unordered_map<VertexDescriptor, VertexDescriptor> descriptors;
+    descriptors.reserve(other.mVertexMap.size());
+    mVertexMap.reserve(other.mVertexMap.size());
+    mEdgeMap.reserve(other.mEdgeMap.size());
+
+    VertexMap::const_iterator vit = other.mVertexMap.begin();
+    for(; vit != other.mVertexMap.end(); ++vit)
+    {
+        VertexDescriptor vertexDescriptor = boost::add_vertex(mGraph);
+        mGraph[vertexDescriptor] = other.mGraph[vit->second];
+        mVertexMap.insert(VertexMap::value_type(vit->first, vertexDescriptor));
+        descriptors[vit->second] = vertexDescriptor;
+    }
+
+    EdgeMap::const_iterator eit = other.mEdgeMap.begin();
+    for(; eit != other.mEdgeMap.end(); ++eit)
+    {
+        std::pair<EdgeDescriptor, bool> result = boost::add_edge(descriptors[ boost::source(eit->second, other.mGraph) ],
+                descriptors[ boost::target(eit->second, other.mGraph) ], mGraph);
+        mGraph[result.first] = other.mGraph[eit->second];
+        mEdgeMap.insert(EdgeMap::value_type(eit->first, result.first));
+    }
+
+    msNewVertexId[getId()] = msNewVertexId[other.getId()];
+    msNewEdgeId[getId()] = msNewEdgeId[other.getId()];
+    // The elements of the other graph are part of this graph with the same ids
+    GraphElement::shareAssociations(getId(), other.getId());
+    copyIndices(other);
 }
 
 DirectedGraph::~DirectedGraph()
@@ -53,6 +82,12 @@ DirectedGraph::Ptr DirectedGraph::validateType(const BaseGraph::Ptr& baseGraph)
     return directedGraph;
 }
 
+void DirectedGraph::reserve(size_t numberOfVertices, size_t numberOfEdges)
+{
+    mVertexMap.reserve(mVertexMap.size() + numberOfVertices);
+    mEdgeMap.reserve(mEdgeMap.size() + numberOfEdges);
+}
+
 GraphElementId DirectedGraph::addVertexInternal(const Vertex::Ptr& vertex)
 {
     // Add a new vertex to the Graph
@@ -116,6 +151,63 @@ EdgeDescriptor DirectedGraph::getEdgeDescriptor(const Edge::Ptr& edge) const
     throw std::invalid_argument("graph_analysis::boost::DirectedGraph::getEdgeDescriptor for vertex " + edge->toString() + " could no be retrieved.");
 }
 
+VertexDescriptor DirectedGraph::getVertexDescriptor(VertexHandle vertex) const
+{
+    VertexMap::const_iterator cit = mVertexMap.find(vertex.id);
+    if(cit != mVertexMap.end())
+    {
+        return cit->second;
+    }
+
+    std::stringstream ss;
+    ss << vertex.id;
+    throw std::invalid_argument("graph_analysis::boost::DirectedGraph::getVertexDescriptor: vertex with id '" + ss.str() + "' does not exist");
+}
+
+EdgeDescriptor DirectedGraph::getEdgeDescriptor(EdgeHandle edge) const
+{
+    EdgeMap::const_iterator cit = mEdgeMap.find(edge.id);
+    if(cit != mEdgeMap.end())
+    {
+        return cit->second;
+    }
+
+    std::stringstream ss;
+    ss << edge.id;
+    throw std::invalid_argument("graph_analysis::boost::DirectedGraph::getEdgeDescriptor: edge with id '" + ss.str() + "' does not exist");
+}
+
+VertexHandle DirectedGraph::source(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph[ boost::source(getEdgeDescriptor(edge), mGraph) ]->getId(getId()) );
+}
+
+VertexHandle DirectedGraph::target(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph[ boost::target(getEdgeDescriptor(edge), mGraph) ]->getId(getId()) );
+}
+
+void DirectedGraph::visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    boost::graph_traits<BidirectionalGraph>::out_edge_iterator it, end;
+    for(boost::tie(it, end) = boost::out_edges(getVertexDescriptor(vertex), mGraph); it != end; ++it)
+    {
+        // Access by reference, so that the reference count is not touched
+        const Edge::Ptr& edge = mGraph[*it];
+        visitor(context, EdgeHandle( edge->getId(getId()) ));
+    }
+}
+
+void DirectedGraph::visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    boost::graph_traits<BidirectionalGraph>::in_edge_iterator it, end;
+    for(boost::tie(it, end) = boost::in_edges(getVertexDescriptor(vertex), mGraph); it != end; ++it)
+    {
+        const Edge::Ptr& edge = mGraph[*it];
+        visitor(context, EdgeHandle( edge->getId(getId()) ));
+    }
+}
+
 
 
 GraphElementId DirectedGraph::addEdgeInternal(const Edge::Ptr& edge, GraphElementId sourceVertexId, GraphElementId targetVertexId)
@@ -238,6 +330,11 @@ std::vector<Edge::Ptr> DirectedGraph::getEdges(VertexDescriptor source, VertexDe
 
 std::vector<Edge::Ptr> DirectedGraph::getEdges(const Vertex::Ptr& source, const Vertex::Ptr& target) const
 {
+    if(isAdjacencyIndexEnabled())
+    {
+        return BaseGraph::getEdges(source, target);
+    }
+
     VertexDescriptor sourceVertexDescriptor = getVertexDescriptor(source);
     VertexDescriptor targetVertexDescriptor = getVertexDescriptor(target);
 
@@ -70,10 +70,29 @@ public:
      */
     EdgeDescriptor getEdgeDescriptor(const Edge::Ptr& edge) const;
 
+    /**
+     * Get the descriptor of a vertex/edge handle
+     * \throw std::invalid_argument if the element is not part of this graph
+     */
+    VertexDescriptor getVertexDescriptor(VertexHandle vertex) const;
+    EdgeDescriptor getEdgeDescriptor(EdgeHandle edge) const;
+
+    VertexHandle source(EdgeHandle edge) const;
+    VertexHandle target(EdgeHandle edge) const;
+
+    /**
+     * Copy the structure of the other graph, the copy shares the element
+     * associations of the other graph, see GraphElement::shareAssociations
+     */
     DirectedGraph(const DirectedGraph& other);
 
     void write(std::ostream& ostream = std::cout) const;
 
+    /**
+     * Reserve space for additional vertices and edges
+     */
+    void reserve(size_t numberOfVertices, size_t numberOfEdges);
+
     /**
      * Get the vertex iterator for this implementation
      */
@@ -143,6 +162,12 @@ protected:
      */
     virtual void removeEdgeInternal(const Edge::Ptr&);
 
+    /**
+     * Visit the out/in edges of a vertex without touching the elements
+     */
+    void visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+    void visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+
     // Property maps to store data associated with vertices and edges
     EdgeMap mEdgeMap;
     VertexMap mVertexMap;
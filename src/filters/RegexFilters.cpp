@@ -46,5 +46,13 @@ bool CombinedEdgeRegexFilter::evaluateTarget(graph_analysis::Edge::Ptr e) const
     return mTargetNodeFilter.apply( e->getTargetVertex() );
 }
 
+void CombinedEdgeRegexFilter::prepare(const std::vector<Vertex::Ptr>& vertexClasses, const std::vector<Edge::Ptr>& edgeClasses)
+{
+    mEdgeRegexFilter.prepare(vertexClasses, edgeClasses);
+    mSourceNodeFilter.prepare(vertexClasses, edgeClasses);
+    mTargetNodeFilter.prepare(vertexClasses, edgeClasses);
+    EdgeContextFilter::prepare(vertexClasses, edgeClasses);
+}
+
 } // end namespace filters
 } // end namespace graph_analysis
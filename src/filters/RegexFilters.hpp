@@ -1,7 +1,11 @@
 #ifndef GRAPH_ANALYSIS_FILTERS_REGEX_FILTER_HPP
 #define GRAPH_ANALYSIS_FILTERS_REGEX_FILTER_HPP
 
+#include <atomic>
+#include <mutex>
+#include <typeindex>
 #include <boost/regex.hpp>
+#include <boost/unordered_map.hpp>
 #include "../Vertex.hpp"
 #include "../Edge.hpp"
 #include "CommonFilters.hpp"
@@ -22,11 +26,78 @@ protected:
     Type mType;
     bool mInverted;
 
+    typedef boost::unordered_map<std::type_index, bool, std::hash<std::type_index> > ClassMatchMap;
+
+    /// Results of matching the class names, shared between copies of the
+    /// filter
+    struct ClassMatches
+    {
+        ClassMatches()
+            : prepared(false)
+        {}
+
+        std::mutex mutex;
+        /// Set once the matches have been precomputed by prepare, they are
+        /// read without locking from then on
+        std::atomic<bool> prepared;
+        ClassMatchMap matches;
+    };
+    shared_ptr<ClassMatches> mClassMatches;
+
+    /**
+     * Match the class name of an element against the regex, the regex is
+     * evaluated only once per class
+     */
+    bool matchClass(const GraphElement& element) const
+    {
+        std::type_index type(typeid(element));
+        ClassMatches& classMatches = *mClassMatches;
+        if(classMatches.prepared.load(std::memory_order_acquire))
+        {
+            ClassMatchMap::const_iterator cit = classMatches.matches.find(type);
+            if(cit != classMatches.matches.end())
+            {
+                return cit->second;
+            }
+            // class has not been prepared for, do not modify the shared
+            // matches
+            return regex_match(element.getClassName(), mRegex);
+        }
+
+        std::lock_guard<std::mutex> lock(classMatches.mutex);
+        ClassMatchMap::const_iterator cit = classMatches.matches.find(type);
+        if(cit != classMatches.matches.end())
+        {
+            return cit->second;
+        }
+
+        bool result = regex_match(element.getClassName(), mRegex);
+        classMatches.matches[type] = result;
+        return result;
+    }
+
+    /**
+     * Add the matches of the classes of the given elements
+     */
+    template<typename E>
+    void addClassMatches(const std::vector< shared_ptr<E> >& elements)
+    {
+        for(size_t i = 0; i < elements.size(); ++i)
+        {
+            std::type_index type(typeid(*elements[i]));
+            if(!mClassMatches->matches.count(type))
+            {
+                mClassMatches->matches[type] = regex_match(elements[i]->getClassName(), mRegex);
+            }
+        }
+    }
+
 public:
     RegexFilter(const std::string& regex, Type type, bool invert)
         : mRegex(regex)
         , mType(type)
         , mInverted(invert)
+        , mClassMatches(new ClassMatches())
     {}
 
     virtual std::string getName() const { return "graph_analysis::filters::RegexFilter: '" + toString() + "'"; }
@@ -43,6 +114,23 @@ public:
         return txt;
     }
 
+    /**
+     * Precompute the class matches, so that a concurrent evaluation reads
+     * them without locking
+     */
+    virtual void prepare(const std::vector<Vertex::Ptr>& vertexClasses, const std::vector<Edge::Ptr>& edgeClasses)
+    {
+        if(mType == CLASS)
+        {
+            std::lock_guard<std::mutex> lock(mClassMatches->mutex);
+            mClassMatches->prepared.store(false, std::memory_order_relaxed);
+            addClassMatches(vertexClasses);
+            addClassMatches(edgeClasses);
+            mClassMatches->prepared.store(true, std::memory_order_release);
+        }
+        graph_analysis::Filter<T>::prepare(vertexClasses, edgeClasses);
+    }
+
     virtual bool apply(T element) const
     {
         bool result = false;
@@ -52,7 +140,7 @@ public:
                 result = regex_match(element->toString(), mRegex);
                 break;
             case CLASS:
-                result = regex_match(element->getClassName(), mRegex);
+                result = matchClass(*element);
                 break;
             default:
                 throw std::runtime_error("graph_analysis::filters::RegexFilter unknown filter type provided");
@@ -107,6 +195,8 @@ public:
     virtual bool evaluateSource(graph_analysis::Edge::Ptr e) const;
     virtual bool evaluateTarget(graph_analysis::Edge::Ptr e) const;
 
+    virtual void prepare(const std::vector<Vertex::Ptr>& vertexClasses, const std::vector<Edge::Ptr>& edgeClasses);
+
 private:
     EdgeRegexFilter mEdgeRegexFilter;
     VertexRegexFilter mSourceNodeFilter;
@@ -41,5 +41,14 @@ void QBaseGraph::notify(const Edge::Ptr& edge, const EventType& event,
     emit graphChanged();
 }
 
+void QBaseGraph::notifyBatch(const std::vector<ObserverEvent>& events)
+{
+    // A single update for all changes of a transaction
+    if(!events.empty())
+    {
+        emit graphChanged();
+    }
+}
+
 }
 }
@@ -47,6 +47,8 @@ private:
                         const GraphId& origin);
     void notify(const Edge::Ptr& edge, const EventType& event,
                         const GraphId& origin);
+    bool acceptsBatches() const { return true; }
+    void notifyBatch(const std::vector<ObserverEvent>& events);
 
 
 signals:
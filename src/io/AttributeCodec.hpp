@@ -0,0 +1,275 @@
+#ifndef GRAPH_ANALYSIS_IO_ATTRIBUTE_CODEC_HPP
+#define GRAPH_ANALYSIS_IO_ATTRIBUTE_CODEC_HPP
+
+#include <stdint.h>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file AttributeCodec.hpp
+ * \class AttributeEncoder
+ * \brief Compact binary encoding of attribute data for the native graph
+ * formats (binary graph format and journal)
+ * \details Unsigned integers are encoded as LEB128 varints, signed integers as
+ * zigzag varints, floating point values with their 4/8 byte representation in
+ * host byte order. Strings and containers are prefixed by their number of
+ * bytes/entries as varint.
+ *
+ * Compared to a boost text archive, neither a header nor any number formatting
+ * or parsing is involved, which makes encoding and decoding of large
+ * attributes several times faster.
+ *
+ \verbatim
+    std::string MyEdge::serializeBinary() const
+    {
+        io::AttributeEncoder encoder;
+        encoder << mCapacity << mCosts;
+        return encoder.str();
+    }
+
+    void MyEdge::deserializeBinary(const std::string& data)
+    {
+        io::AttributeDecoder decoder(data);
+        decoder >> mCapacity >> mCosts;
+    }
+ \endverbatim
+ */
+class AttributeEncoder
+{
+public:
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value, AttributeEncoder&>::type operator<<(T value)
+    {
+        if(std::is_signed<T>::value)
+        {
+            int64_t signedValue = static_cast<int64_t>(value);
+            writeVarint((static_cast<uint64_t>(signedValue) << 1) ^ static_cast<uint64_t>(signedValue >> 63));
+        } else {
+            writeVarint(static_cast<uint64_t>(value));
+        }
+        return *this;
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, AttributeEncoder&>::type operator<<(T value)
+    {
+        mData.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        return *this;
+    }
+
+    AttributeEncoder& operator<<(const std::string& value)
+    {
+        writeVarint(value.size());
+        mData.append(value);
+        return *this;
+    }
+
+    template<typename A, typename B>
+    AttributeEncoder& operator<<(const std::pair<A,B>& value)
+    {
+        return *this << value.first << value.second;
+    }
+
+    template<typename T>
+    AttributeEncoder& operator<<(const std::vector<T>& values)
+    {
+        return writeRange(values);
+    }
+
+    template<typename T>
+    AttributeEncoder& operator<<(const std::set<T>& values)
+    {
+        return writeRange(values);
+    }
+
+    template<typename K, typename V>
+    AttributeEncoder& operator<<(const std::map<K,V>& values)
+    {
+        return writeRange(values);
+    }
+
+    /**
+     * Get the encoded data
+     */
+    const std::string& str() const { return mData; }
+
+private:
+    void writeVarint(uint64_t value)
+    {
+        while(value >= 0x80)
+        {
+            mData.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        mData.push_back(static_cast<char>(value));
+    }
+
+    template<typename Container>
+    AttributeEncoder& writeRange(const Container& values)
+    {
+        writeVarint(values.size());
+        typename Container::const_iterator cit = values.begin();
+        for(; cit != values.end(); ++cit)
+        {
+            *this << *cit;
+        }
+        return *this;
+    }
+
+    std::string mData;
+};
+
+/**
+ * \class AttributeDecoder
+ * \brief Decoder for data that has been encoded with AttributeEncoder
+ * \details The decoder refers to the given data, which has to stay valid
+ * while decoding
+ * \throw std::runtime_error if the data is truncated
+ */
+class AttributeDecoder
+{
+public:
+    AttributeDecoder(const std::string& data)
+        : mPosition(data.data())
+        , mEnd(data.data() + data.size())
+    {}
+
+    AttributeDecoder(const char* data, size_t size)
+        : mPosition(data)
+        , mEnd(data + size)
+    {}
+
+    /**
+     * Test whether all data has been decoded
+     */
+    bool atEnd() const { return mPosition == mEnd; }
+
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value, AttributeDecoder&>::type operator>>(T& value)
+    {
+        uint64_t encoded = readVarint();
+        if(std::is_signed<T>::value)
+        {
+            value = static_cast<T>(static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1));
+        } else {
+            value = static_cast<T>(encoded);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, AttributeDecoder&>::type operator>>(T& value)
+    {
+        require(sizeof(T));
+        memcpy(&value, mPosition, sizeof(T));
+        mPosition += sizeof(T);
+        return *this;
+    }
+
+    AttributeDecoder& operator>>(std::string& value)
+    {
+        uint64_t size = readVarint();
+        require(size);
+        value.assign(mPosition, size);
+        mPosition += size;
+        return *this;
+    }
+
+    template<typename A, typename B>
+    AttributeDecoder& operator>>(std::pair<A,B>& value)
+    {
+        return *this >> value.first >> value.second;
+    }
+
+    template<typename T>
+    AttributeDecoder& operator>>(std::vector<T>& values)
+    {
+        uint64_t size = readSize();
+        values.clear();
+        values.reserve(size);
+        for(uint64_t i = 0; i < size; ++i)
+        {
+            T value;
+            *this >> value;
+            values.push_back(value);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    AttributeDecoder& operator>>(std::set<T>& values)
+    {
+        uint64_t size = readSize();
+        values.clear();
+        for(uint64_t i = 0; i < size; ++i)
+        {
+            T value;
+            *this >> value;
+            values.insert(values.end(), value);
+        }
+        return *this;
+    }
+
+    template<typename K, typename V>
+    AttributeDecoder& operator>>(std::map<K,V>& values)
+    {
+        uint64_t size = readSize();
+        values.clear();
+        for(uint64_t i = 0; i < size; ++i)
+        {
+            std::pair<K,V> value;
+            *this >> value;
+            values.insert(values.end(), value);
+        }
+        return *this;
+    }
+
+private:
+    void require(uint64_t size) const
+    {
+        if(size > static_cast<uint64_t>(mEnd - mPosition))
+        {
+            throw std::runtime_error("graph_analysis::io::AttributeDecoder: unexpected end of data");
+        }
+    }
+
+    uint64_t readVarint()
+    {
+        uint64_t value = 0;
+        for(unsigned shift = 0; shift < 64; shift += 7)
+        {
+            require(1);
+            uint8_t byte = static_cast<uint8_t>(*mPosition++);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if(!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+        throw std::runtime_error("graph_analysis::io::AttributeDecoder: invalid varint");
+    }
+
+    /// Read the number of entries of a container -- each entry takes at
+    /// least one byte, which bounds the size for corrupted data
+    uint64_t readSize()
+    {
+        uint64_t size = readVarint();
+        require(size);
+        return size;
+    }
+
+    const char* mPosition;
+    const char* mEnd;
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_ATTRIBUTE_CODEC_HPP
@@ -0,0 +1,126 @@
+#ifndef GRAPH_ANALYSIS_IO_BINARY_FORMAT_HPP
+#define GRAPH_ANALYSIS_IO_BINARY_FORMAT_HPP
+
+#include <stdint.h>
+
+namespace graph_analysis {
+namespace io {
+namespace binary {
+
+/**
+ * \file BinaryFormat.hpp
+ * \brief Layout of the binary graph format
+ * \details
+ * The file starts with a Header, followed by the sections listed in
+ * SectionType. Each section starts at an offset which is a multiple of
+ * SECTION_ALIGNMENT, so that the records can be directly accessed from a
+ * memory mapped file.
+ *
+ * Vertices are stored in the VERTICES section and are referred to by their
+ * index in this section. Edges are sorted by the index of their source vertex,
+ * i.e. the OFFSETS section stores for each vertex the index of its first out
+ * edge (compressed sparse row layout), with an additional entry for the end of
+ * the last vertex.
+ *
+ * All strings, i.e. class names, labels, attribute names and attribute data
+ * are stored in the STRINGS section and referred to by a StringRef. Class
+ * names and attribute names are stored only once. Attribute data is stored
+ * in the encoding given by the AttributeRecord, i.e. the compact binary
+ * encoding (see AttributeCodec.hpp) if the attribute supports it.
+ *
+ * Attribute columns (see AttributeColumn.hpp) are described by the
+ * COLUMNS section. The values of a column are stored in the COLUMN_DATA
+ * section as an array with one entry per vertex/edge in the order of the
+ * VERTICES/EDGES section: int64_t for INT and double for DOUBLE columns, a
+ * StringRef into the STRINGS section for STRING and BLOB columns.
+ *
+ * Data is written in the byte order of the writing host, the Header contains a
+ * mark to detect a mismatch.
+ */
+
+const char MAGIC[8] = { 'G', 'A', 'G', 'R', 'A', 'P', 'H', 0 };
+const uint32_t VERSION = 3;
+const uint32_t ENDIANNESS_MARK = 0x01020304;
+const uint64_t SECTION_ALIGNMENT = 8;
+
+enum SectionType { CLASSES = 0, VERTICES, EDGES, OFFSETS, ATTRIBUTES, COLUMNS, COLUMN_DATA, STRINGS, SECTION_TYPE_END };
+
+/// Element type a column belongs to
+enum ColumnOwner { VERTEX_COLUMN = 0, EDGE_COLUMN };
+
+struct StringRef
+{
+    uint64_t offset;
+    uint64_t length;
+};
+
+struct Section
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t endianness;
+    uint64_t numberOfVertices;
+    uint64_t numberOfEdges;
+    uint64_t numberOfClasses;
+    uint64_t numberOfAttributes;
+    uint64_t numberOfColumns;
+    Section sections[SECTION_TYPE_END];
+};
+
+struct VertexRecord
+{
+    /// Id of the vertex in the graph that has been written
+    uint64_t id;
+    /// Index of the class name in the CLASSES section
+    uint64_t classIndex;
+    StringRef label;
+    /// Index of the first attribute in the ATTRIBUTES section
+    uint64_t attributeIndex;
+    uint64_t numberOfAttributes;
+};
+
+struct EdgeRecord
+{
+    /// Id of the edge in the graph that has been written
+    uint64_t id;
+    /// Index of the source vertex in the VERTICES section
+    uint64_t source;
+    /// Index of the target vertex in the VERTICES section
+    uint64_t target;
+    /// Index of the class name in the CLASSES section
+    uint64_t classIndex;
+    StringRef label;
+    /// Index of the first attribute in the ATTRIBUTES section
+    uint64_t attributeIndex;
+    uint64_t numberOfAttributes;
+};
+
+struct AttributeRecord
+{
+    StringRef name;
+    StringRef data;
+    /// io::AttributeEncoding of the data
+    uint64_t encoding;
+};
+
+struct ColumnRecord
+{
+    StringRef name;
+    /// ColumnOwner
+    uint32_t owner;
+    /// attribute::ColumnType
+    uint32_t type;
+    /// Offset of the first value in the COLUMN_DATA section
+    uint64_t offset;
+};
+
+} // end namespace binary
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_BINARY_FORMAT_HPP
@@ -0,0 +1,350 @@
+#include "BinaryGraphView.hpp"
+#include <cstring>
+#include <sstream>
+#include <base-logging/Logging.hpp>
+#include "../VertexTypeManager.hpp"
+#include "../EdgeTypeManager.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+BinaryGraphView::BinaryGraphView(const std::string& filename)
+    : mFile(new utils::MappedFile(filename, utils::MappedFile::RANDOM))
+    , mData(mFile->data())
+    , mSize(mFile->size())
+    , mName(filename)
+{
+    initialize();
+}
+
+BinaryGraphView::BinaryGraphView(const char* data, size_t size, const std::string& name)
+    : mData(data)
+    , mSize(size)
+    , mName(name)
+{
+    initialize();
+}
+
+void BinaryGraphView::initialize()
+{
+    mHeader = NULL;
+    mClasses = NULL;
+    mVertexRecords = NULL;
+    mEdgeRecords = NULL;
+    mOffsets = NULL;
+    mAttributeRecords = NULL;
+    mColumnRecords = NULL;
+    mColumnData = NULL;
+    mColumnDataSize = 0;
+    mStrings = NULL;
+    mStringsSize = 0;
+
+    if(mSize < sizeof(binary::Header))
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' is not a binary graph file");
+    }
+
+    mHeader = reinterpret_cast<const binary::Header*>(mData);
+    if(memcmp(mHeader->magic, binary::MAGIC, sizeof(binary::MAGIC)) != 0)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' is not a binary graph file");
+    }
+    if(mHeader->endianness != binary::ENDIANNESS_MARK)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' has been written on a host with different byte order");
+    }
+    if(mHeader->version != binary::VERSION)
+    {
+        std::stringstream ss;
+        ss << "graph_analysis::io::BinaryGraphView: '" << mName << "' has version " << mHeader->version;
+        ss << ", but only version " << binary::VERSION << " is supported";
+        throw std::runtime_error(ss.str());
+    }
+
+    mClasses = getSection<binary::StringRef>(binary::CLASSES, mHeader->numberOfClasses);
+    mVertexRecords = getSection<binary::VertexRecord>(binary::VERTICES, mHeader->numberOfVertices);
+    mEdgeRecords = getSection<binary::EdgeRecord>(binary::EDGES, mHeader->numberOfEdges);
+    mOffsets = getSection<uint64_t>(binary::OFFSETS, mHeader->numberOfVertices + 1);
+    mAttributeRecords = getSection<binary::AttributeRecord>(binary::ATTRIBUTES, mHeader->numberOfAttributes);
+    mColumnRecords = getSection<binary::ColumnRecord>(binary::COLUMNS, mHeader->numberOfColumns);
+    mColumnDataSize = mHeader->sections[binary::COLUMN_DATA].size/sizeof(uint64_t);
+    mColumnData = getSection<uint64_t>(binary::COLUMN_DATA, mColumnDataSize);
+    mStringsSize = mHeader->sections[binary::STRINGS].size;
+    mStrings = getSection<char>(binary::STRINGS, mStringsSize);
+
+    if(mOffsets[mHeader->numberOfVertices] != mHeader->numberOfEdges)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' has an inconsistent adjacency section");
+    }
+
+    mVertices.resize(mHeader->numberOfVertices);
+    mEdges.resize(mHeader->numberOfEdges);
+}
+
+template<typename T>
+const T* BinaryGraphView::getSection(binary::SectionType type, uint64_t count) const
+{
+    const binary::Section& section = mHeader->sections[type];
+    if(section.size != count*sizeof(T)
+            || section.offset % binary::SECTION_ALIGNMENT != 0
+            || section.offset > mSize
+            || section.size > mSize - section.offset)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' is corrupted");
+    }
+    return reinterpret_cast<const T*>(mData + section.offset);
+}
+
+const binary::VertexRecord& BinaryGraphView::vertexRecord(size_t vertexIndex) const
+{
+    if(vertexIndex >= mHeader->numberOfVertices)
+    {
+        throw std::out_of_range("graph_analysis::io::BinaryGraphView: vertex index out of range");
+    }
+    return mVertexRecords[vertexIndex];
+}
+
+const binary::EdgeRecord& BinaryGraphView::edgeRecord(size_t edgeIndex) const
+{
+    if(edgeIndex >= mHeader->numberOfEdges)
+    {
+        throw std::out_of_range("graph_analysis::io::BinaryGraphView: edge index out of range");
+    }
+    return mEdgeRecords[edgeIndex];
+}
+
+boost::string_ref BinaryGraphView::getString(const binary::StringRef& ref) const
+{
+    if(ref.offset > mStringsSize || ref.length > mStringsSize - ref.offset)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' contains an invalid string reference");
+    }
+    return boost::string_ref(mStrings + ref.offset, ref.length);
+}
+
+boost::string_ref BinaryGraphView::getClassName(uint64_t classIndex) const
+{
+    if(classIndex >= mHeader->numberOfClasses)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' contains an invalid class reference");
+    }
+    return getString(mClasses[classIndex]);
+}
+
+boost::string_ref BinaryGraphView::getVertexClassName(size_t vertexIndex) const
+{
+    return getClassName(vertexRecord(vertexIndex).classIndex);
+}
+
+boost::string_ref BinaryGraphView::getVertexLabel(size_t vertexIndex) const
+{
+    return getString(vertexRecord(vertexIndex).label);
+}
+
+std::pair<size_t, size_t> BinaryGraphView::getOutEdges(size_t vertexIndex) const
+{
+    if(vertexIndex >= mHeader->numberOfVertices)
+    {
+        throw std::out_of_range("graph_analysis::io::BinaryGraphView: vertex index out of range");
+    }
+    return std::pair<size_t, size_t>(mOffsets[vertexIndex], mOffsets[vertexIndex + 1]);
+}
+
+boost::string_ref BinaryGraphView::getEdgeClassName(size_t edgeIndex) const
+{
+    return getClassName(edgeRecord(edgeIndex).classIndex);
+}
+
+boost::string_ref BinaryGraphView::getEdgeLabel(size_t edgeIndex) const
+{
+    return getString(edgeRecord(edgeIndex).label);
+}
+
+void BinaryGraphView::deserializeAttributes(AttributeManager* manager, const std::string& className, GraphElement* element, uint64_t attributeIndex, uint64_t numberOfAttributes) const
+{
+    if(attributeIndex > mHeader->numberOfAttributes || numberOfAttributes > mHeader->numberOfAttributes - attributeIndex)
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' contains an invalid attribute reference");
+    }
+
+    for(uint64_t i = attributeIndex; i < attributeIndex + numberOfAttributes; ++i)
+    {
+        const binary::AttributeRecord& record = mAttributeRecords[i];
+        if(record.encoding > BINARY_ENCODING)
+        {
+            throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' contains an invalid attribute encoding");
+        }
+        std::string name = getString(record.name).to_string();
+
+        AttributeSerializationCallbacks callbacks;
+        try {
+            callbacks = manager->getAttributeSerializationCallbacks(className, name);
+        } catch(const std::invalid_argument& e)
+        {
+            LOG_WARN_S << "Skipping attribute '" << name << "' of type '" << className << "': " << e.what();
+            continue;
+        }
+        callbacks.deserialize(element, getString(record.data).to_string(), static_cast<AttributeEncoding>(record.encoding));
+    }
+}
+
+Vertex::Ptr BinaryGraphView::getVertex(size_t vertexIndex) const
+{
+    const binary::VertexRecord& record = vertexRecord(vertexIndex);
+    Vertex::Ptr& vertex = mVertices[vertexIndex];
+    if(vertex)
+    {
+        return vertex;
+    }
+
+    std::string className = getClassName(record.classIndex).to_string();
+    std::string label = getString(record.label).to_string();
+
+    VertexTypeManager* vManager = VertexTypeManager::getInstance();
+    try {
+        vertex = vManager->createVertex(className, label, true);
+    } catch(const std::exception& e)
+    {
+        LOG_WARN_S << "Unsupported vertex type: '" << className << "' -- will use a placeholder node: " << e.what();
+        vertex = Vertex::Ptr(new Vertex("Instance of unsupported vertex type: " + className + ": " + label));
+    }
+    deserializeAttributes(vManager, vertex->getClassName(), vertex.get(), record.attributeIndex, record.numberOfAttributes);
+    return vertex;
+}
+
+Edge::Ptr BinaryGraphView::getEdge(size_t edgeIndex) const
+{
+    const binary::EdgeRecord& record = edgeRecord(edgeIndex);
+    Edge::Ptr& edge = mEdges[edgeIndex];
+    if(edge)
+    {
+        return edge;
+    }
+
+    std::string className = getClassName(record.classIndex).to_string();
+    std::string label = getString(record.label).to_string();
+    Vertex::Ptr sourceVertex = getVertex(record.source);
+    Vertex::Ptr targetVertex = getVertex(record.target);
+
+    EdgeTypeManager* eManager = EdgeTypeManager::getInstance();
+    try {
+        edge = eManager->createEdge(className, sourceVertex, targetVertex, label, true);
+    } catch(const std::exception& e)
+    {
+        LOG_WARN_S << "Unsupported edge type: '" << className << "' -- will use a placeholder edge: " << e.what();
+        edge = Edge::Ptr(new Edge(sourceVertex, targetVertex, "Instance of unsupported edge type: " + className + ": " + label));
+    }
+    deserializeAttributes(eManager, edge->getClassName(), edge.get(), record.attributeIndex, record.numberOfAttributes);
+    return edge;
+}
+
+namespace {
+
+/**
+ * Assign the values of a column in bulk
+ */
+template<typename T>
+void loadColumn(AttributeColumn<T>& column, const T* values, const std::vector<GraphElementId>& ids)
+{
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        column.set(ids[i], values[i]);
+    }
+}
+
+} // end anonymous namespace
+
+void BinaryGraphView::loadColumn(AttributeColumns& columns, const binary::ColumnRecord& record, const std::vector<GraphElementId>& ids) const
+{
+    size_t count = ids.size();
+    std::string name = getString(record.name).to_string();
+    size_t words = (record.type == attribute::STRING || record.type == attribute::BLOB) ? 2 : 1;
+    if(record.offset % sizeof(uint64_t) != 0
+            || record.offset/sizeof(uint64_t) > mColumnDataSize
+            || count*words > mColumnDataSize - record.offset/sizeof(uint64_t))
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryGraphView: '" + mName + "' contains an invalid column '" + name + "'");
+    }
+    const uint64_t* data = mColumnData + record.offset/sizeof(uint64_t);
+
+    switch(record.type)
+    {
+        case attribute::INT:
+            io::loadColumn(columns.get<int64_t>(name), reinterpret_cast<const int64_t*>(data), ids);
+            break;
+        case attribute::DOUBLE:
+            io::loadColumn(columns.get<double>(name), reinterpret_cast<const double*>(data), ids);
+            break;
+        case attribute::STRING:
+        {
+            AttributeColumn<std::string>& column = columns.get<std::string>(name);
+            const binary::StringRef* refs = reinterpret_cast<const binary::StringRef*>(data);
+            for(size_t i = 0; i < count; ++i)
+            {
+                column.set(ids[i], getString(refs[i]).to_string());
+            }
+            break;
+        }
+        case attribute::BLOB:
+        {
+            AttributeColumn<attribute::Blob>& column = columns.get<attribute::Blob>(name);
+            const binary::StringRef* refs = reinterpret_cast<const binary::StringRef*>(data);
+            for(size_t i = 0; i < count; ++i)
+            {
+                boost::string_ref blob = getString(refs[i]);
+                column.set(ids[i], attribute::Blob(blob.begin(), blob.end()));
+            }
+            break;
+        }
+        default:
+            LOG_WARN_S << "Skipping column '" << name << "' of unsupported type " << record.type;
+    }
+}
+
+void BinaryGraphView::loadColumns(const BaseGraph::Ptr& graph) const
+{
+    for(size_t c = 0; c < mHeader->numberOfColumns; ++c)
+    {
+        const binary::ColumnRecord& record = mColumnRecords[c];
+        if(record.owner == binary::VERTEX_COLUMN)
+        {
+            std::vector<GraphElementId> ids(getNumberOfVertices());
+            for(size_t i = 0; i < ids.size(); ++i)
+            {
+                ids[i] = graph->getVertexId(getVertex(i));
+            }
+            loadColumn(graph->getVertexColumns(), record, ids);
+        } else {
+            std::vector<GraphElementId> ids(getNumberOfEdges());
+            for(size_t i = 0; i < ids.size(); ++i)
+            {
+                ids[i] = graph->getEdgeId(getEdge(i));
+            }
+            loadColumn(graph->getEdgeColumns(), record, ids);
+        }
+    }
+}
+
+void BinaryGraphView::load(const BaseGraph::Ptr& graph) const
+{
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(getNumberOfVertices());
+    for(size_t i = 0; i < getNumberOfVertices(); ++i)
+    {
+        vertices.push_back(getVertex(i));
+    }
+    graph->addVertices(vertices);
+
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(getNumberOfEdges());
+    for(size_t i = 0; i < getNumberOfEdges(); ++i)
+    {
+        edges.push_back(getEdge(i));
+    }
+    graph->addEdges(edges);
+
+    loadColumns(graph);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
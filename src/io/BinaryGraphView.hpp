@@ -0,0 +1,144 @@
+#ifndef GRAPH_ANALYSIS_IO_BINARY_GRAPH_VIEW_HPP
+#define GRAPH_ANALYSIS_IO_BINARY_GRAPH_VIEW_HPP
+
+#include <vector>
+#include <boost/utility/string_ref.hpp>
+#include "BinaryFormat.hpp"
+#include "../BaseGraph.hpp"
+#include "../utils/MappedFile.hpp"
+
+namespace graph_analysis {
+
+class AttributeManager;
+
+namespace io {
+
+/**
+ * \file BinaryGraphView.hpp
+ * \class BinaryGraphView
+ * \brief Read-only access to a graph stored in the binary graph format
+ * \details The file is memory mapped and the topology, class names and labels
+ * are accessed in place without parsing. Vertex and edge objects -- including
+ * the deserialization of their attributes -- are only created on first access
+ * via getVertex and getEdge.
+ *
+ * Vertices and edges are referred to by their index in the file, which is not
+ * identical to the id of the element in the graph that has been written
+ * (see getVertexId and getEdgeId)
+ */
+class BinaryGraphView
+{
+public:
+    typedef shared_ptr<BinaryGraphView> Ptr;
+
+    /**
+     * Map the given file
+     * \throw std::runtime_error if the file cannot be mapped or is not a valid
+     * binary graph file
+     */
+    BinaryGraphView(const std::string& filename);
+
+    /**
+     * Access a binary graph that is already held in memory, e.g. after
+     * decompression -- the buffer has to outlive the view
+     * \param name Name of the buffer to use in error messages
+     * \throw std::runtime_error if the buffer is not a valid binary graph
+     */
+    BinaryGraphView(const char* data, size_t size, const std::string& name = "<buffer>");
+
+    size_t getNumberOfVertices() const { return mHeader->numberOfVertices; }
+    size_t getNumberOfEdges() const { return mHeader->numberOfEdges; }
+
+    /**
+     * Get the id the vertex had in the graph that has been written
+     */
+    GraphElementId getVertexId(size_t vertexIndex) const { return vertexRecord(vertexIndex).id; }
+    boost::string_ref getVertexClassName(size_t vertexIndex) const;
+    boost::string_ref getVertexLabel(size_t vertexIndex) const;
+
+    /**
+     * Get the range [begin,end) of the indices of the out edges of a vertex
+     */
+    std::pair<size_t, size_t> getOutEdges(size_t vertexIndex) const;
+
+    /**
+     * Get the id the edge had in the graph that has been written
+     */
+    GraphElementId getEdgeId(size_t edgeIndex) const { return edgeRecord(edgeIndex).id; }
+    size_t getSourceIndex(size_t edgeIndex) const { return edgeRecord(edgeIndex).source; }
+    size_t getTargetIndex(size_t edgeIndex) const { return edgeRecord(edgeIndex).target; }
+    boost::string_ref getEdgeClassName(size_t edgeIndex) const;
+    boost::string_ref getEdgeLabel(size_t edgeIndex) const;
+
+    /**
+     * Get the vertex object for the given index -- the vertex is
+     * created and its attributes are deserialized on first access
+     */
+    Vertex::Ptr getVertex(size_t vertexIndex) const;
+
+    /**
+     * Get the edge object for the given index -- the edge is
+     * created and its attributes are deserialized on first access
+     */
+    Edge::Ptr getEdge(size_t edgeIndex) const;
+
+    /**
+     * Get the number of attribute columns
+     */
+    size_t getNumberOfColumns() const { return mHeader->numberOfColumns; }
+
+    /**
+     * Add all vertices and edges to the given graph, including the values of
+     * all attribute columns
+     */
+    void load(const BaseGraph::Ptr& graph) const;
+
+    /**
+     * Transfer the attribute columns to the given graph, which has to contain
+     * the vertices and edges of this view
+     */
+    void loadColumns(const BaseGraph::Ptr& graph) const;
+
+private:
+    /// Validate the header and locate the sections
+    void initialize();
+
+    const binary::VertexRecord& vertexRecord(size_t vertexIndex) const;
+    const binary::EdgeRecord& edgeRecord(size_t edgeIndex) const;
+    boost::string_ref getString(const binary::StringRef& ref) const;
+    boost::string_ref getClassName(uint64_t classIndex) const;
+
+    void deserializeAttributes(AttributeManager* manager, const std::string& className, GraphElement* element, uint64_t attributeIndex, uint64_t numberOfAttributes) const;
+
+    template<typename T>
+    const T* getSection(binary::SectionType type, uint64_t count) const;
+
+    void loadColumn(AttributeColumns& columns, const binary::ColumnRecord& record, const std::vector<GraphElementId>& ids) const;
+
+    /// Mapped file, if the view has been created from a file
+    utils::MappedFile::Ptr mFile;
+    const char* mData;
+    size_t mSize;
+    std::string mName;
+
+    const binary::Header* mHeader;
+    const binary::StringRef* mClasses;
+    const binary::VertexRecord* mVertexRecords;
+    const binary::EdgeRecord* mEdgeRecords;
+    const uint64_t* mOffsets;
+    const binary::AttributeRecord* mAttributeRecords;
+    const binary::ColumnRecord* mColumnRecords;
+    const uint64_t* mColumnData;
+    /// Size of the COLUMN_DATA section in 8 byte words
+    uint64_t mColumnDataSize;
+    const char* mStrings;
+    uint64_t mStringsSize;
+
+    /// Cache of materialized vertices and edges
+    mutable std::vector<Vertex::Ptr> mVertices;
+    mutable std::vector<Edge::Ptr> mEdges;
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_BINARY_GRAPH_VIEW_HPP
@@ -0,0 +1,26 @@
+#include "BinaryReader.hpp"
+#include "BinaryGraphView.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+void BinaryReader::read(const std::string& filename, BaseGraph::Ptr graph)
+{
+    BinaryGraphView view(filename);
+
+    graph->clear();
+    view.load(graph);
+}
+
+void BinaryReader::read(std::istream& stream, BaseGraph::Ptr graph)
+{
+    std::vector<char> buffer;
+    readAll(stream, buffer);
+    BinaryGraphView view(buffer.data(), buffer.size());
+
+    graph->clear();
+    view.load(graph);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
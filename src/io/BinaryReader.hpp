@@ -0,0 +1,34 @@
+#ifndef GRAPH_ANALYSIS_IO_BINARY_READER_HPP
+#define GRAPH_ANALYSIS_IO_BINARY_READER_HPP
+
+#include "../GraphIO.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file BinaryReader.hpp
+ * \class BinaryReader
+ * \brief Imports a base graph from a file in the binary graph format
+ * \details To access a graph without importing it, use BinaryGraphView
+ */
+class BinaryReader : public Reader
+{
+public:
+    /**
+     * \brief reads the graph from the given file and stores it to the provided graph argument
+     * \param filename provided input filename
+     * \param graph target graph to store the parsed graph
+     */
+    void read(const std::string& filename, BaseGraph::Ptr graph);
+
+    /**
+     * \brief reads the graph from the given stream -- the stream content is
+     * buffered in memory
+     */
+    void read(std::istream& stream, BaseGraph::Ptr graph);
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_BINARY_READER_HPP
@@ -0,0 +1,358 @@
+#include "BinaryWriter.hpp"
+#include "BinaryFormat.hpp"
+#include <cstring>
+#include <fstream>
+#include <boost/unordered_map.hpp>
+#include "../VertexTypeManager.hpp"
+#include "../EdgeTypeManager.hpp"
+
+namespace graph_analysis {
+namespace io {
+namespace {
+
+/**
+ * Attribute names and serialization callbacks of a single type -- computed
+ * once per type and reused for all elements of this type
+ */
+struct TypeAttributes
+{
+    uint64_t classIndex;
+    std::vector<binary::StringRef> names;
+    std::vector<AttributeSerializationCallbacks> callbacks;
+};
+
+typedef boost::unordered_map<std::string, TypeAttributes> TypeAttributesCache;
+
+/**
+ * Collects all string data of the STRINGS section
+ */
+class StringTable
+{
+public:
+    /**
+     * Append a string
+     */
+    binary::StringRef add(const std::string& value)
+    {
+        binary::StringRef ref;
+        ref.offset = mData.size();
+        ref.length = value.size();
+        mData.append(value);
+        return ref;
+    }
+
+    /**
+     * Append a string only if an identical one has not been added
+     * with this function before
+     */
+    binary::StringRef addUnique(const std::string& value)
+    {
+        boost::unordered_map<std::string, binary::StringRef>::const_iterator cit = mUnique.find(value);
+        if(cit != mUnique.end())
+        {
+            return cit->second;
+        }
+        binary::StringRef ref = add(value);
+        mUnique[value] = ref;
+        return ref;
+    }
+
+    const std::string& data() const { return mData; }
+
+private:
+    std::string mData;
+    boost::unordered_map<std::string, binary::StringRef> mUnique;
+};
+
+class BinaryGraphBuilder
+{
+public:
+    BinaryGraphBuilder()
+        : mVertexManager(VertexTypeManager::getInstance())
+        , mEdgeManager(EdgeTypeManager::getInstance())
+    {}
+
+    void build(const BaseGraph& graph)
+    {
+        boost::unordered_map<GraphElementId, uint64_t> vertexIndex;
+
+        VertexIterator::Ptr vertexIt = graph.getVertexIterator();
+        while(vertexIt->next())
+        {
+            const Vertex::Ptr& vertex = vertexIt->current();
+            GraphElementId id = graph.getVertexId(vertex);
+            vertexIndex[id] = mVertexRecords.size();
+
+            binary::VertexRecord record;
+            memset(&record, 0, sizeof(record));
+            record.id = id;
+            record.label = mStrings.add(vertex->getLabel());
+            const TypeAttributes& typeAttributes = getTypeAttributes(mVertexTypes, mVertexManager, vertex->getClassName());
+            record.classIndex = typeAttributes.classIndex;
+            record.attributeIndex = mAttributeRecords.size();
+            record.numberOfAttributes = typeAttributes.names.size();
+            addAttributes(typeAttributes, vertex.get());
+
+            mVertexRecords.push_back(record);
+        }
+
+        // Collect edges and sort them by source vertex
+        std::vector<binary::EdgeRecord> edges;
+        mOffsets.assign(mVertexRecords.size() + 1, 0);
+        EdgeIterator::Ptr edgeIt = graph.getEdgeIterator();
+        while(edgeIt->next())
+        {
+            const Edge::Ptr& edge = edgeIt->current();
+
+            binary::EdgeRecord record;
+            memset(&record, 0, sizeof(record));
+            record.id = graph.getEdgeId(edge);
+            record.source = vertexIndex[graph.getVertexId(edge->getSourceVertex())];
+            record.target = vertexIndex[graph.getVertexId(edge->getTargetVertex())];
+            record.label = mStrings.add(edge->getLabel());
+            const TypeAttributes& typeAttributes = getTypeAttributes(mEdgeTypes, mEdgeManager, edge->getClassName());
+            record.classIndex = typeAttributes.classIndex;
+            record.attributeIndex = mAttributeRecords.size();
+            record.numberOfAttributes = typeAttributes.names.size();
+            addAttributes(typeAttributes, edge.get());
+
+            ++mOffsets[record.source + 1];
+            edges.push_back(record);
+        }
+
+        for(size_t i = 1; i < mOffsets.size(); ++i)
+        {
+            mOffsets[i] += mOffsets[i-1];
+        }
+
+        mEdgeRecords.resize(edges.size());
+        std::vector<uint64_t> position(mOffsets.begin(), mOffsets.end() - 1);
+        std::vector<binary::EdgeRecord>::const_iterator cit = edges.begin();
+        for(; cit != edges.end(); ++cit)
+        {
+            mEdgeRecords[ position[cit->source]++ ] = *cit;
+        }
+
+        addColumns(graph.getVertexColumns(), binary::VERTEX_COLUMN, mVertexRecords);
+        addColumns(graph.getEdgeColumns(), binary::EDGE_COLUMN, mEdgeRecords);
+    }
+
+    void write(std::ostream& stream) const
+    {
+        binary::Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, binary::MAGIC, sizeof(header.magic));
+        header.version = binary::VERSION;
+        header.endianness = binary::ENDIANNESS_MARK;
+        header.numberOfVertices = mVertexRecords.size();
+        header.numberOfEdges = mEdgeRecords.size();
+        header.numberOfClasses = mClasses.size();
+        header.numberOfAttributes = mAttributeRecords.size();
+        header.numberOfColumns = mColumnRecords.size();
+
+        const char* data[binary::SECTION_TYPE_END];
+        data[binary::CLASSES] = reinterpret_cast<const char*>(mClasses.data());
+        header.sections[binary::CLASSES].size = mClasses.size()*sizeof(binary::StringRef);
+        data[binary::VERTICES] = reinterpret_cast<const char*>(mVertexRecords.data());
+        header.sections[binary::VERTICES].size = mVertexRecords.size()*sizeof(binary::VertexRecord);
+        data[binary::EDGES] = reinterpret_cast<const char*>(mEdgeRecords.data());
+        header.sections[binary::EDGES].size = mEdgeRecords.size()*sizeof(binary::EdgeRecord);
+        data[binary::OFFSETS] = reinterpret_cast<const char*>(mOffsets.data());
+        header.sections[binary::OFFSETS].size = mOffsets.size()*sizeof(uint64_t);
+        data[binary::ATTRIBUTES] = reinterpret_cast<const char*>(mAttributeRecords.data());
+        header.sections[binary::ATTRIBUTES].size = mAttributeRecords.size()*sizeof(binary::AttributeRecord);
+        data[binary::COLUMNS] = reinterpret_cast<const char*>(mColumnRecords.data());
+        header.sections[binary::COLUMNS].size = mColumnRecords.size()*sizeof(binary::ColumnRecord);
+        data[binary::COLUMN_DATA] = reinterpret_cast<const char*>(mColumnData.data());
+        header.sections[binary::COLUMN_DATA].size = mColumnData.size()*sizeof(uint64_t);
+        data[binary::STRINGS] = mStrings.data().data();
+        header.sections[binary::STRINGS].size = mStrings.data().size();
+
+        uint64_t offset = align(sizeof(header));
+        for(int i = 0; i < binary::SECTION_TYPE_END; ++i)
+        {
+            header.sections[i].offset = offset;
+            offset = align(offset + header.sections[i].size);
+        }
+
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        uint64_t position = sizeof(header);
+        const char padding[binary::SECTION_ALIGNMENT] = { 0 };
+        for(int i = 0; i < binary::SECTION_TYPE_END; ++i)
+        {
+            const binary::Section& section = header.sections[i];
+            stream.write(padding, section.offset - position);
+            stream.write(data[i], section.size);
+            position = section.offset + section.size;
+        }
+    }
+
+private:
+    static uint64_t align(uint64_t offset)
+    {
+        return (offset + binary::SECTION_ALIGNMENT - 1) & ~(binary::SECTION_ALIGNMENT - 1);
+    }
+
+    const TypeAttributes& getTypeAttributes(TypeAttributesCache& cache, AttributeManager* manager, const std::string& className)
+    {
+        TypeAttributesCache::const_iterator cit = cache.find(className);
+        if(cit != cache.end())
+        {
+            return cit->second;
+        }
+
+        TypeAttributes& typeAttributes = cache[className];
+        boost::unordered_map<std::string, uint64_t>::const_iterator classIt = mClassIndex.find(className);
+        if(classIt == mClassIndex.end())
+        {
+            typeAttributes.classIndex = mClasses.size();
+            mClassIndex[className] = typeAttributes.classIndex;
+            mClasses.push_back(mStrings.addUnique(className));
+        } else {
+            typeAttributes.classIndex = classIt->second;
+        }
+
+        std::vector<std::string> attributes = manager->getAttributes(className);
+        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
+        for(; attributesIt != attributes.end(); ++attributesIt)
+        {
+            typeAttributes.names.push_back(mStrings.addUnique(*attributesIt));
+            typeAttributes.callbacks.push_back(manager->getAttributeSerializationCallbacks(className, *attributesIt));
+        }
+        return typeAttributes;
+    }
+
+    void addAttributes(const TypeAttributes& typeAttributes, GraphElement* element)
+    {
+        for(size_t i = 0; i < typeAttributes.names.size(); ++i)
+        {
+            const AttributeSerializationCallbacks& callbacks = typeAttributes.callbacks[i];
+            std::string data;
+            binary::AttributeRecord record;
+            record.name = typeAttributes.names[i];
+            record.encoding = callbacks.serialize(element, true, data);
+            record.data = mStrings.add(data);
+            mAttributeRecords.push_back(record);
+        }
+    }
+
+    /**
+     * Add the values of all columns in the order of the given records
+     */
+    template<typename Record>
+    void addColumns(const AttributeColumns& columns, binary::ColumnOwner owner, const std::vector<Record>& records)
+    {
+        AttributeColumns::ColumnMap::const_iterator cit = columns.getColumns().begin();
+        for(; cit != columns.getColumns().end(); ++cit)
+        {
+            const AttributeColumnBase& column = *cit->second;
+
+            binary::ColumnRecord columnRecord;
+            memset(&columnRecord, 0, sizeof(columnRecord));
+            columnRecord.name = mStrings.addUnique(column.getName());
+            columnRecord.owner = owner;
+            columnRecord.type = column.getType();
+            columnRecord.offset = mColumnData.size()*sizeof(uint64_t);
+            mColumnRecords.push_back(columnRecord);
+
+            typename std::vector<Record>::const_iterator rit = records.begin();
+            switch(column.getType())
+            {
+                case attribute::INT:
+                {
+                    const AttributeColumn<int64_t>& values = static_cast<const AttributeColumn<int64_t>&>(column);
+                    for(; rit != records.end(); ++rit)
+                    {
+                        addColumnValue(values.get(rit->id));
+                    }
+                    break;
+                }
+                case attribute::DOUBLE:
+                {
+                    const AttributeColumn<double>& values = static_cast<const AttributeColumn<double>&>(column);
+                    for(; rit != records.end(); ++rit)
+                    {
+                        addColumnValue(values.get(rit->id));
+                    }
+                    break;
+                }
+                case attribute::STRING:
+                {
+                    const AttributeColumn<std::string>& values = static_cast<const AttributeColumn<std::string>&>(column);
+                    for(; rit != records.end(); ++rit)
+                    {
+                        addColumnValue(mStrings.add(values.get(rit->id)));
+                    }
+                    break;
+                }
+                case attribute::BLOB:
+                {
+                    const AttributeColumn<attribute::Blob>& values = static_cast<const AttributeColumn<attribute::Blob>&>(column);
+                    for(; rit != records.end(); ++rit)
+                    {
+                        const attribute::Blob& blob = values.get(rit->id);
+                        addColumnValue(mStrings.add(std::string(blob.begin(), blob.end())));
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error("graph_analysis::io::BinaryWriter: column '" + column.getName() + "' has an unsupported type");
+            }
+        }
+    }
+
+    /**
+     * Append a value of a column -- each value occupies a multiple of 8 bytes
+     */
+    template<typename T>
+    void addColumnValue(const T& value)
+    {
+        size_t position = mColumnData.size();
+        mColumnData.resize(position + (sizeof(T) + sizeof(uint64_t) - 1)/sizeof(uint64_t), 0);
+        memcpy(&mColumnData[position], &value, sizeof(T));
+    }
+
+    VertexTypeManager* mVertexManager;
+    EdgeTypeManager* mEdgeManager;
+    TypeAttributesCache mVertexTypes;
+    TypeAttributesCache mEdgeTypes;
+
+    boost::unordered_map<std::string, uint64_t> mClassIndex;
+    std::vector<binary::StringRef> mClasses;
+    std::vector<binary::VertexRecord> mVertexRecords;
+    std::vector<binary::EdgeRecord> mEdgeRecords;
+    std::vector<uint64_t> mOffsets;
+    std::vector<binary::AttributeRecord> mAttributeRecords;
+    std::vector<binary::ColumnRecord> mColumnRecords;
+    std::vector<uint64_t> mColumnData;
+    StringTable mStrings;
+};
+
+} // end anonymous namespace
+
+void BinaryWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+{
+    std::ofstream outfile(filename.c_str(), std::ios::out | std::ios::binary);
+    if(!outfile.is_open())
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryWriter::write: failed to open '" + filename + "' for writing");
+    }
+
+    write(outfile, *graph);
+
+    outfile.close();
+    if(outfile.fail())
+    {
+        throw std::runtime_error("graph_analysis::io::BinaryWriter::write: failed to write '" + filename + "'");
+    }
+}
+
+void BinaryWriter::write(std::ostream& stream, const BaseGraph& graph) const
+{
+    BinaryGraphBuilder builder;
+    builder.build(graph);
+    builder.write(stream);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
@@ -0,0 +1,37 @@
+#ifndef GRAPH_ANALYSIS_IO_BINARY_WRITER_HPP
+#define GRAPH_ANALYSIS_IO_BINARY_WRITER_HPP
+
+#include <iosfwd>
+#include "../GraphIO.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file BinaryWriter.hpp
+ * \class BinaryWriter
+ * \brief Exports a given base graph to the binary graph format
+ * \details See BinaryFormat.hpp for a description of the format. The result
+ * can be loaded without parsing by memory mapping, see BinaryGraphView
+ */
+class BinaryWriter : public Writer
+{
+public:
+    /**
+     * \brief outputs the given graph to the given file
+     * \param filename requested output filename
+     * \param graph smart pointer to the requested graph to be written
+     */
+    void write(const std::string& filename, const BaseGraph::Ptr& graph) const;
+
+    /**
+     * \brief outputs the given graph to the given stream
+     * \param stream output stream
+     * \param graph requested graph to be written
+     */
+    void write(std::ostream& stream, const BaseGraph& graph) const;
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_BINARY_WRITER_HPP
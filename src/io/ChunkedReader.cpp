@@ -0,0 +1,299 @@
+#include "ChunkedReader.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale.h>
+#include <sstream>
+#include <thread>
+#include <boost/lexical_cast.hpp>
+#include <base-logging/Logging.hpp>
+#include "../WeightedEdge.hpp"
+#include "../utils/MappedFile.hpp"
+#include "../utils/Parallel.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+using utils::runParallel;
+
+namespace {
+
+/// Minimum size of a chunk, to avoid spawning threads for tiny files
+const size_t MIN_CHUNK_SIZE = 1 << 20;
+
+/// Maximum ratio of the dense vertex id range to the number of edge
+/// endpoints, before vertex ids are compacted regardless of the setting
+const uint64_t MAX_UNUSED_IDS_FACTOR = 16;
+
+/// Minimum number of bytes per edge: the shortest line "1 1\n" has 4 bytes
+/// and yields at most two edges (symmetric formats)
+const size_t MIN_BYTES_PER_EDGE = 2;
+
+/**
+ * Get the C locale, so that numbers are parsed independent of the global
+ * locale
+ */
+locale_t classicLocale()
+{
+    static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t) 0);
+    return locale;
+}
+
+/**
+ * Split the given buffer into (at most) numberOfChunks chunks of similar size,
+ * such that each chunk ends at a line boundary
+ * \return numberOfChunks + 1 boundaries
+ */
+std::vector<const char*> splitAtLines(const char* begin, const char* end, size_t numberOfChunks)
+{
+    std::vector<const char*> boundaries;
+    boundaries.reserve(numberOfChunks + 1);
+    boundaries.push_back(begin);
+
+    size_t size = end - begin;
+    for(size_t i = 1; i < numberOfChunks; ++i)
+    {
+        const char* position = std::max(begin + size*i/numberOfChunks, boundaries.back());
+        const char* newline = static_cast<const char*>(memchr(position, '\n', end - position));
+        boundaries.push_back(newline ? newline + 1 : end);
+    }
+    boundaries.push_back(end);
+    return boundaries;
+}
+
+} // end anonymous namespace
+
+ChunkedReader::ChunkedReader(size_t numberOfThreads)
+    : mNumberOfThreads(numberOfThreads)
+    , mCompactVertexIds(false)
+    , mUseWeights(true)
+{}
+
+void ChunkedReader::read(const std::string& filename, BaseGraph::Ptr graph)
+{
+    utils::MappedFile file(filename);
+    LOG_INFO_S << "importing graph from file '" << filename << "'";
+    parse(file.data(), file.data() + file.size(), graph);
+}
+
+void ChunkedReader::read(std::istream& stream, BaseGraph::Ptr graph)
+{
+    std::vector<char> buffer;
+    readAll(stream, buffer);
+    parse(buffer.data(), buffer.data() + buffer.size(), graph);
+}
+
+void ChunkedReader::parse(const char* begin, const char* end, const BaseGraph::Ptr& graph) const
+{
+    Header header;
+    const char* body = parseHeader(begin, end, header);
+
+    size_t numberOfThreads = mNumberOfThreads;
+    if(numberOfThreads == 0)
+    {
+        numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numberOfThreads = std::min(numberOfThreads, static_cast<size_t>(end - body)/MIN_CHUNK_SIZE + 1);
+
+    LOG_DEBUG_S << "parsing " << (end - begin) << " bytes using " << numberOfThreads << " threads";
+
+    // Parse chunks into per-thread edge buffers
+    std::vector<const char*> boundaries = splitAtLines(body, end, numberOfThreads);
+    std::vector<EdgeBuffer> buffers(numberOfThreads);
+    runParallel(numberOfThreads, [&](size_t i)
+        {
+            if(header.numberOfEdges)
+            {
+                // the header is not trusted beyond what the chunk can hold
+                size_t maxEdges = (boundaries[i+1] - boundaries[i])/MIN_BYTES_PER_EDGE + 1;
+                buffers[i].reserve(std::min(header.numberOfEdges/numberOfThreads + 1, static_cast<uint64_t>(maxEdges)));
+            }
+            parseChunk(begin, boundaries[i], boundaries[i+1], header, buffers[i]);
+        });
+
+    size_t numberOfEdges = 0;
+    for(size_t i = 0; i < buffers.size(); ++i)
+    {
+        numberOfEdges += buffers[i].size();
+    }
+
+    // Map the vertex ids to vertex indices
+    std::vector<uint64_t> ids;
+    uint64_t numberOfVertices = header.numberOfVertices;
+    bool compactVertexIds = mCompactVertexIds;
+    if(!compactVertexIds)
+    {
+        for(size_t i = 0; i < buffers.size(); ++i)
+        {
+            for(EdgeBuffer::const_iterator cit = buffers[i].begin(); cit != buffers[i].end(); ++cit)
+            {
+                numberOfVertices = std::max(numberOfVertices, std::max(cit->source, cit->target) + 1);
+            }
+        }
+
+        // Each edge refers to at most two distinct ids, so a much larger id
+        // range consists mostly of unused ids. The number of vertices given
+        // by the header is not trusted beyond the size of the file
+        uint64_t maxDenseVertices = std::max(static_cast<uint64_t>(end - begin), MAX_UNUSED_IDS_FACTOR*2*static_cast<uint64_t>(numberOfEdges));
+        if(numberOfVertices > maxDenseVertices)
+        {
+            LOG_WARN_S << "graph_analysis::io::" << getName() << ": maximum vertex id " << numberOfVertices - 1
+                << " is out of proportion to " << numberOfEdges << " edges -- compacting vertex ids";
+            compactVertexIds = true;
+        }
+    }
+
+    if(compactVertexIds)
+    {
+        std::vector< std::vector<uint64_t> > threadIds(numberOfThreads);
+        runParallel(numberOfThreads, [&](size_t i)
+            {
+                std::vector<uint64_t>& bufferIds = threadIds[i];
+                bufferIds.reserve(2*buffers[i].size());
+                for(EdgeBuffer::const_iterator cit = buffers[i].begin(); cit != buffers[i].end(); ++cit)
+                {
+                    bufferIds.push_back(cit->source);
+                    bufferIds.push_back(cit->target);
+                }
+                std::sort(bufferIds.begin(), bufferIds.end());
+                bufferIds.erase(std::unique(bufferIds.begin(), bufferIds.end()), bufferIds.end());
+            });
+
+        for(size_t i = 0; i < threadIds.size(); ++i)
+        {
+            size_t middle = ids.size();
+            ids.insert(ids.end(), threadIds[i].begin(), threadIds[i].end());
+            std::inplace_merge(ids.begin(), ids.begin() + middle, ids.end());
+            std::vector<uint64_t>().swap(threadIds[i]);
+        }
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        numberOfVertices = ids.size();
+
+        runParallel(numberOfThreads, [&](size_t i)
+            {
+                for(EdgeBuffer::iterator it = buffers[i].begin(); it != buffers[i].end(); ++it)
+                {
+                    it->source = std::lower_bound(ids.begin(), ids.end(), it->source) - ids.begin();
+                    it->target = std::lower_bound(ids.begin(), ids.end(), it->target) - ids.begin();
+                }
+            });
+    }
+
+    // Create the graph elements in order of their ids
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(numberOfVertices);
+    for(uint64_t i = 0; i < numberOfVertices; ++i)
+    {
+        uint64_t id = (compactVertexIds ? ids[i] : i) + header.firstId;
+        vertices.push_back(Vertex::Ptr(new Vertex(boost::lexical_cast<std::string>(id))));
+    }
+
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(numberOfEdges);
+    for(size_t i = 0; i < buffers.size(); ++i)
+    {
+        for(EdgeBuffer::const_iterator cit = buffers[i].begin(); cit != buffers[i].end(); ++cit)
+        {
+            const Vertex::Ptr& source = vertices[cit->source];
+            const Vertex::Ptr& target = vertices[cit->target];
+            if(mUseWeights && cit->weighted)
+            {
+                edges.push_back(Edge::Ptr(new WeightedEdge(source, target, cit->weight)));
+            } else {
+                edges.push_back(Edge::Ptr(new Edge(source, target)));
+            }
+        }
+        EdgeBuffer().swap(buffers[i]);
+    }
+
+    graph->clear();
+    graph->addVertices(vertices);
+    graph->addEdges(edges);
+}
+
+void ChunkedReader::parseChunk(const char* data, const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const
+{
+    const char* lineStart = begin;
+    while(lineStart < end)
+    {
+        const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', end - lineStart));
+        if(!lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        const char* contentEnd = lineEnd;
+        if(contentEnd > lineStart && *(contentEnd - 1) == '\r')
+        {
+            --contentEnd;
+        }
+
+        const char* contentStart = skipWhitespace(lineStart, contentEnd);
+        if(contentStart != contentEnd)
+        {
+            try {
+                parseLine(contentStart, contentEnd, header, edges);
+            } catch(const std::runtime_error& e)
+            {
+                std::stringstream ss;
+                ss << "graph_analysis::io::" << getName() << ": parsing error at byte offset "
+                    << (lineStart - data) << " in line '" << std::string(lineStart, contentEnd) << "' -- " << e.what();
+                throw std::runtime_error(ss.str());
+            }
+        }
+        lineStart = lineEnd + 1;
+    }
+}
+
+const char* ChunkedReader::skipWhitespace(const char* begin, const char* end)
+{
+    while(begin != end && (*begin == ' ' || *begin == '\t'))
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+const char* ChunkedReader::parseUnsigned(const char* begin, const char* end, uint64_t& value)
+{
+    const char* position = begin;
+    value = 0;
+    while(position != end && *position >= '0' && *position <= '9')
+    {
+        uint64_t digit = *position - '0';
+        if(value > (std::numeric_limits<uint64_t>::max() - digit)/10)
+        {
+            throw std::runtime_error("number '" + std::string(begin, position + 1) + "...' exceeds the range of an unsigned 64 bit integer");
+        }
+        value = value*10 + digit;
+        ++position;
+    }
+    return position == begin ? NULL : position;
+}
+
+const char* ChunkedReader::parseDouble(const char* begin, const char* end, double& value)
+{
+    // strtod requires a null terminated string, which the (mapped) buffer
+    // does not provide -- the C locale is used, so that the decimal point
+    // does not depend on the global locale
+    char token[64];
+    size_t length = 0;
+    while(begin + length != end && length < sizeof(token) - 1 && begin[length] != ' ' && begin[length] != '\t')
+    {
+        token[length] = begin[length];
+        ++length;
+    }
+    token[length] = 0;
+
+    char* tokenEnd = NULL;
+    value = strtod_l(token, &tokenEnd, classicLocale());
+    if(tokenEnd == token)
+    {
+        return NULL;
+    }
+    return begin + (tokenEnd - token);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
@@ -0,0 +1,167 @@
+#ifndef GRAPH_ANALYSIS_IO_CHUNKED_READER_HPP
+#define GRAPH_ANALYSIS_IO_CHUNKED_READER_HPP
+
+#include <vector>
+#include <stdint.h>
+#include "../GraphIO.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file ChunkedReader.hpp
+ * \class ChunkedReader
+ * \brief Base class for readers of line based formats, where each line
+ * describes a single edge between two vertices identified by integer ids
+ * \details The file is memory mapped and split into chunks at line
+ * boundaries. The chunks are parsed in parallel into per-thread edge buffers,
+ * which are finally merged into the graph in bulk.
+ *
+ * Subclasses implement parsing of the header and of a single line.
+ */
+class ChunkedReader : public Reader
+{
+public:
+    /**
+     * \param numberOfThreads Number of threads to use for parsing, 0 to
+     * use one thread per hardware thread
+     */
+    ChunkedReader(size_t numberOfThreads = 0);
+
+    virtual ~ChunkedReader() {}
+
+    /**
+     * Set the number of threads to use for parsing
+     * \param numberOfThreads Number of threads, 0 to use one thread per hardware thread
+     */
+    void setNumberOfThreads(size_t numberOfThreads) { mNumberOfThreads = numberOfThreads; }
+    size_t getNumberOfThreads() const { return mNumberOfThreads; }
+
+    /**
+     * Set whether vertex ids shall be compacted, i.e. only vertices that are
+     * referred to by an edge are created. Otherwise one vertex is created
+     * for each id up to the maximum id found in the file or the number of
+     * vertices given by the header -- unless this number is out of proportion
+     * to the number of edges and the size of the file, in which case ids are
+     * compacted nevertheless
+     */
+    void setCompactVertexIds(bool compact) { mCompactVertexIds = compact; }
+    bool getCompactVertexIds() const { return mCompactVertexIds; }
+
+    /**
+     * Set whether a weight column shall be mapped to a WeightedEdge. Otherwise
+     * weights are ignored and plain edges are created
+     */
+    void setUseWeights(bool useWeights) { mUseWeights = useWeights; }
+    bool getUseWeights() const { return mUseWeights; }
+
+    /**
+     * \brief reads the graph from the given file and stores it to the provided graph argument
+     * \details Vertices are labelled with their id as found in the file
+     * \param filename provided input filename
+     * \param graph target graph to store the parsed graph
+     */
+    void read(const std::string& filename, BaseGraph::Ptr graph);
+
+    /**
+     * \brief reads the graph from the given stream -- the stream content is
+     * buffered in memory and parsed like a mapped file
+     */
+    void read(std::istream& stream, BaseGraph::Ptr graph);
+
+protected:
+    /// Edge as parsed from a single line
+    struct ParsedEdge
+    {
+        uint64_t source;
+        uint64_t target;
+        double weight;
+        bool weighted;
+    };
+
+    typedef std::vector<ParsedEdge> EdgeBuffer;
+
+    /// Symmetry of the described adjacency matrix
+    enum Symmetry { GENERAL, SYMMETRIC, SKEW_SYMMETRIC };
+
+    /// Information that can be extracted from a header
+    struct Header
+    {
+        Header()
+            : numberOfVertices(0)
+            , numberOfEdges(0)
+            , firstId(0)
+            , symmetry(GENERAL)
+        {}
+
+        /// Number of vertices, 0 if unknown
+        uint64_t numberOfVertices;
+        /// Number of edges, 0 if unknown -- only used as a hint for the
+        /// reservation of edge buffers, which is bounded by the file size
+        uint64_t numberOfEdges;
+        /// Id of the first vertex in the file, i.e. the offset between
+        /// the ids in the file and the vertex indices used in ParsedEdge
+        uint64_t firstId;
+        /// Symmetric files list each edge only once, but describe edges in
+        /// both directions
+        Symmetry symmetry;
+    };
+
+    /**
+     * Parse the header of the file
+     * \return pointer to the first line after the header
+     * \throw std::runtime_error if the header is invalid
+     */
+    virtual const char* parseHeader(const char* begin, const char* end, Header& header) const = 0;
+
+    /**
+     * Parse a single non-empty line (without the trailing newline and leading
+     * whitespace) and append the described edges to the buffer -- source and
+     * target are vertex indices, i.e. already corrected by Header::firstId
+     * \throw std::runtime_error if the line is invalid
+     */
+    virtual void parseLine(const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const = 0;
+
+    /// Get name of the reader for error reporting
+    virtual std::string getName() const = 0;
+
+    /**
+     * Skip spaces and tabs
+     * \return pointer to the first character that is not a space or tab
+     */
+    static const char* skipWhitespace(const char* begin, const char* end);
+
+    /**
+     * Parse an unsigned integer
+     * \return pointer behind the parsed number, or NULL if there is no number
+     * \throws std::runtime_error if the number does not fit into 64 bit
+     */
+    static const char* parseUnsigned(const char* begin, const char* end, uint64_t& value);
+
+    /**
+     * Parse a floating point number -- independent of the global locale
+     * \return pointer behind the parsed number, or NULL if there is no number
+     */
+    static const char* parseDouble(const char* begin, const char* end, double& value);
+
+private:
+    /**
+     * Parse the content of a file held in [begin,end) and replace the content
+     * of the graph with it
+     */
+    void parse(const char* begin, const char* end, const BaseGraph::Ptr& graph) const;
+
+    /**
+     * Parse all lines in [begin,end) -- data is the start of the file and
+     * used for error reporting
+     */
+    void parseChunk(const char* data, const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const;
+
+    size_t mNumberOfThreads;
+    bool mCompactVertexIds;
+    bool mUseWeights;
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_CHUNKED_READER_HPP
@@ -0,0 +1,46 @@
+#include "EdgeListReader.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+const char* EdgeListReader::parseHeader(const char* begin, const char* end, Header& header) const
+{
+    // there is no header, but comments are handled while parsing the lines
+    (void) end;
+    (void) header;
+    return begin;
+}
+
+void EdgeListReader::parseLine(const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const
+{
+    (void) header;
+    if(*begin == '#' || *begin == '%')
+    {
+        return;
+    }
+
+    ParsedEdge edge;
+    const char* position = parseUnsigned(begin, end, edge.source);
+    if(!position)
+    {
+        throw std::runtime_error("source vertex id expected");
+    }
+
+    position = parseUnsigned(skipWhitespace(position, end), end, edge.target);
+    if(!position)
+    {
+        throw std::runtime_error("target vertex id expected");
+    }
+
+    position = skipWhitespace(position, end);
+    edge.weighted = position != end;
+    edge.weight = 0;
+    if(edge.weighted && !parseDouble(position, end, edge.weight))
+    {
+        throw std::runtime_error("weight expected");
+    }
+    edges.push_back(edge);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
@@ -0,0 +1,39 @@
+#ifndef GRAPH_ANALYSIS_IO_EDGE_LIST_READER_HPP
+#define GRAPH_ANALYSIS_IO_EDGE_LIST_READER_HPP
+
+#include "ChunkedReader.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file EdgeListReader.hpp
+ * \class EdgeListReader
+ * \brief Imports a graph from a whitespace separated edge list
+ * \details Each line contains the (non-negative integer) ids of the source
+ * and target vertex, optionally followed by a weight:
+ \verbatim
+ # comment
+ 0 1
+ 1 2 0.5
+ \endverbatim
+ * Lines starting with '#' or '%' are ignored, as well as any further columns
+ */
+class EdgeListReader : public ChunkedReader
+{
+public:
+    EdgeListReader(size_t numberOfThreads = 0)
+        : ChunkedReader(numberOfThreads)
+    {}
+
+protected:
+    const char* parseHeader(const char* begin, const char* end, Header& header) const;
+
+    void parseLine(const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const;
+
+    std::string getName() const { return "EdgeListReader"; }
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_EDGE_LIST_READER_HPP
@@ -376,6 +376,27 @@ void GVGraph::renderToFile(const std::string& filename, const std::string& layou
     }
 }
 
+void GVGraph::renderToStream(std::ostream& stream, const std::string& layout, const std::string& renderer, bool forced)
+{
+    if(forced || !mAppliedLayout)
+    {
+        applyLayout(layout);
+    }
+
+    char* data = NULL;
+    unsigned int length = 0;
+    int rc = gvRenderData(mpContext, mpGVGraph, renderer.c_str(), &data, &length);
+    if(-1 == rc)
+    {
+        std::string error_msg = std::string("graph_analysis::io::GVGraph: failed to make graphviz apply layout '") + layout
+            + "' for graph rendering to '" + renderer + "'";
+        LOG_ERROR_S << error_msg;
+        throw std::runtime_error(error_msg);
+    }
+    stream.write(data, length);
+    gvFreeRenderData(data);
+}
+
 boxf GVGraph::boundingRect() const
 {
     boxf box = GD_bb(mpGVGraph);
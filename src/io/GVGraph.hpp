@@ -213,6 +213,12 @@ public:
      * \param forced apply a relayouting
      */
     void renderToFile(const std::string& filename, const std::string& layout = "dot", const std::string& renderer = "dot", bool forced = false);
+
+    /**
+     * Render graph to a stream using a particular layout
+     * \see renderToFile
+     */
+    void renderToStream(std::ostream& stream, const std::string& layout = "dot", const std::string& renderer = "dot", bool forced = false);
     boxf boundingRect() const;
     void setRootNode(const Vertex::Ptr& vertex);
 
@@ -1,170 +1,437 @@
 #include "GexfReader.hpp"
+#include <cstring>
+#include <sstream>
+#include <libxml/xmlreader.h>
+#include <boost/unordered_map.hpp>
 #include <base-logging/Logging.hpp>
-#include <libgexf/nodeiter.h>
-#include <libgexf/edgeiter.h>
-#include <libgexf/filereader.h>
 #include "../VertexTypeManager.hpp"
 #include "../EdgeTypeManager.hpp"
 
 namespace graph_analysis {
 namespace io {
+namespace {
 
-void GexfReader::read(const std::string& filename, BaseGraph::Ptr graph)
+/**
+ * Attribute ids and serialization callbacks of a single type -- computed once
+ * per type and reused for all elements of this type
+ */
+struct TypeAttributes
+{
+    std::vector<std::string> keys;
+    std::vector<AttributeSerializationCallbacks> callbacks;
+};
+
+typedef boost::unordered_map<std::string, TypeAttributes> TypeAttributesCache;
+
+/// Attribute column of the graph, declared by an attribute with an id of
+/// the form 'column-<type>-<index>' (see GexfWriter)
+struct GraphColumn
+{
+    std::string key;
+    AttributeColumnBase::Ptr column;
+};
+
+/// Value of a graph column for the element with the given index in the list
+/// of pending vertices or edges -- set once the element has been added
+struct ColumnValue
 {
-    // loading relevant gexf lib components
-    libgexf::FileReader* reader = new libgexf::FileReader();
-    reader->init(filename.c_str());
-    reader->slurp(); // TODO: gexf.xsd schema needs to be downloaded and locally stored for a viable validation test with libgexf::SchemaValidator (see http://gexf.net/format/schema.html)
+    size_t element;
+    size_t column;
+    std::string value;
+};
 
-    // unwrapping the already parsed graph
-    libgexf::GEXF gexf = reader->getGEXFCopy();
-    libgexf::DirectedGraph& gexf_graph = gexf.getDirectedGraph();
-    libgexf::Data& data = gexf.getData();
+/**
+ * \class GexfStreamParser
+ * \brief Single pass parser for GEXF on top of the libxml2 text reader
+ * \details Vertices and edges are created when the closing tag of the
+ * respective element is found and inserted into the graph in bulk once the
+ * list of nodes or edges has been completed
+ */
+class GexfStreamParser
+{
+public:
+    GexfStreamParser(xmlTextReaderPtr reader, const std::string& source, const BaseGraph::Ptr& graph)
+        : mReader(reader)
+        , mSource(source)
+        , mGraph(graph)
+        , mVertexManager(VertexTypeManager::getInstance())
+        , mEdgeManager(EdgeTypeManager::getInstance())
+        , mAttributesScope(SCOPE_NONE)
+        , mElementScope(SCOPE_NONE)
+        , mNumberOfAttValues(0)
+    {}
 
-    std::string nodeClassAttr;
-    std::string nodeLabelAttr;
+    void parse()
     {
-        libgexf::AttributeIter* gexf_attribute_it = data.getNodeAttributeColumn();
-        while(gexf_attribute_it->hasNext())
+        int status = 0;
+        while((status = xmlTextReaderRead(mReader)) == 1)
         {
-            libgexf::t_id id = gexf_attribute_it->next();
-            std::string attributeLabel = gexf_attribute_it->currentTitle();
-
-            if(attributeLabel == "class" || attributeLabel == "CLASS")
+            const char* name = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(mReader));
+            if(!name)
             {
-                nodeClassAttr = id;
+                continue;
             }
-            if(attributeLabel == "label" || attributeLabel == "LABEL")
+
+            switch(xmlTextReaderNodeType(mReader))
             {
-                nodeLabelAttr = id;
+                case XML_READER_TYPE_ELEMENT:
+                {
+                    bool isEmpty = xmlTextReaderIsEmptyElement(mReader) == 1;
+                    startElement(name);
+                    if(isEmpty)
+                    {
+                        endElement(name);
+                    }
+                    break;
+                }
+                case XML_READER_TYPE_END_ELEMENT:
+                    endElement(name);
+                    break;
+                default:
+                    break;
             }
         }
 
-        if(nodeClassAttr.empty())
-        {
-            LOG_WARN_S << "No node attribute 'class' found";
-        }
-        if(nodeLabelAttr.empty())
+        if(status != 0)
         {
-            LOG_WARN_S << "No node attribute 'label' found";
+            throw std::runtime_error("graph_analysis::io::GexfReader: failed to parse '" + mSource + "'");
         }
+
+        // Account for files which do not properly close the lists
+        flushVertices();
+        flushEdges();
     }
 
-    std::string edgeClassAttr;
-    std::string edgeLabelAttr;
+private:
+    enum Scope { SCOPE_NONE, SCOPE_NODE, SCOPE_EDGE };
+
+    void startElement(const char* name)
     {
+        if(strcmp(name, "attvalue") == 0)
+        {
+            if(mElementScope == SCOPE_NONE)
+            {
+                return;
+            }
+
+            if(mAttValues.size() <= mNumberOfAttValues)
+            {
+                mAttValues.resize(mNumberOfAttValues + 1);
+            }
+            std::pair<std::string, std::string>& attValue = mAttValues[mNumberOfAttValues];
+            // GEXF 1.2 uses 'for', while older versions use 'id'
+            if(!getAttribute("for", attValue.first) && !getAttribute("id", attValue.first))
+            {
+                return;
+            }
+            getAttribute("value", attValue.second);
+            ++mNumberOfAttValues;
+        } else if(strcmp(name, "node") == 0)
+        {
+            mElementScope = SCOPE_NODE;
+            resetElement();
+            getAttribute("id", mId);
+            getAttribute("label", mLabel);
+        } else if(strcmp(name, "edge") == 0)
+        {
+            mElementScope = SCOPE_EDGE;
+            resetElement();
+            getAttribute("id", mId);
+            getAttribute("label", mLabel);
+            getAttribute("source", mSourceId);
+            getAttribute("target", mTargetId);
+        } else if(strcmp(name, "nodes") == 0)
+        {
+            size_t count = getCount();
+            mVertices.reserve(count);
+            mVertexMap.reserve(count);
+        } else if(strcmp(name, "edges") == 0)
+        {
+            mEdges.reserve(getCount());
+        } else if(strcmp(name, "attributes") == 0)
+        {
+            std::string attributeClass;
+            getAttribute("class", attributeClass);
+            if(attributeClass == "node")
+            {
+                mAttributesScope = SCOPE_NODE;
+            } else if(attributeClass == "edge")
+            {
+                mAttributesScope = SCOPE_EDGE;
+            } else {
+                mAttributesScope = SCOPE_NONE;
+            }
+        } else if(strcmp(name, "attribute") == 0)
+        {
+            std::string id;
+            std::string title;
+            getAttribute("id", id);
+            getAttribute("title", title);
 
-        libgexf::AttributeIter* gexf_attribute_it = data.getEdgeAttributeColumn();
-        while(gexf_attribute_it->hasNext())
+            if(mAttributesScope == SCOPE_NODE)
+            {
+                registerColumn(id, title, mNodeClassAttr, mNodeLabelAttr);
+                registerGraphColumn(id, title, mGraph->getVertexColumns(), mVertexColumns);
+            } else if(mAttributesScope == SCOPE_EDGE)
+            {
+                registerColumn(id, title, mEdgeClassAttr, mEdgeLabelAttr);
+                registerGraphColumn(id, title, mGraph->getEdgeColumns(), mEdgeColumns);
+            }
+        } else if(strcmp(name, "graph") == 0)
         {
-            libgexf::t_id id = gexf_attribute_it->next();
-            std::string attributeLabel = gexf_attribute_it->currentTitle();
+            mAttributesScope = SCOPE_NONE;
+        }
+    }
 
-            if(attributeLabel == "class" || attributeLabel == "CLASS")
+    void endElement(const char* name)
+    {
+        if(strcmp(name, "node") == 0)
+        {
+            if(mElementScope == SCOPE_NODE)
             {
-                edgeClassAttr = id;
+                createVertex();
             }
-            if(attributeLabel == "label" || attributeLabel == "LABEL")
+            mElementScope = SCOPE_NONE;
+        } else if(strcmp(name, "edge") == 0)
+        {
+            if(mElementScope == SCOPE_EDGE)
             {
-                edgeLabelAttr = id;
+                createEdge();
             }
+            mElementScope = SCOPE_NONE;
+        } else if(strcmp(name, "nodes") == 0)
+        {
+            flushVertices();
+        } else if(strcmp(name, "edges") == 0)
+        {
+            flushEdges();
+        } else if(strcmp(name, "attributes") == 0)
+        {
+            mAttributesScope = SCOPE_NONE;
         }
+    }
 
-        if(edgeClassAttr.empty())
+    /**
+     * Retrieve the value of an attribute of the current xml element
+     * \return true if the attribute exists, false otherwise
+     */
+    bool getAttribute(const char* name, std::string& value)
+    {
+        if(xmlTextReaderMoveToAttribute(mReader, reinterpret_cast<const xmlChar*>(name)) != 1)
         {
-            LOG_WARN_S << "No edge attribute 'class' found";
+            return false;
         }
-        if(edgeLabelAttr.empty())
+        const char* data = reinterpret_cast<const char*>(xmlTextReaderConstValue(mReader));
+        if(data)
         {
-            LOG_WARN_S << "No edge attribute 'label' found";
+            value.assign(data);
+        } else {
+            value.clear();
         }
+        xmlTextReaderMoveToElement(mReader);
+        return true;
     }
 
-    // storing the graph elements to the internal baseGraph
-    graph->clear();
-    VertexMap vertexMap;
-    // storing the nodes and their properties
-    libgexf::NodeIter* node_it = gexf_graph.getNodes();
-    // having this pointer might come handy...
-    VertexTypeManager *vManager = VertexTypeManager::getInstance();
-    while(node_it->hasNext())
+    size_t getCount()
+    {
+        std::string count;
+        if(getAttribute("count", count))
+        {
+            return strtoul(count.c_str(), NULL, 10);
+        }
+        return 0;
+    }
+
+    void registerColumn(const std::string& id, const std::string& title, std::string& classAttr, std::string& labelAttr)
     {
-        libgexf::t_id current = node_it->next();
-        std::string nodeLabel = "";
-        if(!nodeLabelAttr.empty())
+        if(title == "class" || title == "CLASS")
         {
-            nodeLabel = data.getNodeAttribute(current, nodeLabelAttr);
-        } else if(data.hasNodeLabel(current))
+            classAttr = id;
+        } else if(title == "label" || title == "LABEL")
         {
-            nodeLabel = data.getNodeLabel(current);
+            labelAttr = id;
         }
+    }
 
-        std::string nodeClass = vManager->getDefaultType();
-        if(!nodeClassAttr.empty())
+    /**
+     * Create the attribute column of the graph, if the given attribute
+     * declares one
+     */
+    void registerGraphColumn(const std::string& id, const std::string& title, AttributeColumns& columns, std::vector<GraphColumn>& graphColumns)
+    {
+        const std::string prefix = "column-";
+        size_t typeEnd = id.rfind('-');
+        if(id.compare(0, prefix.size(), prefix) != 0 || typeEnd < prefix.size())
         {
-            nodeClass = data.getNodeAttribute(current, nodeClassAttr);
+            return;
         }
 
-        Vertex::Ptr vertex;
         try {
-            vertex = vManager->createVertex(nodeClass, nodeLabel, true);
-        } catch(const std::exception& e)
+            std::map<std::string, attribute::ColumnType> columnTypes;
+            columnTypes[title] = attribute::getColumnType(id.substr(prefix.size(), typeEnd - prefix.size()));
+            columns.add(columnTypes);
+
+            GraphColumn graphColumn;
+            graphColumn.key = id;
+            graphColumn.column = columns.getColumn(title);
+            graphColumns.push_back(graphColumn);
+        } catch(const std::invalid_argument& e)
         {
-            LOG_WARN_S << "Unsupported vertex type: '" << nodeClass << "' -- will use a placeholder node: " << e.what();
-            vertex = Vertex::Ptr(new Vertex("Instance of unsupported vertex type: " + nodeClass + ": " + nodeLabel));
+            throw std::runtime_error("graph_analysis::io::GexfReader: invalid attribute column '" + title + "' in '" + mSource + "' -- " + e.what());
         }
-        graph->addVertex(vertex);
+    }
 
-        std::vector<std::string> attributes = vManager->getAttributes(vertex->getClassName());
+    /**
+     * Collect the values of the graph columns of the current element
+     */
+    void collectColumnValues(const std::vector<GraphColumn>& graphColumns, size_t element, std::vector<ColumnValue>& columnValues) const
+    {
+        for(size_t i = 0; i < graphColumns.size(); ++i)
+        {
+            const std::string* value = findAttValue(graphColumns[i].key);
+            if(value)
+            {
+                ColumnValue columnValue;
+                columnValue.element = element;
+                columnValue.column = i;
+                columnValue.value = *value;
+                columnValues.push_back(columnValue);
+            }
+        }
+    }
+
+    GraphElementId getElementId(const Vertex::Ptr& vertex) const { return mGraph->getVertexId(vertex); }
+    GraphElementId getElementId(const Edge::Ptr& edge) const { return mGraph->getEdgeId(edge); }
+
+    /**
+     * Set the collected column values of the given elements, which have been
+     * added to the graph
+     */
+    template<typename T>
+    void applyColumnValues(const std::vector<GraphColumn>& graphColumns, const std::vector<T>& elements, std::vector<ColumnValue>& columnValues)
+    {
+        for(size_t i = 0; i < columnValues.size(); ++i)
+        {
+            const ColumnValue& columnValue = columnValues[i];
+            const AttributeColumnBase::Ptr& column = graphColumns[columnValue.column].column;
+            try {
+                column->setText(getElementId(elements[columnValue.element]), columnValue.value);
+            } catch(const std::invalid_argument& e)
+            {
+                throw std::runtime_error("graph_analysis::io::GexfReader: invalid value of attribute column '" + column->getName() + "' in '" + mSource + "' -- " + e.what());
+            }
+        }
+        columnValues.clear();
+    }
+
+    void resetElement()
+    {
+        mId.clear();
+        mLabel.clear();
+        mSourceId.clear();
+        mTargetId.clear();
+        mNumberOfAttValues = 0;
+    }
+
+    /**
+     * Find the attribute value for the given attribute id in the current element
+     * \return pointer to the value, or NULL if the value does not exist
+     */
+    const std::string* findAttValue(const std::string& key) const
+    {
+        if(key.empty())
+        {
+            return NULL;
+        }
+
+        for(size_t i = 0; i < mNumberOfAttValues; ++i)
+        {
+            if(mAttValues[i].first == key)
+            {
+                return &mAttValues[i].second;
+            }
+        }
+        return NULL;
+    }
+
+    const TypeAttributes& getTypeAttributes(TypeAttributesCache& cache, AttributeManager* manager, const std::string& className)
+    {
+        TypeAttributesCache::const_iterator cit = cache.find(className);
+        if(cit != cache.end())
+        {
+            return cit->second;
+        }
+
+        TypeAttributes& typeAttributes = cache[className];
+        std::vector<std::string> attributes = manager->getAttributes(className);
+        typeAttributes.keys.reserve(attributes.size());
+        typeAttributes.callbacks.reserve(attributes.size());
 
         uint32_t memberCount = 0;
         std::vector<std::string>::const_iterator attributesIt = attributes.begin();
         for(; attributesIt != attributes.end(); ++attributesIt)
         {
             std::stringstream attrId;
-            attrId << vertex->getClassName() << "-attribute-" << memberCount++;
-            /// Retrieve GEXF data
-            std::string attributeData = data.getNodeAttribute(current, attrId.str());
-
-            io::AttributeSerializationCallbacks callbacks = vManager->getAttributeSerializationCallbacks(vertex->getClassName(),*attributesIt);
-            (vertex.get()->*callbacks.deserializeFunction)(attributeData);
+            attrId << className << "-attribute-" << memberCount++;
+            typeAttributes.keys.push_back(attrId.str());
+            typeAttributes.callbacks.push_back(manager->getAttributeSerializationCallbacks(className, *attributesIt));
         }
-
-        vertexMap[current] = vertex;
+        return typeAttributes;
     }
-    // storing the edges and their properties
-    libgexf::EdgeIter* edge_it = gexf_graph.getEdges();
-    // having this pointer might come handy...
-    EdgeTypeManager *eManager = EdgeTypeManager::getInstance();
-    while(edge_it->hasNext())
+
+    void createVertex()
     {
-        libgexf::t_id current = edge_it->next();
-        std::string edgeLabel = "";
-        if(!edgeLabelAttr.empty())
+        const std::string* labelValue = findAttValue(mNodeLabelAttr);
+        const std::string& nodeLabel = labelValue ? *labelValue : mLabel;
+
+        const std::string* classValue = findAttValue(mNodeClassAttr);
+        const std::string& nodeClass = classValue ? *classValue : mVertexManager->getDefaultType();
+
+        Vertex::Ptr vertex;
+        try {
+            vertex = mVertexManager->createVertex(nodeClass, nodeLabel, true);
+        } catch(const std::exception& e)
         {
-            edgeLabel = data.getEdgeAttribute(current, edgeLabelAttr);
-        } else if(data.hasEdgeLabel(current))
+            LOG_WARN_S << "Unsupported vertex type: '" << nodeClass << "' -- will use a placeholder node: " << e.what();
+            vertex = Vertex::Ptr(new Vertex("Instance of unsupported vertex type: " + nodeClass + ": " + nodeLabel));
+        }
+
+        const TypeAttributes& typeAttributes = getTypeAttributes(mVertexTypes, mVertexManager, vertex->getClassName());
+        for(size_t i = 0; i < typeAttributes.keys.size(); ++i)
         {
-            edgeLabel = data.getEdgeLabel(current);
+            const std::string* attributeData = findAttValue(typeAttributes.keys[i]);
+            const AttributeSerializationCallbacks& callbacks = typeAttributes.callbacks[i];
+            callbacks.deserialize(vertex.get(), attributeData ? *attributeData : std::string());
         }
 
-        std::string edgeClass = eManager->getDefaultType();
-        if(!edgeClassAttr.empty())
+        if(!mVertexMap.insert(std::make_pair(mId, vertex)).second)
         {
-            edgeClass = data.getEdgeAttribute(current, edgeClassAttr);
+            throw std::runtime_error("graph_analysis::io::GexfReader: duplicate node id '" + mId + "' in '" + mSource + "'");
         }
+        collectColumnValues(mVertexColumns, mVertices.size(), mVertexColumnValues);
+        mVertices.push_back(vertex);
+    }
+
+    void createEdge()
+    {
+        const std::string* labelValue = findAttValue(mEdgeLabelAttr);
+        const std::string& edgeLabel = labelValue ? *labelValue : mLabel;
+
+        const std::string* classValue = findAttValue(mEdgeClassAttr);
+        const std::string& edgeClass = classValue ? *classValue : mEdgeManager->getDefaultType();
+
+        Vertex::Ptr sourceVertex = getVertex(mSourceId);
+        Vertex::Ptr targetVertex = getVertex(mTargetId);
 
-        Vertex::Ptr sourceVertex = vertexMap[edge_it->currentSource()]; // NOTE: assumes the .gexf(.xml) file is valid
-        Vertex::Ptr targetVertex = vertexMap[edge_it->currentTarget()]; // NOTE: assumes the .gexf(.xml) file is valid
         Edge::Ptr edge;
         try {
-            edge = eManager->createEdge(edgeClass, sourceVertex, targetVertex, edgeLabel, true);
+            edge = mEdgeManager->createEdge(edgeClass, sourceVertex, targetVertex, edgeLabel, true);
         } catch(const std::exception& e)
         {
             LOG_WARN_S << "Unsupported edge type: '" << edgeClass << "' -- will use a placeholder edge: " << e.what();
 
             std::stringstream ss;
-            std::set<std::string> supportedTypes = eManager->getSupportedTypes();
+            std::set<std::string> supportedTypes = mEdgeManager->getSupportedTypes();
             std::set<std::string>::const_iterator cit = supportedTypes.begin();
             for(; cit != supportedTypes.end(); ++cit)
             {
@@ -173,29 +440,135 @@ void GexfReader::read(const std::string& filename, BaseGraph::Ptr graph)
             LOG_WARN_S << "Supported types are: " << ss.str();
             edge = Edge::Ptr(new Edge(sourceVertex, targetVertex, "Instance of unsupported edge type: " + edgeClass + ": " + edgeLabel));
         }
-        graph->addEdge(edge);
 
+        const TypeAttributes& typeAttributes = getTypeAttributes(mEdgeTypes, mEdgeManager, edge->getClassName());
+        for(size_t i = 0; i < typeAttributes.keys.size(); ++i)
+        {
+            const std::string* attributeData = findAttValue(typeAttributes.keys[i]);
+            if(attributeData && !attributeData->empty())
+            {
+                const AttributeSerializationCallbacks& callbacks = typeAttributes.callbacks[i];
+                callbacks.deserialize(edge.get(), *attributeData);
+            }
+        }
 
-        std::vector<std::string> attributes = eManager->getAttributes(edge->getClassName());
+        collectColumnValues(mEdgeColumns, mEdges.size(), mEdgeColumnValues);
+        mEdges.push_back(edge);
+    }
 
-        uint32_t memberCount = 0;
-        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
-        for(; attributesIt != attributes.end(); ++attributesIt)
+    Vertex::Ptr getVertex(const std::string& id) const
+    {
+        boost::unordered_map<std::string, Vertex::Ptr>::const_iterator cit = mVertexMap.find(id);
+        if(cit == mVertexMap.end())
         {
-            std::stringstream attrId;
-            attrId << edge->getClassName() << "-attribute-" << memberCount++;
-            /// Retrieve GEXF data
-            std::string attributeData = data.getEdgeAttribute(current, attrId.str());
+            throw std::runtime_error("graph_analysis::io::GexfReader: edge '" + mId + "' refers to unknown node '" + id + "' in '" + mSource + "'");
+        }
+        return cit->second;
+    }
 
-            if(!attributeData.empty())
-            {
-                io::AttributeSerializationCallbacks callbacks = eManager->getAttributeSerializationCallbacks(edge->getClassName(),*attributesIt);
-                (edge.get()->*callbacks.deserializeFunction)(attributeData);
-            }
+    void flushVertices()
+    {
+        if(!mVertices.empty())
+        {
+            mGraph->addVertices(mVertices);
+            applyColumnValues(mVertexColumns, mVertices, mVertexColumnValues);
+            mVertices.clear();
+        }
+    }
+
+    void flushEdges()
+    {
+        // make sure that all vertices are known to the graph
+        flushVertices();
+        if(!mEdges.empty())
+        {
+            mGraph->addEdges(mEdges);
+            applyColumnValues(mEdgeColumns, mEdges, mEdgeColumnValues);
+            mEdges.clear();
         }
     }
 
-    delete reader;
+    xmlTextReaderPtr mReader;
+    std::string mSource;
+    BaseGraph::Ptr mGraph;
+
+    VertexTypeManager* mVertexManager;
+    EdgeTypeManager* mEdgeManager;
+
+    /// Attribute ids of the class and label columns
+    std::string mNodeClassAttr;
+    std::string mNodeLabelAttr;
+    std::string mEdgeClassAttr;
+    std::string mEdgeLabelAttr;
+    Scope mAttributesScope;
+
+    /// Data of the node or edge which is currently parsed
+    Scope mElementScope;
+    std::string mId;
+    std::string mLabel;
+    std::string mSourceId;
+    std::string mTargetId;
+    /// Attribute values of the current element -- entries are reused
+    /// between elements to avoid reallocation
+    std::vector< std::pair<std::string, std::string> > mAttValues;
+    size_t mNumberOfAttValues;
+
+    boost::unordered_map<std::string, Vertex::Ptr> mVertexMap;
+    std::vector<Vertex::Ptr> mVertices;
+    std::vector<Edge::Ptr> mEdges;
+
+    TypeAttributesCache mVertexTypes;
+    TypeAttributesCache mEdgeTypes;
+
+    std::vector<GraphColumn> mVertexColumns;
+    std::vector<GraphColumn> mEdgeColumns;
+    std::vector<ColumnValue> mVertexColumnValues;
+    std::vector<ColumnValue> mEdgeColumnValues;
+};
+
+/**
+ * Input callback for the libxml2 text reader to read from a std::istream
+ */
+int readFromStream(void* context, char* buffer, int length)
+{
+    std::istream* stream = static_cast<std::istream*>(context);
+    stream->read(buffer, length);
+    if(stream->bad())
+    {
+        return -1;
+    }
+    return static_cast<int>(stream->gcount());
+}
+
+} // end anonymous namespace
+
+void GexfReader::read(const std::string& filename, BaseGraph::Ptr graph)
+{
+    shared_ptr<xmlTextReader> reader(xmlReaderForFile(filename.c_str(), NULL, XML_PARSE_NONET | XML_PARSE_HUGE), xmlFreeTextReader);
+    if(!reader)
+    {
+        throw std::runtime_error("graph_analysis::io::GexfReader: failed to open '" + filename + "'");
+    }
+
+    // storing the graph elements to the internal baseGraph
+    graph->clear();
+
+    GexfStreamParser parser(reader.get(), filename, graph);
+    parser.parse();
+}
+
+void GexfReader::read(std::istream& stream, BaseGraph::Ptr graph)
+{
+    shared_ptr<xmlTextReader> reader(xmlReaderForIO(readFromStream, NULL, &stream, NULL, NULL, XML_PARSE_NONET | XML_PARSE_HUGE), xmlFreeTextReader);
+    if(!reader)
+    {
+        throw std::runtime_error("graph_analysis::io::GexfReader: failed to read from stream");
+    }
+
+    graph->clear();
+
+    GexfStreamParser parser(reader.get(), "<stream>", graph);
+    parser.parse();
 }
 
 } // end namespace io
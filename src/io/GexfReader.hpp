@@ -1,8 +1,6 @@
 #ifndef GRAPH_ANALYSIS_IO_GEXF_READER_HPP
 #define GRAPH_ANALYSIS_IO_GEXF_READER_HPP
 
-#include <map>
-#include <libgexf/gexf.h>
 #include "../GraphIO.hpp"
 #include "../Vertex.hpp"
 #include "../Edge.hpp"
@@ -15,11 +13,11 @@ namespace io {
  * \class GexfReader
  * \brief Imports a base graph from a given GEXF file
  * \details Parses an input gexf file to the requested target graph (forms a base graph)
+ * The file is processed as a stream, i.e. vertices and edges are created while
+ * parsing without building an intermediate document in memory
  */
 class GexfReader : public Reader
 {
-    typedef std::map < libgexf::t_id, Vertex::Ptr > VertexMap;
-
 public:
     /**
      * \brief reads the graph from the given file and stores it to the provided graph argument
@@ -27,6 +25,13 @@ public:
      * \param graph target graph to store the parsed graph
      */
     void read(const std::string& filename, BaseGraph::Ptr graph);
+
+    /**
+     * \brief reads the graph from the given stream and stores it to the provided graph argument
+     * \param stream input stream
+     * \param graph target graph to store the parsed graph
+     */
+    void read(std::istream& stream, BaseGraph::Ptr graph);
 };
 
 } // end namespace io
@@ -1,8 +1,7 @@
 #include "GexfWriter.hpp"
-#include <stdlib.h>
-#include <libgexf/gexf.h>
-#include <libgexf/filewriter.h>
-#include <boost/lexical_cast.hpp>
+#include <fstream>
+#include <sstream>
+#include <boost/unordered_map.hpp>
 #include <boost/xpressive/xpressive.hpp>
 #include <base-logging/Logging.hpp>
 #include "../VertexTypeManager.hpp"
@@ -10,148 +9,286 @@
 
 namespace graph_analysis {
 namespace io {
+namespace {
 
-void GexfWriter::write(const std::string& filename, const BaseGraph& graph) const
+/**
+ * Attribute ids, titles and serialization callbacks of a single type --
+ * computed once per type and reused for all elements of this type
+ */
+struct TypeAttributes
 {
-    BaseGraph graph_copy = graph;
-    write(filename, BaseGraph::Ptr(&graph_copy)); // reusing code
-}
+    std::vector<std::string> keys;
+    std::vector<std::string> titles;
+    std::vector<AttributeSerializationCallbacks> callbacks;
+};
 
-void GexfWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+typedef boost::unordered_map<std::string, TypeAttributes> TypeAttributesCache;
+
+const TypeAttributes& getTypeAttributes(TypeAttributesCache& cache, AttributeManager* manager, const std::string& className)
 {
-    // loading gexf lib main components
-    libgexf::GEXF gexf;
-    libgexf::DirectedGraph& digraph = gexf.getDirectedGraph();
-    libgexf::Data& data = gexf.getData();
-
-    std::string classAttr = CLASS; // see "GraphIO.hpp"
-    data.addNodeAttributeColumn(classAttr, "class", "STRING");
-    //data.setNodeAttributeDefault(classAttr,"")
-    data.addEdgeAttributeColumn(classAttr, "class", "STRING");
-    //data.setEdgeAttributeDefault(classAttr,"")
-
-    std::string labelAttr = LABEL; // see "GraphIO.hpp"
-    data.addNodeAttributeColumn(labelAttr, "label", "STRING");
-    data.addEdgeAttributeColumn(labelAttr, "label", "STRING");
-
-    // Add custom atttribute serialization for vertex types that have been
-    // registered in the vertex type manager
-    VertexTypeManager *vManager = VertexTypeManager::getInstance();
-    std::set<std::string> types = vManager->getSupportedTypes();
-    for(std::set<std::string>::const_iterator type_it = types.begin(); type_it != types.end(); type_it++)
+    TypeAttributesCache::const_iterator cit = cache.find(className);
+    if(cit != cache.end())
     {
-        uint32_t memberCount = 0;
-        std::vector<std::string> attributes = vManager->getAttributes(*type_it);
-        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
-        for(; attributesIt != attributes.end(); attributesIt++)
-        {
-            std::stringstream attrId;
-            attrId << *type_it << "-attribute-" << memberCount++;
-            LOG_DEBUG_S << "Adding custom node attribute: id: " << attrId.str() << ", title: " << *attributesIt << ", type: STRING";
-            data.addNodeAttributeColumn(attrId.str(), *attributesIt, "STRING");
-        }
+        return cit->second;
     }
 
-    // loading the nodes and their attributes to the gexf components
-    VertexIterator::Ptr vit = graph->getVertexIterator();
-    while(vit->next())
+    TypeAttributes& typeAttributes = cache[className];
+    typeAttributes.titles = manager->getAttributes(className);
+    typeAttributes.keys.reserve(typeAttributes.titles.size());
+    typeAttributes.callbacks.reserve(typeAttributes.titles.size());
+
+    uint32_t memberCount = 0;
+    std::vector<std::string>::const_iterator attributesIt = typeAttributes.titles.begin();
+    for(; attributesIt != typeAttributes.titles.end(); ++attributesIt)
     {
-        Vertex::Ptr vertex = vit->current();
-        std::string nodeIdString = boost::lexical_cast<std::string>( graph->getVertexId(vertex) );
-        digraph.addNode(nodeIdString);
+        std::stringstream attrId;
+        attrId << className << "-attribute-" << memberCount++;
+        typeAttributes.keys.push_back(attrId.str());
+        typeAttributes.callbacks.push_back(manager->getAttributeSerializationCallbacks(className, *attributesIt));
+    }
+    return typeAttributes;
+}
 
-        data.setNodeLabel(nodeIdString, vertex->getLabel() );
-        data.setNodeValue(nodeIdString, classAttr, vertex->getClassName());
-        data.setNodeValue(nodeIdString, labelAttr, vertex->getLabel());
+/**
+ * Attribute column of the graph together with its GEXF attribute id, which
+ * encodes the column type, e.g. 'column-double-0'
+ */
+struct GraphColumn
+{
+    std::string key;
+    AttributeColumnBase::Ptr column;
+};
 
-        std::vector<std::string> attributes = vManager->getAttributes(vertex->getClassName());
-        uint32_t memberCount = 0;
-        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
-        for(; attributesIt != attributes.end(); ++attributesIt)
-        {
-            std::stringstream attrId;
-            attrId << vertex->getClassName() << "-attribute-" << memberCount++;
-            io::AttributeSerializationCallbacks callbacks = vManager->getAttributeSerializationCallbacks(vertex->getClassName(),*attributesIt);
-            data.setNodeValue(nodeIdString, attrId.str(), (vertex.get()->*callbacks.serializeFunction)());
-        }
+std::vector<GraphColumn> getGraphColumns(const AttributeColumns& columns)
+{
+    std::vector<GraphColumn> graphColumns;
+    AttributeColumns::ColumnMap::const_iterator cit = columns.getColumns().begin();
+    for(; cit != columns.getColumns().end(); ++cit)
+    {
+        std::stringstream key;
+        key << "column-" << attribute::ColumnTypeTxt[cit->second->getType()] << "-" << graphColumns.size();
+
+        GraphColumn graphColumn;
+        graphColumn.key = key.str();
+        graphColumn.column = cit->second;
+        graphColumns.push_back(graphColumn);
     }
+    return graphColumns;
+}
 
-    // Add custom atttribute serialization for vertex types that have been
-    // registered in the vertex type manager
-    EdgeTypeManager *eManager = EdgeTypeManager::getInstance();
-    std::set<std::string> edgeTypes = eManager->getSupportedTypes();
-    for(std::set<std::string>::const_iterator type_it = edgeTypes.begin(); type_it != edgeTypes.end(); type_it++)
+/**
+ * Write a string as xml attribute value, i.e. with all special characters
+ * being escaped
+ */
+void writeEscaped(std::ostream& stream, const std::string& value)
+{
+    size_t start = 0;
+    for(size_t i = 0; i < value.size(); ++i)
     {
-        uint32_t memberCount = 0;
-        std::vector<std::string> attributes = eManager->getAttributes(*type_it);
-        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
-        for(; attributesIt != attributes.end(); attributesIt++)
+        const char* replacement = NULL;
+        switch(value[i])
         {
-            std::stringstream attrId;
-            attrId << *type_it << "-attribute-" << memberCount++;
-            LOG_DEBUG_S << "Adding custom edge attribute: id: " << attrId.str() << ", title: " << *attributesIt << ", type: STRING";
-            data.addEdgeAttributeColumn(attrId.str(), *attributesIt, "STRING");
+            case '&': replacement = "&amp;"; break;
+            case '<': replacement = "&lt;"; break;
+            case '>': replacement = "&gt;"; break;
+            case '"': replacement = "&quot;"; break;
+            case '\n': replacement = "&#10;"; break;
+            case '\r': replacement = "&#13;"; break;
+            case '\t': replacement = "&#9;"; break;
+            default:
+                continue;
         }
+        stream.write(value.data() + start, i - start);
+        stream << replacement;
+        start = i + 1;
     }
+    stream.write(value.data() + start, value.size() - start);
+}
 
-    // loading the edges and their attributes to the gexf components
-    EdgeIterator::Ptr eit = graph->getEdgeIterator();
-    while(eit->next())
+void writeAttValue(std::ostream& stream, const std::string& key, const std::string& value)
+{
+    stream << "          <attvalue for=\"";
+    writeEscaped(stream, key);
+    stream << "\" value=\"";
+    writeEscaped(stream, value);
+    stream << "\"/>\n";
+}
+
+/**
+ * Write the values of an element in the attribute columns of the graph
+ */
+void writeColumnValues(std::ostream& stream, const std::vector<GraphColumn>& graphColumns, GraphElementId id)
+{
+    for(size_t i = 0; i < graphColumns.size(); ++i)
     {
-        Edge::Ptr edge = eit->current();
-        std::string edgeId = boost::lexical_cast<std::string>( graph->getEdgeId(edge) );
-        std::string srcNode = boost::lexical_cast<std::string>( graph->getVertexId( edge->getSourceVertex() ) );
-        std::string targetNode = boost::lexical_cast<std::string>( graph->getVertexId( edge->getTargetVertex() ) );
+        const GraphColumn& graphColumn = graphColumns[i];
+        if(id < graphColumn.column->size())
+        {
+            writeAttValue(stream, graphColumn.key, graphColumn.column->getText(id));
+        }
+    }
+}
 
-        digraph.addEdge(edgeId, srcNode, targetNode);
-        data.setEdgeLabel(edgeId, edge->getLabel() );
-        data.setEdgeValue(edgeId, classAttr, edge->getClassName());
-        data.setEdgeValue(edgeId, labelAttr, edge->getLabel());
+/**
+ * Declare the attribute columns for all registered types of the given manager
+ * and the attribute columns of the graph
+ */
+void writeAttributeColumns(std::ostream& stream, const std::string& elementClass, TypeAttributesCache& cache, AttributeManager* manager, const std::set<std::string>& types,
+        const std::vector<GraphColumn>& graphColumns)
+{
+    stream << "    <attributes class=\"" << elementClass << "\" mode=\"static\">\n";
+    stream << "      <attribute id=\"" << CLASS << "\" title=\"class\" type=\"string\"/>\n"; // see "GraphIO.hpp"
+    stream << "      <attribute id=\"" << LABEL << "\" title=\"label\" type=\"string\"/>\n";
 
+    // Add custom atttribute serialization for types that have been
+    // registered in the type manager
+    std::set<std::string>::const_iterator typeIt = types.begin();
+    for(; typeIt != types.end(); ++typeIt)
+    {
+        const TypeAttributes& typeAttributes = getTypeAttributes(cache, manager, *typeIt);
+        for(size_t i = 0; i < typeAttributes.keys.size(); ++i)
+        {
+            LOG_DEBUG_S << "Adding custom " << elementClass << " attribute: id: " << typeAttributes.keys[i] << ", title: " << typeAttributes.titles[i] << ", type: STRING";
+            stream << "      <attribute id=\"";
+            writeEscaped(stream, typeAttributes.keys[i]);
+            stream << "\" title=\"";
+            writeEscaped(stream, typeAttributes.titles[i]);
+            stream << "\" type=\"string\"/>\n";
+        }
+    }
 
-        std::vector<std::string> attributes = eManager->getAttributes(edge->getClassName());
-        uint32_t memberCount = 0;
-        std::vector<std::string>::const_iterator attributesIt = attributes.begin();
-        for(; attributesIt != attributes.end(); ++attributesIt)
+    for(size_t i = 0; i < graphColumns.size(); ++i)
+    {
+        const GraphColumn& graphColumn = graphColumns[i];
+        const char* type = "string";
+        switch(graphColumn.column->getType())
         {
-            std::stringstream attrId;
-            attrId << edge->getClassName() << "-attribute-" << memberCount++;
-            io::AttributeSerializationCallbacks callbacks = eManager->getAttributeSerializationCallbacks(edge->getClassName(),*attributesIt);
-            data.setEdgeValue(edgeId, attrId.str(), (edge.get()->*callbacks.serializeFunction)());
+            case attribute::INT:
+                type = "long";
+                break;
+            case attribute::DOUBLE:
+                type = "double";
+                break;
+            default:
+                break;
         }
+        stream << "      <attribute id=\"" << graphColumn.key << "\" title=\"";
+        writeEscaped(stream, graphColumn.column->getName());
+        stream << "\" type=\"" << type << "\"/>\n";
     }
+    stream << "    </attributes>\n";
+}
 
-    // calling the gexf lib renderer
-    libgexf::FileWriter writer;
+} // end anonymous namespace
+
+void GexfWriter::write(const std::string& filename, const BaseGraph& graph) const
+{
     boost::xpressive::sregex regex = boost::xpressive::as_xpr(".gexf");
     std::string replace("");
     std::string name = boost::xpressive::regex_replace(filename, regex, replace);
-
     name = name + ".gexf";
-    writer.init(name, &gexf);
-    writer.write();
 
-    if(std::string::npos != name.find(' '))
+    std::vector<char> buffer(1 << 16);
+    std::ofstream outfile;
+    outfile.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    outfile.open(name.c_str(), std::ios::out | std::ios::binary);
+    if(!outfile.is_open())
+    {
+        throw std::runtime_error("graph_analysis::io::GexfWriter::write: failed to open '" + name + "' for writing");
+    }
+
+    write(outfile, graph);
+
+    outfile.close();
+    if(outfile.fail())
     {
-        // disregarding the formatting stage for filenames containing blanks
-        return;
+        throw std::runtime_error("graph_analysis::io::GexfWriter::write: failed to write '" + name + "'");
     }
+}
+
+void GexfWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+{
+    write(filename, *graph);
+}
+
+void GexfWriter::write(std::ostream& stream, const BaseGraph& graph) const
+{
+    VertexTypeManager *vManager = VertexTypeManager::getInstance();
+    EdgeTypeManager *eManager = EdgeTypeManager::getInstance();
+
+    TypeAttributesCache vertexTypes;
+    TypeAttributesCache edgeTypes;
+
+    std::vector<GraphColumn> vertexColumns = getGraphColumns(graph.getVertexColumns());
+    std::vector<GraphColumn> edgeColumns = getGraphColumns(graph.getEdgeColumns());
+
+    stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    stream << "<gexf xmlns=\"http://www.gexf.net/1.1draft\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" xsi:schemaLocation=\"http://www.gexf.net/1.1draft http://gexf.net/1.1draft/gexf.xsd\" version=\"1.1\">\n";
+    stream << "  <graph mode=\"static\" defaultedgetype=\"directed\">\n";
+
+    writeAttributeColumns(stream, "node", vertexTypes, vManager, vManager->getSupportedTypes(), vertexColumns);
+    writeAttributeColumns(stream, "edge", edgeTypes, eManager, eManager->getSupportedTypes(), edgeColumns);
+
+    // streaming the nodes and their attributes
+    stream << "    <nodes>\n";
+    VertexIterator::Ptr vit = graph.getVertexIterator();
+    while(vit->next())
+    {
+        Vertex::Ptr vertex = vit->current();
+        const std::string& className = vertex->getClassName();
+        GraphElementId vertexId = graph.getVertexId(vertex);
+
+        stream << "      <node id=\"" << vertexId << "\" label=\"";
+        writeEscaped(stream, vertex->getLabel());
+        stream << "\">\n";
+        stream << "        <attvalues>\n";
+        writeAttValue(stream, CLASS, className);
+        writeAttValue(stream, LABEL, vertex->getLabel());
 
-    // the formatting stage
-    std::string formattedFile = name + ".formatted";
-    std::string command = "`which xmllint` --encode UTF-8 --format " + name + " > " + formattedFile;
+        const TypeAttributes& typeAttributes = getTypeAttributes(vertexTypes, vManager, className);
+        for(size_t i = 0; i < typeAttributes.keys.size(); ++i)
+        {
+            const AttributeSerializationCallbacks& callbacks = typeAttributes.callbacks[i];
+            writeAttValue(stream, typeAttributes.keys[i], (vertex.get()->*callbacks.serializeFunction)());
+        }
+        writeColumnValues(stream, vertexColumns, vertexId);
+        stream << "        </attvalues>\n";
+        stream << "      </node>\n";
+    }
+    stream << "    </nodes>\n";
 
-    LOG_INFO("Trying to format gexf using xmllint: '%s'", command.c_str());
-    if( system(command.c_str()) == 0 )
+    // streaming the edges and their attributes
+    stream << "    <edges>\n";
+    EdgeIterator::Ptr eit = graph.getEdgeIterator();
+    while(eit->next())
     {
-        command = "mv " + formattedFile + " " + name;
-        if( system(command.c_str()) )
+        Edge::Ptr edge = eit->current();
+        const std::string& className = edge->getClassName();
+        GraphElementId edgeId = graph.getEdgeId(edge);
+
+        stream << "      <edge id=\"" << edgeId
+            << "\" source=\"" << graph.getVertexId(edge->getSourceVertex())
+            << "\" target=\"" << graph.getVertexId(edge->getTargetVertex())
+            << "\" label=\"";
+        writeEscaped(stream, edge->getLabel());
+        stream << "\">\n";
+        stream << "        <attvalues>\n";
+        writeAttValue(stream, CLASS, className);
+        writeAttValue(stream, LABEL, edge->getLabel());
+
+        const TypeAttributes& typeAttributes = getTypeAttributes(edgeTypes, eManager, className);
+        for(size_t i = 0; i < typeAttributes.keys.size(); ++i)
         {
-            throw std::runtime_error("graph_analysis::io::GexfWriter::write: Failed to rename file after performing xmlling");
+            const AttributeSerializationCallbacks& callbacks = typeAttributes.callbacks[i];
+            writeAttValue(stream, typeAttributes.keys[i], (edge.get()->*callbacks.serializeFunction)());
         }
-    } else {
-        LOG_INFO("Gexf file '%s' written, but proper formatting failed -- make sure that xmllint is installed", name.c_str());
+        writeColumnValues(stream, edgeColumns, edgeId);
+        stream << "        </attvalues>\n";
+        stream << "      </edge>\n";
     }
+    stream << "    </edges>\n";
+    stream << "  </graph>\n";
+    stream << "</gexf>\n";
 }
 
 } // end namespace io
@@ -1,6 +1,7 @@
 #ifndef GRAPH_ANALYSIS_IO_GEXF_WRITER_HPP
 #define GRAPH_ANALYSIS_IO_GEXF_WRITER_HPP
 
+#include <iosfwd>
 #include "../GraphIO.hpp"
 
 namespace graph_analysis {
@@ -11,6 +12,8 @@ namespace io {
  * \class GexfWriter
  * \brief exports a given base graph to a given file in GEXF format
  * \details Renders requested graph to GEXF standard format
+ * The document is streamed in a single pass over vertices and a single pass
+ * over edges, so that memory consumption does not depend on the graph size
  */
 class GexfWriter : public Writer
 {
@@ -27,9 +30,15 @@ public:
      * \param graph smart pointer to the requested graph to be printed
      */
     void write(const std::string& filename, const BaseGraph::Ptr& graph) const;
+
+    /**
+     * \brief outputs the given graph to the given stream
+     * \param stream output stream
+     * \param graph requested graph to be printed
+     */
+    void write(std::ostream& stream, const BaseGraph& graph) const;
 };
 
 } // end namespace io
 } // end namespace graph_analysis
 #endif // GRAPH_ANALYSIS_IO_GEXF_WRITER_HPP
-
@@ -20,10 +20,18 @@ void GraphvizWriter::write(const std::string& filename, const BaseGraph& graph)
     write(filename, BaseGraph::Ptr(&graph_copy)); // reusing code
 }
 
-void GraphvizWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+namespace {
+
+struct null_deleter
+{
+    void operator()(void const *) const
+    {}
+};
+
+} // end anonymous namespace
+
+void GraphvizWriter::populate(GVGraph& gvGraph, const BaseGraph::Ptr& graph) const
 {
-    // initializing graphViz instance
-    GVGraph gvGraph(graph, "GraphvizGraph");
     // populating it with the nodes
     VertexIterator::Ptr nodeIt = graph->getVertexIterator();
     while(nodeIt->next())
@@ -47,6 +55,14 @@ void GraphvizWriter::write(const std::string& filename, const BaseGraph::Ptr& gr
             mpStyle->apply(edge, &gvGraph, graph);
         }
     }
+}
+
+void GraphvizWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+{
+    // initializing graphViz instance
+    GVGraph gvGraph(graph, "GraphvizGraph");
+    populate(gvGraph, graph);
+
     // layouting and rendering
     LOG_INFO("GraphvizWriter: Applying default layout such that GVGraph context is not empty");
     gvGraph.applyLayout(mLayout);
@@ -55,5 +71,15 @@ void GraphvizWriter::write(const std::string& filename, const BaseGraph::Ptr& gr
     LOG_INFO("GraphvizWriter: done rendering GVGraph to file \"%s\"", filename.c_str());
 }
 
+void GraphvizWriter::write(std::ostream& stream, const BaseGraph& graph) const
+{
+    BaseGraph::Ptr graphPtr(const_cast<BaseGraph*>(&graph), null_deleter());
+    GVGraph gvGraph(graphPtr, "GraphvizGraph");
+    populate(gvGraph, graphPtr);
+
+    gvGraph.applyLayout(mLayout);
+    gvGraph.renderToStream(stream, mLayout, mRenderer);
+}
+
 } // end namespace io
 } // end namespace graph_analysis
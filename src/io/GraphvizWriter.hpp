@@ -7,6 +7,8 @@
 namespace graph_analysis {
 namespace io {
 
+class GVGraph;
+
 /**
  * \file GraphvizWriter.hpp
  * \class GraphvizWriter
@@ -99,6 +101,20 @@ public:
      * \param graph smart pointer to the requested graph to be printed
      */
     void write(const std::string& filename, const BaseGraph::Ptr& graph) const;
+
+    /**
+     * \brief outputs the given graph to the given stream
+     * \param stream output stream
+     * \param graph requested graph to be printed
+     */
+    void write(std::ostream& stream, const BaseGraph& graph) const;
+
+private:
+    /**
+     * Populate the graphviz graph with all vertices and edges of the graph
+     * and apply the style
+     */
+    void populate(GVGraph& gvGraph, const BaseGraph::Ptr& graph) const;
 };
 
 } // end namespace io
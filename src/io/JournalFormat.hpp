@@ -0,0 +1,91 @@
+#ifndef GRAPH_ANALYSIS_IO_JOURNAL_FORMAT_HPP
+#define GRAPH_ANALYSIS_IO_JOURNAL_FORMAT_HPP
+
+#include <stdint.h>
+
+namespace graph_analysis {
+namespace io {
+namespace journal {
+
+/**
+ * \file JournalFormat.hpp
+ * \brief Layout of the graph mutation journal
+ * \details
+ * The file starts with a Header, followed by an (optional) snapshot of the
+ * graph in the binary graph format (see BinaryFormat.hpp), which starts at
+ * Header::snapshotOffset. The snapshot is padded to a multiple of
+ * SNAPSHOT_ALIGNMENT.
+ *
+ * The snapshot is followed by a sequence of groups. Each group corresponds to
+ * a committed (outermost) transaction and consists of a GroupHeader followed
+ * by GroupHeader::size bytes of records. A group whose size exceeds the end
+ * of the file or whose checksum does not match has not been completely
+ * written and terminates the journal.
+ *
+ * Each record starts with a single byte RecordType. Integers are encoded as
+ * unsigned LEB128 varints, strings as varint length followed by the
+ * characters. Class names and attribute names are interned: a DEFINE_SYMBOL
+ * record assigns the next symbol index to a string and other records refer
+ * to the index.
+ *
+ * \verbatim
+ * DEFINE_SYMBOL: string name
+ * ADD_VERTEX:    varint id, varint class symbol, string label, attributes
+ * ADD_EDGE:      varint id, varint source id, varint target id, varint class symbol, string label, attributes
+ * REMOVE_VERTEX: varint id
+ * REMOVE_EDGE:   varint id
+ *
+ * attributes:    varint count, count x (varint name, string data)
+ * \endverbatim
+ *
+ * The name of an attribute combines the name symbol and the
+ * io::AttributeEncoding of the data: symbol << 1 | encoding.
+ *
+ * Ids are the ids of the elements in the journaled graph, where the ids of
+ * the snapshot are given by the binary graph records.
+ */
+
+const char MAGIC[8] = { 'G', 'A', 'J', 'O', 'U', 'R', 'N', 0 };
+const uint32_t VERSION = 3;
+const uint32_t ENDIANNESS_MARK = 0x01020304;
+const uint64_t SNAPSHOT_ALIGNMENT = 8;
+
+enum RecordType { DEFINE_SYMBOL = 0, ADD_VERTEX, ADD_EDGE, REMOVE_VERTEX, REMOVE_EDGE, RECORD_TYPE_END };
+
+struct Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t endianness;
+    uint64_t snapshotOffset;
+    /// Size of the snapshot without padding, 0 if there is no snapshot
+    uint64_t snapshotSize;
+};
+
+struct GroupHeader
+{
+    /// Size of the records of this group in bytes
+    uint64_t size;
+    /// FNV-1a checksum of the records of this group
+    uint32_t checksum;
+    uint32_t reserved;
+};
+
+/**
+ * Compute the FNV-1a checksum of the given data
+ */
+inline uint32_t checksum(const char* data, uint64_t size)
+{
+    uint32_t hash = 2166136261u;
+    for(uint64_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // end namespace journal
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_JOURNAL_FORMAT_HPP
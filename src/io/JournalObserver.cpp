@@ -0,0 +1,683 @@
+#include "JournalObserver.hpp"
+#include "JournalFormat.hpp"
+#include "BinaryGraphView.hpp"
+#include "BinaryWriter.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <base-logging/Logging.hpp>
+#include "../VertexTypeManager.hpp"
+#include "../EdgeTypeManager.hpp"
+#include "../utils/MappedFile.hpp"
+
+namespace graph_analysis {
+namespace io {
+namespace {
+
+/// Default number of records after which the journal is compacted
+const size_t DEFAULT_COMPACTION_THRESHOLD = 1000000;
+
+uint64_t align(uint64_t offset)
+{
+    return (offset + journal::SNAPSHOT_ALIGNMENT - 1) & ~(journal::SNAPSHOT_ALIGNMENT - 1);
+}
+
+/**
+ * Get the directory containing the given file
+ */
+std::string parentDirectory(const std::string& filename)
+{
+    size_t separator = filename.rfind('/');
+    if(separator == std::string::npos)
+    {
+        return ".";
+    } else if(separator == 0)
+    {
+        return "/";
+    }
+    return filename.substr(0, separator);
+}
+
+/**
+ * Sync a file or directory to disk
+ */
+void syncPath(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: failed to open '" + path + "' for syncing: " + strerror(errno));
+    }
+    int rc = fsync(fd);
+    close(fd);
+    if(rc != 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: failed to sync '" + path + "': " + strerror(errno));
+    }
+}
+
+/**
+ * Decoder for the records of a single group
+ */
+class RecordParser
+{
+public:
+    RecordParser(const char* begin, const char* end)
+        : mPosition(begin)
+        , mEnd(end)
+    {}
+
+    bool atEnd() const { return mPosition == mEnd; }
+
+    uint8_t readType()
+    {
+        if(mPosition == mEnd)
+        {
+            throw std::runtime_error("unexpected end of group");
+        }
+        return static_cast<uint8_t>(*mPosition++);
+    }
+
+    uint64_t readVarint()
+    {
+        uint64_t value = 0;
+        for(int shift = 0; shift < 64; shift += 7)
+        {
+            if(mPosition == mEnd)
+            {
+                throw std::runtime_error("unexpected end of group");
+            }
+            uint8_t byte = static_cast<uint8_t>(*mPosition++);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if(!(byte & 0x80))
+            {
+                return value;
+            }
+        }
+        throw std::runtime_error("invalid varint");
+    }
+
+    std::string readString()
+    {
+        uint64_t length = readVarint();
+        if(length > static_cast<uint64_t>(mEnd - mPosition))
+        {
+            throw std::runtime_error("unexpected end of group");
+        }
+        std::string value(mPosition, length);
+        mPosition += length;
+        return value;
+    }
+
+private:
+    const char* mPosition;
+    const char* mEnd;
+};
+
+/**
+ * Applies the records of a journal to a graph -- added elements are
+ * collected and inserted in bulk, until an element has to be removed
+ */
+class JournalReplay
+{
+public:
+    JournalReplay(const BaseGraph::Ptr& graph)
+        : mGraph(graph)
+        , mVertexManager(VertexTypeManager::getInstance())
+        , mEdgeManager(EdgeTypeManager::getInstance())
+    {}
+
+    void loadSnapshot(const BinaryGraphView& view)
+    {
+        mVertices.reserve(view.getNumberOfVertices());
+        mPendingVertices.reserve(view.getNumberOfVertices());
+        for(size_t i = 0; i < view.getNumberOfVertices(); ++i)
+        {
+            Vertex::Ptr vertex = view.getVertex(i);
+            mVertices[view.getVertexId(i)] = vertex;
+            mPendingVertices.push_back(vertex);
+        }
+
+        mEdges.reserve(view.getNumberOfEdges());
+        mPendingEdges.reserve(view.getNumberOfEdges());
+        for(size_t i = 0; i < view.getNumberOfEdges(); ++i)
+        {
+            Edge::Ptr edge = view.getEdge(i);
+            mEdges[view.getEdgeId(i)] = edge;
+            mPendingEdges.push_back(edge);
+        }
+    }
+
+    void apply(RecordParser& parser)
+    {
+        while(!parser.atEnd())
+        {
+            uint8_t type = parser.readType();
+            switch(type)
+            {
+                case journal::DEFINE_SYMBOL:
+                    mSymbols.push_back(parser.readString());
+                    break;
+                case journal::ADD_VERTEX:
+                {
+                    GraphElementId id = parser.readVarint();
+                    const std::string& className = getSymbol(parser.readVarint());
+                    std::string label = parser.readString();
+
+                    Vertex::Ptr vertex = mVertexManager->createVertex(className, label, true);
+                    readAttributes(parser, mVertexManager, className, vertex.get());
+                    mVertices[id] = vertex;
+                    mPendingVertices.push_back(vertex);
+                    break;
+                }
+                case journal::ADD_EDGE:
+                {
+                    GraphElementId id = parser.readVarint();
+                    Vertex::Ptr source = getVertex(parser.readVarint());
+                    Vertex::Ptr target = getVertex(parser.readVarint());
+                    const std::string& className = getSymbol(parser.readVarint());
+                    std::string label = parser.readString();
+
+                    Edge::Ptr edge = mEdgeManager->createEdge(className, source, target, label, true);
+                    readAttributes(parser, mEdgeManager, className, edge.get());
+                    mEdges[id] = edge;
+                    mPendingEdges.push_back(edge);
+                    break;
+                }
+                case journal::REMOVE_VERTEX:
+                {
+                    GraphElementId id = parser.readVarint();
+                    Vertex::Ptr vertex = getVertex(id);
+                    flush();
+                    mGraph->removeVertex(vertex);
+                    mVertices.erase(id);
+                    break;
+                }
+                case journal::REMOVE_EDGE:
+                {
+                    GraphElementId id = parser.readVarint();
+                    boost::unordered_map<GraphElementId, Edge::Ptr>::iterator it = mEdges.find(id);
+                    if(it == mEdges.end())
+                    {
+                        throw std::runtime_error("removal of unknown edge");
+                    }
+                    flush();
+                    mGraph->removeEdge(it->second);
+                    mEdges.erase(it);
+                    break;
+                }
+                default:
+                    throw std::runtime_error("unknown record type");
+            }
+        }
+    }
+
+    /**
+     * Add all pending vertices and edges to the graph
+     */
+    void flush()
+    {
+        if(!mPendingVertices.empty())
+        {
+            mGraph->addVertices(mPendingVertices);
+            mPendingVertices.clear();
+        }
+        if(!mPendingEdges.empty())
+        {
+            mGraph->addEdges(mPendingEdges);
+            mPendingEdges.clear();
+        }
+    }
+
+private:
+    const std::string& getSymbol(uint64_t index) const
+    {
+        if(index >= mSymbols.size())
+        {
+            throw std::runtime_error("reference to undefined symbol");
+        }
+        return mSymbols[index];
+    }
+
+    Vertex::Ptr getVertex(GraphElementId id) const
+    {
+        boost::unordered_map<GraphElementId, Vertex::Ptr>::const_iterator cit = mVertices.find(id);
+        if(cit == mVertices.end())
+        {
+            throw std::runtime_error("reference to unknown vertex");
+        }
+        return cit->second;
+    }
+
+    void readAttributes(RecordParser& parser, AttributeManager* manager, const std::string& className, GraphElement* element)
+    {
+        uint64_t numberOfAttributes = parser.readVarint();
+        for(uint64_t i = 0; i < numberOfAttributes; ++i)
+        {
+            uint64_t encodedName = parser.readVarint();
+            const std::string& name = getSymbol(encodedName >> 1);
+            AttributeEncoding encoding = static_cast<AttributeEncoding>(encodedName & 1);
+            std::string data = parser.readString();
+
+            AttributeSerializationCallbacks callbacks;
+            try {
+                callbacks = manager->getAttributeSerializationCallbacks(className, name);
+            } catch(const std::invalid_argument& e)
+            {
+                LOG_WARN_S << "Skipping attribute '" << name << "' of type '" << className << "': " << e.what();
+                continue;
+            }
+            callbacks.deserialize(element, data, encoding);
+        }
+    }
+
+    BaseGraph::Ptr mGraph;
+    VertexTypeManager* mVertexManager;
+    EdgeTypeManager* mEdgeManager;
+
+    std::vector<std::string> mSymbols;
+    boost::unordered_map<GraphElementId, Vertex::Ptr> mVertices;
+    boost::unordered_map<GraphElementId, Edge::Ptr> mEdges;
+    std::vector<Vertex::Ptr> mPendingVertices;
+    std::vector<Edge::Ptr> mPendingEdges;
+};
+
+} // end anonymous namespace
+
+JournalObserver::JournalObserver(const BaseGraph::Ptr& graph, const std::string& filename)
+    : mGraph(graph)
+    , mFilename(filename)
+    , mFileDescriptor(-1)
+    , mCompactionThreshold(DEFAULT_COMPACTION_THRESHOLD)
+    , mSync(false)
+    , mTransactionLevel(0)
+    , mNumberOfRecords(0)
+{
+    compact();
+}
+
+JournalObserver::~JournalObserver()
+{
+    if(!mRecords.empty())
+    {
+        LOG_WARN_S << "graph_analysis::io::JournalObserver: discarding records of an unfinished transaction in '" << mFilename << "'";
+    }
+    closeFile();
+}
+
+void JournalObserver::notify(const Vertex::Ptr& vertex, const EventType& event, const GraphId& origin)
+{
+    if(event == EVENT_TYPE_ADDED)
+    {
+        addVertexRecord(vertex, origin);
+    } else {
+        addRemoveRecord(vertex, journal::REMOVE_VERTEX);
+    }
+
+    if(mTransactionLevel == 0)
+    {
+        commit();
+    }
+}
+
+void JournalObserver::notify(const Edge::Ptr& edge, const EventType& event, const GraphId& origin)
+{
+    if(event == EVENT_TYPE_ADDED)
+    {
+        addEdgeRecord(edge, origin);
+    } else {
+        addRemoveRecord(edge, journal::REMOVE_EDGE);
+    }
+
+    if(mTransactionLevel == 0)
+    {
+        commit();
+    }
+}
+
+void JournalObserver::notify(const TransactionType& event, const GraphId& origin)
+{
+    (void) origin;
+    if(event == TRANSACTION_START)
+    {
+        ++mTransactionLevel;
+    } else {
+        if(mTransactionLevel == 0)
+        {
+            throw std::runtime_error("graph_analysis::io::JournalObserver: got TRANSACTION_STOP event without a corresponding start");
+        }
+        if(--mTransactionLevel == 0)
+        {
+            commit();
+        }
+    }
+}
+
+void JournalObserver::addVertexRecord(const Vertex::Ptr& vertex, const GraphId& origin)
+{
+    GraphElementId id = vertex->getId(origin);
+    mIds[vertex.get()] = id;
+
+    // symbols have to be defined before the record refers to them
+    const std::string& className = vertex->getClassName();
+    uint64_t classSymbol = getSymbol(className);
+    Attributes attributes;
+    collectAttributes(VertexTypeManager::getInstance(), className, vertex.get(), attributes);
+
+    mRecords.push_back(static_cast<char>(journal::ADD_VERTEX));
+    writeVarint(id);
+    writeVarint(classSymbol);
+    writeString(vertex->getLabel());
+    writeAttributes(attributes);
+    ++mNumberOfRecords;
+}
+
+void JournalObserver::addEdgeRecord(const Edge::Ptr& edge, const GraphId& origin)
+{
+    GraphElementId id = edge->getId(origin);
+    mIds[edge.get()] = id;
+
+    const std::string& className = edge->getClassName();
+    uint64_t classSymbol = getSymbol(className);
+    Attributes attributes;
+    collectAttributes(EdgeTypeManager::getInstance(), className, edge.get(), attributes);
+
+    mRecords.push_back(static_cast<char>(journal::ADD_EDGE));
+    writeVarint(id);
+    writeVarint(edge->getSourceVertex()->getId(origin));
+    writeVarint(edge->getTargetVertex()->getId(origin));
+    writeVarint(classSymbol);
+    writeString(edge->getLabel());
+    writeAttributes(attributes);
+    ++mNumberOfRecords;
+}
+
+void JournalObserver::addRemoveRecord(const GraphElement::Ptr& element, uint8_t type)
+{
+    boost::unordered_map<const GraphElement*, GraphElementId>::iterator it = mIds.find(element.get());
+    if(it == mIds.end())
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: removed element '" + element->toString() + "' has not been journaled");
+    }
+
+    mRecords.push_back(static_cast<char>(type));
+    writeVarint(it->second);
+    mIds.erase(it);
+    ++mNumberOfRecords;
+}
+
+void JournalObserver::collectAttributes(AttributeManager* manager, const std::string& className, GraphElement* element, Attributes& attributes)
+{
+    std::vector<std::string> names = manager->getAttributes(className);
+    for(std::vector<std::string>::const_iterator cit = names.begin(); cit != names.end(); ++cit)
+    {
+        AttributeSerializationCallbacks callbacks = manager->getAttributeSerializationCallbacks(className, *cit);
+        uint64_t symbol = getSymbol(*cit);
+        attributes.push_back(Attributes::value_type());
+        AttributeEncoding encoding = callbacks.serialize(element, true, attributes.back().second);
+        attributes.back().first = symbol << 1 | encoding;
+    }
+}
+
+void JournalObserver::writeAttributes(const Attributes& attributes)
+{
+    writeVarint(attributes.size());
+    for(Attributes::const_iterator cit = attributes.begin(); cit != attributes.end(); ++cit)
+    {
+        writeVarint(cit->first);
+        writeString(cit->second);
+    }
+}
+
+uint64_t JournalObserver::getSymbol(const std::string& name)
+{
+    boost::unordered_map<std::string, uint64_t>::const_iterator cit = mSymbols.find(name);
+    if(cit != mSymbols.end())
+    {
+        return cit->second;
+    }
+
+    uint64_t symbol = mSymbols.size();
+    mSymbols[name] = symbol;
+    mRecords.push_back(static_cast<char>(journal::DEFINE_SYMBOL));
+    writeString(name);
+    return symbol;
+}
+
+void JournalObserver::writeVarint(uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        mRecords.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    mRecords.push_back(static_cast<char>(value));
+}
+
+void JournalObserver::writeString(const std::string& value)
+{
+    writeVarint(value.size());
+    mRecords.append(value);
+}
+
+void JournalObserver::commit()
+{
+    if(mRecords.empty())
+    {
+        return;
+    }
+
+    if(mCompactionThreshold && mNumberOfRecords >= mCompactionThreshold)
+    {
+        // the snapshot already contains all collected records
+        compact();
+        return;
+    }
+
+    journal::GroupHeader header;
+    memset(&header, 0, sizeof(header));
+    header.size = mRecords.size();
+    header.checksum = journal::checksum(mRecords.data(), mRecords.size());
+
+    // Write header and records with a single call
+    mRecords.insert(0, reinterpret_cast<const char*>(&header), sizeof(header));
+    writeData(mRecords.data(), mRecords.size());
+    mRecords.clear();
+
+    if(mSync && fdatasync(mFileDescriptor) != 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: failed to sync '" + mFilename + "': " + strerror(errno));
+    }
+}
+
+void JournalObserver::writeData(const char* data, size_t size)
+{
+    while(size > 0)
+    {
+        ssize_t written = write(mFileDescriptor, data, size);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error("graph_analysis::io::JournalObserver: failed to write '" + mFilename + "': " + strerror(errno));
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+void JournalObserver::closeFile()
+{
+    if(mFileDescriptor >= 0)
+    {
+        close(mFileDescriptor);
+        mFileDescriptor = -1;
+    }
+}
+
+void JournalObserver::compact()
+{
+    BaseGraph::Ptr graph = mGraph.lock();
+    if(!graph)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: journaled graph does not exist anymore");
+    }
+
+    std::string tmpFilename = mFilename + ".tmp";
+    {
+        std::ofstream file(tmpFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!file.is_open())
+        {
+            throw std::runtime_error("graph_analysis::io::JournalObserver: failed to open '" + tmpFilename + "' for writing");
+        }
+
+        journal::Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, journal::MAGIC, sizeof(header.magic));
+        header.version = journal::VERSION;
+        header.endianness = journal::ENDIANNESS_MARK;
+        header.snapshotOffset = align(sizeof(header));
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        const char padding[journal::SNAPSHOT_ALIGNMENT] = { 0 };
+        file.write(padding, header.snapshotOffset - sizeof(header));
+        if(graph->order() > 0)
+        {
+            BinaryWriter().write(file, *graph);
+        }
+        uint64_t end = file.tellp();
+        header.snapshotSize = end - header.snapshotOffset;
+        file.write(padding, align(end) - end);
+
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.close();
+        if(file.fail())
+        {
+            throw std::runtime_error("graph_analysis::io::JournalObserver: failed to write '" + tmpFilename + "'");
+        }
+    }
+
+    syncPath(tmpFilename);
+    closeFile();
+    if(rename(tmpFilename.c_str(), mFilename.c_str()) != 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: failed to replace '" + mFilename + "': " + strerror(errno));
+    }
+    // the rename is only durable once the directory entry has been synced
+    syncPath(parentDirectory(mFilename));
+
+    mFileDescriptor = open(mFilename.c_str(), O_WRONLY | O_APPEND);
+    if(mFileDescriptor < 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver: failed to open '" + mFilename + "' for writing: " + strerror(errno));
+    }
+
+    // Ids of the elements in the snapshot
+    mIds.clear();
+    VertexIterator::Ptr vertexIt = graph->getVertexIterator();
+    while(vertexIt->next())
+    {
+        const Vertex::Ptr& vertex = vertexIt->current();
+        mIds[vertex.get()] = graph->getVertexId(vertex);
+    }
+    EdgeIterator::Ptr edgeIt = graph->getEdgeIterator();
+    while(edgeIt->next())
+    {
+        const Edge::Ptr& edge = edgeIt->current();
+        mIds[edge.get()] = graph->getEdgeId(edge);
+    }
+
+    mSymbols.clear();
+    mRecords.clear();
+    mNumberOfRecords = 0;
+
+    LOG_DEBUG_S << "compacted journal '" << mFilename << "' with snapshot of " << graph->order() << " vertices and " << graph->size() << " edges";
+}
+
+void JournalObserver::replay(const std::string& filename, const BaseGraph::Ptr& graph)
+{
+    utils::MappedFile file(filename);
+    const char* data = file.data();
+    uint64_t size = file.size();
+
+    journal::Header header;
+    if(size < sizeof(header))
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver::replay: '" + filename + "' is not a journal file");
+    }
+    memcpy(&header, data, sizeof(header));
+    if(memcmp(header.magic, journal::MAGIC, sizeof(journal::MAGIC)) != 0)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver::replay: '" + filename + "' is not a journal file");
+    }
+    if(header.endianness != journal::ENDIANNESS_MARK)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver::replay: '" + filename + "' has been written on a host with different byte order");
+    }
+    if(header.version != journal::VERSION)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver::replay: '" + filename + "' has an unsupported version");
+    }
+    if(header.snapshotOffset > size || header.snapshotSize > size - header.snapshotOffset)
+    {
+        throw std::runtime_error("graph_analysis::io::JournalObserver::replay: '" + filename + "' has an invalid snapshot section");
+    }
+
+    graph->clear();
+
+    JournalReplay replay(graph);
+    if(header.snapshotSize > 0)
+    {
+        BinaryGraphView view(data + header.snapshotOffset, header.snapshotSize, filename);
+        replay.loadSnapshot(view);
+        replay.flush();
+        view.loadColumns(graph);
+    }
+
+    uint64_t position = align(header.snapshotOffset + header.snapshotSize);
+    size_t numberOfGroups = 0;
+    while(position < size)
+    {
+        journal::GroupHeader groupHeader;
+        if(size - position < sizeof(groupHeader))
+        {
+            LOG_WARN_S << "graph_analysis::io::JournalObserver::replay: ignoring incomplete group header at the end of '" << filename << "'";
+            break;
+        }
+        memcpy(&groupHeader, data + position, sizeof(groupHeader));
+        position += sizeof(groupHeader);
+
+        if(groupHeader.size > size - position
+                || journal::checksum(data + position, groupHeader.size) != groupHeader.checksum)
+        {
+            LOG_WARN_S << "graph_analysis::io::JournalObserver::replay: ignoring incompletely written group at the end of '" << filename << "'";
+            break;
+        }
+
+        RecordParser parser(data + position, data + position + groupHeader.size);
+        try {
+            replay.apply(parser);
+        } catch(const std::runtime_error& e)
+        {
+            std::stringstream ss;
+            ss << "graph_analysis::io::JournalObserver::replay: '" << filename << "' contains an invalid record in the group at byte offset "
+                << (position - sizeof(groupHeader)) << " -- " << e.what();
+            throw std::runtime_error(ss.str());
+        }
+        position += groupHeader.size;
+        ++numberOfGroups;
+    }
+    replay.flush();
+
+    LOG_INFO_S << "replayed journal '" << filename << "' with " << numberOfGroups << " groups";
+}
+
+} // end namespace io
+} // end namespace graph_analysis
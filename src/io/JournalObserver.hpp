@@ -0,0 +1,143 @@
+#ifndef GRAPH_ANALYSIS_IO_JOURNAL_OBSERVER_HPP
+#define GRAPH_ANALYSIS_IO_JOURNAL_OBSERVER_HPP
+
+#include <string>
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "../BaseGraph.hpp"
+
+namespace graph_analysis {
+
+class AttributeManager;
+
+namespace io {
+
+/**
+ * \file JournalObserver.hpp
+ * \class JournalObserver
+ * \brief Observer that logs all modifications of a graph to a journal file,
+ * so that the graph can be quickly restored using GraphIO::replay
+ * \details When created, the observer writes a snapshot of the current
+ * graph to the journal (see JournalFormat.hpp). Afterwards, all added and
+ * removed vertices and edges are appended as compact binary records. Records
+ * are collected until the outermost transaction has been stopped and are then
+ * written at once (group commit) -- events outside of transactions are
+ * written immediately.
+ *
+ * Once the number of records since the last snapshot exceeds the compaction
+ * threshold, the journal is compacted, i.e. replaced by a new snapshot of the
+ * graph. The new journal is written to a temporary file, which atomically
+ * replaces the existing one.
+ *
+ * Note, that attributes of vertices and edges are serialized when they are
+ * added to the graph, later changes of attributes are not recorded. Attribute
+ * columns of the graph are only stored with a snapshot.
+ *
+ \verbatim
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    io::GraphIO::replay("graph.journal", graph); // if the journal exists
+
+    io::JournalObserver::Ptr journal(new io::JournalObserver(graph, "graph.journal"));
+    graph->addObserver(journal);
+ \endverbatim
+ */
+class JournalObserver : public BaseGraphObserver
+{
+public:
+    typedef shared_ptr<JournalObserver> Ptr;
+
+    /**
+     * Create the journal file and write a snapshot of the given graph
+     * \param graph Graph to be journaled -- the observer still has to be
+     * added to the graph, and only a weak reference is kept
+     * \param filename Name of the journal file, an existing file is replaced
+     * \throw std::runtime_error if the journal cannot be written
+     */
+    JournalObserver(const BaseGraph::Ptr& graph, const std::string& filename);
+
+    virtual ~JournalObserver();
+
+    virtual void notify(const Vertex::Ptr& vertex, const EventType& event, const GraphId& origin);
+    virtual void notify(const Edge::Ptr& edge, const EventType& event, const GraphId& origin);
+    virtual void notify(const TransactionType& event, const GraphId& origin);
+
+    /**
+     * Set the number of records after which the journal is compacted, 0 to
+     * disable compaction
+     */
+    void setCompactionThreshold(size_t numberOfRecords) { mCompactionThreshold = numberOfRecords; }
+    size_t getCompactionThreshold() const { return mCompactionThreshold; }
+
+    /**
+     * Set whether each commit shall be synced to disk (fdatasync), otherwise
+     * the operating system decides when to write the data
+     */
+    void setSync(bool sync) { mSync = sync; }
+    bool getSync() const { return mSync; }
+
+    /**
+     * Replace the journal by a snapshot of the current graph
+     * \throw std::runtime_error if the journal cannot be written
+     */
+    void compact();
+
+    /**
+     * Get the name of the journal file
+     */
+    const std::string& getFilename() const { return mFilename; }
+
+    /**
+     * Get the number of records that have been written since the last snapshot
+     */
+    size_t getNumberOfRecords() const { return mNumberOfRecords; }
+
+    /**
+     * Restore a graph from a journal file, i.e. load the snapshot and apply
+     * all completely written groups of records -- the content of the graph is
+     * replaced
+     * \throw std::runtime_error if the journal is invalid
+     */
+    static void replay(const std::string& filename, const BaseGraph::Ptr& graph);
+
+private:
+    /// Serialized attributes as pairs of encoded name (see JournalFormat.hpp) and data
+    typedef std::vector< std::pair<uint64_t, std::string> > Attributes;
+
+    void addVertexRecord(const Vertex::Ptr& vertex, const GraphId& origin);
+    void addEdgeRecord(const Edge::Ptr& edge, const GraphId& origin);
+    void addRemoveRecord(const GraphElement::Ptr& element, uint8_t type);
+    void collectAttributes(AttributeManager* manager, const std::string& className, GraphElement* element, Attributes& attributes);
+    void writeAttributes(const Attributes& attributes);
+    uint64_t getSymbol(const std::string& name);
+
+    void writeVarint(uint64_t value);
+    void writeString(const std::string& value);
+
+    /// Write the collected records as single group
+    void commit();
+    /// Write data to the journal file
+    void writeData(const char* data, size_t size);
+    void closeFile();
+
+    weak_ptr<BaseGraph> mGraph;
+    std::string mFilename;
+    int mFileDescriptor;
+
+    size_t mCompactionThreshold;
+    bool mSync;
+    int mTransactionLevel;
+
+    /// Records that have not been committed yet
+    std::string mRecords;
+    size_t mNumberOfRecords;
+
+    /// Symbols that have been defined in the journal
+    boost::unordered_map<std::string, uint64_t> mSymbols;
+    /// Ids of the elements in the graph -- required, since an element has
+    /// already been disassociated when the removal is notified
+    boost::unordered_map<const GraphElement*, GraphElementId> mIds;
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_JOURNAL_OBSERVER_HPP
@@ -0,0 +1,154 @@
+#include "LemonReader.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <lemon/list_graph.h>
+#include <lemon/lgf_reader.h>
+#include <base-logging/Logging.hpp>
+#include "../VertexTypeManager.hpp"
+#include "../EdgeTypeManager.hpp"
+
+namespace graph_analysis {
+namespace io {
+namespace {
+
+/**
+ * Test whether the first section of the given kind has a map of the given
+ * name
+ */
+bool hasMap(int numberOfSections, const std::vector<std::string>& mapNames, const std::string& name)
+{
+    return numberOfSections > 0 && std::find(mapNames.begin(), mapNames.end(), name) != mapNames.end();
+}
+
+} // end anonymous namespace
+
+void LemonReader::read(const std::string& filename, BaseGraph::Ptr graph)
+{
+    std::vector<char> buffer(1 << 16);
+    std::ifstream stream;
+    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    stream.open(filename.c_str(), std::ios::in | std::ios::binary);
+    if(!stream.is_open())
+    {
+        throw std::runtime_error("graph_analysis::io::LemonReader::read: failed to open '" + filename + "' for reading");
+    }
+    LOG_INFO_S << "importing graph from file '" << filename << "'";
+
+    read(stream, graph);
+}
+
+void LemonReader::read(std::istream& stream, BaseGraph::Ptr graph)
+{
+    typedef ::lemon::ListDigraph graph_t;
+
+    // The content is probed for the available maps first, so it has to be
+    // parsed twice
+    std::vector<char> buffer;
+    readAll(stream, buffer);
+    std::string content(buffer.begin(), buffer.end());
+    std::vector<char>().swap(buffer);
+
+    VertexTypeManager* vManager = VertexTypeManager::getInstance();
+    EdgeTypeManager* eManager = EdgeTypeManager::getInstance();
+
+    graph_t rawGraph;
+    // Files written before the class maps have been introduced fall back to
+    // the default types
+    graph_t::NodeMap<std::string> vertexLabels(rawGraph);
+    graph_t::NodeMap<std::string> vertexClasses(rawGraph, vManager->getDefaultType());
+    graph_t::NodeMap<GraphElementId> vertexIds(rawGraph, 0);
+    graph_t::ArcMap<std::string> edgeLabels(rawGraph);
+    graph_t::ArcMap<std::string> edgeClasses(rawGraph, eManager->getDefaultType());
+    graph_t::ArcMap<GraphElementId> edgeIds(rawGraph, 0);
+
+    try {
+        std::istringstream probeStream(content);
+        ::lemon::LgfContents contents(probeStream);
+        contents.run();
+
+        int nodeSections = contents.nodeSectionNum();
+        int arcSections = contents.arcSectionNum();
+        std::vector<std::string> nodeMaps = nodeSections > 0 ? contents.nodeMapNames(0) : std::vector<std::string>();
+        std::vector<std::string> arcMaps = arcSections > 0 ? contents.arcMapNames(0) : std::vector<std::string>();
+
+        std::istringstream contentStream(content);
+        ::lemon::DigraphReader<graph_t> reader(rawGraph, contentStream);
+        if(hasMap(nodeSections, nodeMaps, "vertices"))
+        {
+            reader.nodeMap("vertices", vertexLabels);
+        }
+        if(hasMap(nodeSections, nodeMaps, "vertexClass"))
+        {
+            reader.nodeMap("vertexClass", vertexClasses);
+        }
+        if(hasMap(nodeSections, nodeMaps, "vertexId"))
+        {
+            reader.nodeMap("vertexId", vertexIds);
+        }
+        if(hasMap(arcSections, arcMaps, "edges"))
+        {
+            reader.arcMap("edges", edgeLabels);
+        }
+        if(hasMap(arcSections, arcMaps, "edgeClass"))
+        {
+            reader.arcMap("edgeClass", edgeClasses);
+        }
+        if(hasMap(arcSections, arcMaps, "edgeId"))
+        {
+            reader.arcMap("edgeId", edgeIds);
+        }
+        reader.run();
+    } catch(const ::lemon::Exception& e)
+    {
+        throw std::runtime_error("graph_analysis::io::LemonReader::read: failed to parse LGF -- " + std::string(e.what()));
+    }
+
+    // Restore the order of the written graph -- ListDigraph iterates in the
+    // reverse order of insertion. Without id maps the elements are ordered by
+    // their position in the file
+    std::vector< std::pair<GraphElementId, graph_t::Node> > nodes;
+    nodes.reserve(::lemon::countNodes(rawGraph));
+    for(graph_t::NodeIt n(rawGraph); n != ::lemon::INVALID; ++n)
+    {
+        nodes.push_back(std::make_pair(vertexIds[n], graph_t::Node(n)));
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    std::vector< std::pair<GraphElementId, graph_t::Arc> > arcs;
+    arcs.reserve(::lemon::countArcs(rawGraph));
+    for(graph_t::ArcIt a(rawGraph); a != ::lemon::INVALID; ++a)
+    {
+        arcs.push_back(std::make_pair(edgeIds[a], graph_t::Arc(a)));
+    }
+    std::sort(arcs.begin(), arcs.end());
+
+    graph_t::NodeMap<Vertex::Ptr> vertexMap(rawGraph);
+    std::vector<Vertex::Ptr> vertices;
+    vertices.reserve(nodes.size());
+    for(size_t i = 0; i < nodes.size(); ++i)
+    {
+        graph_t::Node node = nodes[i].second;
+        Vertex::Ptr vertex = vManager->createVertex(vertexClasses[node], vertexLabels[node]);
+        vertexMap[node] = vertex;
+        vertices.push_back(vertex);
+    }
+
+    std::vector<Edge::Ptr> edges;
+    edges.reserve(arcs.size());
+    for(size_t i = 0; i < arcs.size(); ++i)
+    {
+        graph_t::Arc arc = arcs[i].second;
+        edges.push_back( eManager->createEdge(edgeClasses[arc],
+                    vertexMap[rawGraph.source(arc)],
+                    vertexMap[rawGraph.target(arc)],
+                    edgeLabels[arc]) );
+    }
+
+    graph->clear();
+    graph->addVertices(vertices);
+    graph->addEdges(edges);
+}
+
+} // end namespace io
+} // end namespace graph_analysis
@@ -0,0 +1,49 @@
+#ifndef GRAPH_ANALYSIS_IO_LEMON_READER_HPP
+#define GRAPH_ANALYSIS_IO_LEMON_READER_HPP
+
+#include <iostream>
+#include "../GraphIO.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file LemonReader.hpp
+ * \class LemonReader
+ * \brief Imports a graph from the LEMON graph format (LGF) as written by
+ * lemon::DirectedGraph::write
+ * \details The file is loaded into a raw lemon::ListDigraph first. Vertices
+ * and edges are then created in a single pass through the type managers,
+ * using the maps 'vertices'/'edges' as labels and 'vertexClass'/'edgeClass'
+ * as types. The maps 'vertexId'/'edgeId' are used to restore the order of
+ * the written graph.
+ *
+ * All of these maps are optional: files written before the class maps were
+ * introduced use the default vertex and edge type, and without id maps the
+ * order of the file is kept.
+ *
+ * The ids themselves are not restored. Reading into an empty
+ * lemon::DirectedGraph reproduces the written ids only if these were dense,
+ * i.e. no element had been removed from the written graph.
+ */
+class LemonReader : public Reader
+{
+public:
+    /**
+     * \brief reads the graph from the given file and stores it to the provided graph argument
+     * \param filename provided input filename
+     * \param graph target graph to store the parsed graph
+     */
+    void read(const std::string& filename, BaseGraph::Ptr graph);
+
+    /**
+     * \brief reads the graph from the given stream and stores it to the provided graph argument
+     * \param stream input stream in LGF
+     * \param graph target graph to store the parsed graph
+     */
+    void read(std::istream& stream, BaseGraph::Ptr graph);
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_LEMON_READER_HPP
@@ -0,0 +1,152 @@
+#include "MatrixMarketReader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <boost/algorithm/string.hpp>
+
+namespace graph_analysis {
+namespace io {
+namespace {
+
+/**
+ * Get the next line (without the newline character)
+ * \return pointer to the start of the following line
+ */
+const char* nextLine(const char* begin, const char* end, std::string& line)
+{
+    const char* newline = static_cast<const char*>(memchr(begin, '\n', end - begin));
+    const char* lineEnd = newline ? newline : end;
+    line.assign(begin, lineEnd);
+    boost::trim(line);
+    return newline ? newline + 1 : end;
+}
+
+} // end anonymous namespace
+
+const char* MatrixMarketReader::parseHeader(const char* begin, const char* end, Header& header) const
+{
+    std::string line;
+    const char* position = nextLine(begin, end, line);
+
+    std::vector<std::string> banner;
+    boost::to_lower(line);
+    boost::split(banner, line, boost::is_any_of(" \t"), boost::token_compress_on);
+    if(banner.size() != 5 || banner[0] != "%%matrixmarket" || banner[1] != "matrix")
+    {
+        throw std::runtime_error("graph_analysis::io::MatrixMarketReader: file does not start with a valid '%%MatrixMarket matrix' banner");
+    }
+
+    if(banner[2] != "coordinate")
+    {
+        throw std::runtime_error("graph_analysis::io::MatrixMarketReader: unsupported format '" + banner[2] + "' -- only 'coordinate' is supported");
+    }
+
+    if(banner[3] != "real" && banner[3] != "double" && banner[3] != "integer" && banner[3] != "pattern")
+    {
+        throw std::runtime_error("graph_analysis::io::MatrixMarketReader: unsupported field '" + banner[3] + "'");
+    }
+
+    if(banner[4] == "general")
+    {
+        header.symmetry = GENERAL;
+    } else if(banner[4] == "symmetric")
+    {
+        header.symmetry = SYMMETRIC;
+    } else if(banner[4] == "skew-symmetric")
+    {
+        header.symmetry = SKEW_SYMMETRIC;
+    } else {
+        throw std::runtime_error("graph_analysis::io::MatrixMarketReader: unsupported symmetry '" + banner[4] + "'");
+    }
+
+    // skip comments until the size line is found
+    while(position != end)
+    {
+        position = nextLine(position, end, line);
+        if(line.empty() || line[0] == '%')
+        {
+            continue;
+        }
+
+        uint64_t rows = 0, columns = 0, entries = 0;
+        std::stringstream ss(line);
+        if(!(ss >> rows >> columns >> entries))
+        {
+            throw std::runtime_error("graph_analysis::io::MatrixMarketReader: invalid size line '" + line + "'");
+        }
+
+        // a matrix with n entries requires at least one line of the form
+        // "i j\n" per entry
+        uint64_t maxEntries = (end - position + 1)/4;
+        if(entries > maxEntries)
+        {
+            std::stringstream ss;
+            ss << "graph_analysis::io::MatrixMarketReader: size line declares " << entries
+                << " entries, but the remaining " << (end - position) << " bytes can hold at most " << maxEntries;
+            throw std::runtime_error(ss.str());
+        }
+        // vertex indices are offset by firstId
+        if(std::max(rows, columns) >= std::numeric_limits<uint64_t>::max())
+        {
+            throw std::runtime_error("graph_analysis::io::MatrixMarketReader: dimensions in size line '" + line + "' exceed the range of vertex ids");
+        }
+
+        header.numberOfVertices = std::max(rows, columns);
+        header.numberOfEdges = header.symmetry == GENERAL ? entries : 2*entries;
+        header.firstId = 1;
+        return position;
+    }
+    throw std::runtime_error("graph_analysis::io::MatrixMarketReader: size line is missing");
+}
+
+void MatrixMarketReader::parseLine(const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const
+{
+    if(*begin == '%')
+    {
+        return;
+    }
+
+    ParsedEdge edge;
+    const char* position = parseUnsigned(begin, end, edge.source);
+    if(!position)
+    {
+        throw std::runtime_error("row index expected");
+    }
+
+    position = parseUnsigned(skipWhitespace(position, end), end, edge.target);
+    if(!position)
+    {
+        throw std::runtime_error("column index expected");
+    }
+
+    if(edge.source < header.firstId || edge.source >= header.numberOfVertices + header.firstId
+            || edge.target < header.firstId || edge.target >= header.numberOfVertices + header.firstId)
+    {
+        throw std::runtime_error("index out of range");
+    }
+    edge.source -= header.firstId;
+    edge.target -= header.firstId;
+
+    position = skipWhitespace(position, end);
+    edge.weighted = position != end;
+    edge.weight = 0;
+    if(edge.weighted && !parseDouble(position, end, edge.weight))
+    {
+        throw std::runtime_error("value expected");
+    }
+    edges.push_back(edge);
+
+    if(header.symmetry != GENERAL && edge.source != edge.target)
+    {
+        std::swap(edge.source, edge.target);
+        if(header.symmetry == SKEW_SYMMETRIC)
+        {
+            edge.weight = -edge.weight;
+        }
+        edges.push_back(edge);
+    }
+}
+
+} // end namespace io
+} // end namespace graph_analysis
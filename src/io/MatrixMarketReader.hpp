@@ -0,0 +1,46 @@
+#ifndef GRAPH_ANALYSIS_IO_MATRIX_MARKET_READER_HPP
+#define GRAPH_ANALYSIS_IO_MATRIX_MARKET_READER_HPP
+
+#include "ChunkedReader.hpp"
+
+namespace graph_analysis {
+namespace io {
+
+/**
+ * \file MatrixMarketReader.hpp
+ * \class MatrixMarketReader
+ * \brief Imports a graph from a sparse matrix in MatrixMarket coordinate format
+ * \details The matrix is interpreted as adjacency matrix, i.e. each entry (i,j)
+ * results in an edge from vertex i to vertex j. Values of real and integer
+ * matrices are mapped to the edge weight. For symmetric and skew-symmetric
+ * matrices the edge (j,i) is added for each off-diagonal entry.
+ *
+ * Since rows and columns refer to the same set of vertices, one vertex is
+ * created per row/column -- unless vertex ids are compacted.
+ \verbatim
+ %%MatrixMarket matrix coordinate real general
+ % comment
+ 3 3 2
+ 1 2 0.5
+ 2 3 1.5
+ \endverbatim
+ * \see http://math.nist.gov/MatrixMarket/formats.html
+ */
+class MatrixMarketReader : public ChunkedReader
+{
+public:
+    MatrixMarketReader(size_t numberOfThreads = 0)
+        : ChunkedReader(numberOfThreads)
+    {}
+
+protected:
+    const char* parseHeader(const char* begin, const char* end, Header& header) const;
+
+    void parseLine(const char* begin, const char* end, const Header& header, EdgeBuffer& edges) const;
+
+    std::string getName() const { return "MatrixMarketReader"; }
+};
+
+} // end namespace io
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_IO_MATRIX_MARKET_READER_HPP
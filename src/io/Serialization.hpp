@@ -2,11 +2,15 @@
 #define GRAPH_ANALYSIS_IO_SERIALIZATION_HPP
 
 #include <vector>
+#include <stdexcept>
 #include "../GraphElement.hpp"
 
 namespace graph_analysis {
 namespace io {
 
+/// Encoding of serialized attribute data
+enum AttributeEncoding { TEXT_ENCODING = 0, BINARY_ENCODING };
+
 /**
  * \class AttributeCallbacks
  * \brief Support attribute callbacks to allow custom attributes to be prepared
@@ -32,6 +36,62 @@ struct AttributeSerializationCallbacks
      * Print current attribute
      */
     print_func_t printFunction;
+
+    /**
+     * Optional: return the attribute in a compact binary encoding (see
+     * AttributeCodec.hpp), which is used by the native graph formats
+     */
+    serialize_func_t binarySerializeFunction;
+
+    /**
+     * Optional: deserialize the attribute from its binary encoding
+     */
+    deserialize_func_t binaryDeserializeFunction;
+
+    /**
+     * Whether readers shall keep the serialized data and deserialize the
+     * attribute on first access -- requires the element to call
+     * GraphElement::restoreAttributes before accessing the attribute
+     */
+    bool lazy;
+
+    /**
+     * Serialize the attribute of the given element
+     * \param preferBinary Use the binary encoding if available
+     * \param data Serialized data
+     * \return the encoding of the data
+     */
+    AttributeEncoding serialize(GraphElement* element, bool preferBinary, std::string& data) const
+    {
+        if(preferBinary && binarySerializeFunction)
+        {
+            data = (element->*binarySerializeFunction)();
+            return BINARY_ENCODING;
+        }
+        data = (element->*serializeFunction)();
+        return TEXT_ENCODING;
+    }
+
+    /**
+     * Deserialize the attribute of the given element, or keep the data as
+     * pending attribute of the element if the attribute is lazy
+     * \throw std::invalid_argument if the encoding is not supported
+     */
+    void deserialize(GraphElement* element, const std::string& data, AttributeEncoding encoding = TEXT_ENCODING) const
+    {
+        deserialize_func_t deserializeFunc = encoding == BINARY_ENCODING ? binaryDeserializeFunction : deserializeFunction;
+        if(!deserializeFunc)
+        {
+            throw std::invalid_argument("graph_analysis::io::AttributeSerializationCallbacks: no deserialization function registered for the encoding of the attribute data");
+        }
+
+        if(lazy)
+        {
+            element->addPendingAttribute(deserializeFunc, data);
+        } else {
+            (element->*deserializeFunc)(data);
+        }
+    }
 };
 
 } // end namespace io
@@ -1,154 +1,442 @@
 #include "YamlReader.hpp"
+#include <map>
+#include <vector>
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+#include <boost/functional/hash.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/utility/string_ref.hpp>
 #include <base-logging/Logging.hpp>
+#include "../AttributeColumn.hpp"
 #include "../VertexTypeManager.hpp"
+#include "../utils/MappedFile.hpp"
 
 namespace graph_analysis {
 namespace io {
+namespace {
 
-void YamlReader::read(const std::string& filename, BaseGraph::Ptr graph)
+struct StringRefHash
+{
+    size_t operator()(const boost::string_ref& s) const { return boost::hash_range(s.begin(), s.end()); }
+};
+
+/// Map node ids to vertices -- the keys refer to the parsed buffer
+typedef boost::unordered_map<boost::string_ref, Vertex::Ptr, StringRefHash> VertexMap;
+
+/// Map column names to the attribute columns of the graph
+typedef boost::unordered_map<boost::string_ref, AttributeColumnBase::Ptr, StringRefHash> ColumnMap;
+
+/// Value of an attribute column for the element with the given index in the
+/// list of pending vertices or edges -- set once the element has been added
+struct ColumnValue
+{
+    size_t element;
+    AttributeColumnBase::Ptr column;
+    boost::string_ref value;
+};
+
+/**
+ * \class YamlParser
+ * \brief Single pass parser for the custom yml graph format
+ * \details Tokens refer to the input buffer, so that no intermediate copies
+ * are required. Vertices and edges are collected and added to the graph in
+ * bulk.
+ *
+ * The optional sections vertexColumns/edgeColumns declare attribute columns
+ * (name and type), whose values are given as additional 'name: value'
+ * properties of the nodes and edges
+ */
+class YamlParser
 {
-    const char *fname = filename.c_str();
-    std::ifstream fin(fname);
-    if(!fin.good())
+public:
+    YamlParser(const char* data, size_t size)
+        : mData(data)
+        , mSize(size)
+        , mSection(SECTION_NONE)
+        , mInItem(false)
+        , mField(0)
+    {}
+
+    void parse(const BaseGraph::Ptr& graph)
     {
-        // error checking
-        LOG_ERROR_S << "failed to open input file '" << filename
-                    << "' for graph import - no such file";
-        return;
+        size_t numberOfNodes = 0;
+        size_t numberOfEdges = 0;
+        countItems(numberOfNodes, numberOfEdges);
+        mVertices.reserve(numberOfNodes);
+        mVertexMap.reserve(numberOfNodes);
+        mEdges.reserve(numberOfEdges);
+
+        size_t position = 0;
+        while(position < mSize)
+        {
+            const char* lineStart = mData + position;
+            const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', mSize - position));
+            if(!lineEnd)
+            {
+                lineEnd = mData + mSize;
+            }
+            position = lineEnd - mData + 1;
+
+            parseLine(trim(boost::string_ref(lineStart, lineEnd - lineStart)), graph);
+        }
+        completeSection(graph);
     }
-    LOG_INFO_S << "importing graph from file '" << fname << "'";
 
-    graph->clear();
-    VertexMap vMap;
-    std::string line;
-    std::getline(fin, line);
-    std::stringstream nodeStream, edgeStream;
-    // tokenizing the nodes list string and the edges list string respectively
-    while(!fin.eof())
+private:
+    enum Section { SECTION_NONE, SECTION_VERTEX_COLUMNS, SECTION_EDGE_COLUMNS, SECTION_NODES, SECTION_EDGES };
+
+    static const size_t NUMBER_OF_FIELDS = 3;
+
+    static boost::string_ref trim(boost::string_ref s)
     {
-        if(std::string::npos != line.find("nodes:"))
+        while(!s.empty() && isspace(static_cast<unsigned char>(s.front())))
         {
-            std::getline(fin, line);
-            while(std::string::npos == line.find("edges:"))
+            s.remove_prefix(1);
+        }
+        while(!s.empty() && isspace(static_cast<unsigned char>(s.back())))
+        {
+            s.remove_suffix(1);
+        }
+        return s;
+    }
+
+    /**
+     * Count the list entries of the nodes and edges sections, so that the
+     * containers are reserved for the actual number of elements
+     */
+    void countItems(size_t& numberOfNodes, size_t& numberOfEdges) const
+    {
+        Section section = SECTION_NONE;
+        size_t position = 0;
+        while(position < mSize)
+        {
+            const char* lineStart = mData + position;
+            const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', mSize - position));
+            if(!lineEnd)
             {
-                nodeStream << line << std::endl;
-                if(!fin.eof())
+                lineEnd = mData + mSize;
+            }
+            position = lineEnd - mData + 1;
+
+            while(lineStart != lineEnd && isspace(static_cast<unsigned char>(*lineStart)))
+            {
+                ++lineStart;
+            }
+            if(lineStart == lineEnd)
+            {
+                continue;
+            }
+
+            if(*lineStart == '-')
+            {
+                if(section == SECTION_NODES)
                 {
-                    std::getline(fin, line);
+                    ++numberOfNodes;
+                } else if(section == SECTION_EDGES)
+                {
+                    ++numberOfEdges;
                 }
-                else
+            } else if(*lineStart == 'n' || *lineStart == 'e' || *lineStart == 'v')
+            {
+                boost::string_ref line(lineStart, lineEnd - lineStart);
+                if(line.starts_with("nodes:"))
+                {
+                    section = SECTION_NODES;
+                } else if(line.starts_with("edges:"))
+                {
+                    section = SECTION_EDGES;
+                } else if(line.starts_with("vertexColumns:") || line.starts_with("edgeColumns:"))
                 {
-                    break;
+                    section = SECTION_NONE;
                 }
             }
-            while(!fin.eof())
+        }
+    }
+
+    static const char* const* keywords(Section section)
+    {
+        static const char* const nodeKeywords[NUMBER_OF_FIELDS] = { "id:", "type:", "label:" };
+        static const char* const edgeKeywords[NUMBER_OF_FIELDS] = { "fromNodeId:", "toNodeId:", "label:" };
+        static const char* const columnKeywords[NUMBER_OF_FIELDS] = { "name:", "type:", "" };
+        switch(section)
+        {
+            case SECTION_NODES:
+                return nodeKeywords;
+            case SECTION_EDGES:
+                return edgeKeywords;
+            default:
+                return columnKeywords;
+        }
+    }
+
+    static size_t numberOfFields(Section section)
+    {
+        return section == SECTION_NODES || section == SECTION_EDGES ? NUMBER_OF_FIELDS : 2;
+    }
+
+    void parseLine(boost::string_ref line, const BaseGraph::Ptr& graph)
+    {
+        if(line.empty())
+        {
+            return;
+        }
+
+        if(line.starts_with("nodes:"))
+        {
+            completeSection(graph);
+            mSection = SECTION_NODES;
+            return;
+        } else if(line.starts_with("edges:"))
+        {
+            completeSection(graph);
+            mSection = SECTION_EDGES;
+            return;
+        } else if(line.starts_with("vertexColumns:"))
+        {
+            completeSection(graph);
+            mSection = SECTION_VERTEX_COLUMNS;
+            return;
+        } else if(line.starts_with("edgeColumns:"))
+        {
+            completeSection(graph);
+            mSection = SECTION_EDGE_COLUMNS;
+            return;
+        }
+
+        if(mSection == SECTION_NONE)
+        {
+            return;
+        }
+
+        if(line.front() == '-')
+        {
+            // an individual node or edge starts
+            completeItem();
+            line.remove_prefix(1);
+            line = trim(line);
+            mField = 0;
+            mInItem = true;
+        } else if(!mInItem)
+        {
+            return;
+        }
+
+        size_t separator = line.find(':');
+        if(mField >= numberOfFields(mSection))
+        {
+            // Further properties of a node or edge are attribute column values
+            if(separator != boost::string_ref::npos && (mSection == SECTION_NODES || mSection == SECTION_EDGES))
             {
-                std::getline(fin, line);
-                edgeStream << line << std::endl;
+                addColumnValue(trim(line.substr(0, separator)), trim(line.substr(separator + 1)));
             }
+            return;
         }
-        else
+
+        // Parse 'keyword: value'
+        const char* keyword = keywords(mSection)[mField];
+        if(separator == boost::string_ref::npos || line.substr(0, separator + 1) != keyword)
         {
-            std::getline(fin, line);
+            die(keyword, line.substr(0, separator == boost::string_ref::npos ? line.size() : separator + 1).to_string());
+        }
+        mValues[mField++] = trim(line.substr(separator + 1));
+
+        if(mField == numberOfFields(mSection))
+        {
+            createItem(graph);
         }
     }
-    // parsing nodes and then parsing edges from the respectively tokenized information
-    parseNodes(nodeStream, graph, vMap);
-    parseEdges(edgeStream, graph, vMap);
-}
 
+    void completeItem()
+    {
+        if(mInItem && mField < numberOfFields(mSection))
+        {
+            die(std::string("Parsing error: keyword '") + keywords(mSection)[mField] + "' failed to be found; End-Of-File was reached prematurely");
+        }
+        mInItem = false;
+        mField = 0;
+    }
 
-void YamlReader::parseNodes(std::stringstream& nodeStream, const BaseGraph::Ptr& graph, VertexMap& vMap) const
-{
-    char c;
-    std::string idWord, labelWord, typeWord;
-    while(!nodeStream.eof())
+    /**
+     * Record the value of an attribute column for the last created node or
+     * edge -- properties that do not refer to a declared column are ignored
+     */
+    void addColumnValue(const boost::string_ref& name, const boost::string_ref& value)
     {
-        // looking for initial '-' character, preceding an individual node
-        do
+        const ColumnMap& columns = mSection == SECTION_NODES ? mVertexColumns : mEdgeColumns;
+        ColumnMap::const_iterator cit = columns.find(name);
+        if(cit == columns.end())
         {
-            nodeStream >> c;
+            return;
         }
-        while('-' != c && !nodeStream.eof());
-        if(nodeStream.eof())
+
+        ColumnValue columnValue;
+        columnValue.column = cit->second;
+        columnValue.value = value;
+        if(mSection == SECTION_NODES)
         {
-            break;
+            columnValue.element = mVertices.size() - 1;
+            mVertexColumnValues.push_back(columnValue);
+        } else {
+            columnValue.element = mEdges.size() - 1;
+            mEdgeColumnValues.push_back(columnValue);
         }
+    }
 
-        // parsing one node (one by one, all properties)
-        idWord = nextToken("id:", nodeStream);
-        typeWord = nextToken("type:", nodeStream);
-        labelWord = nextToken("label:", nodeStream);
-        // storing results
-        Vertex::Ptr vertex = VertexTypeManager::getInstance()->createVertex(typeWord, labelWord);
-        vMap[idWord] = vertex;
-        graph->addVertex(vertex);
+    /**
+     * Create the attribute column declared by the current item
+     */
+    void createColumn(AttributeColumns& columns, ColumnMap& columnMap)
+    {
+        std::string name = mValues[0].to_string();
+        try {
+            std::map<std::string, attribute::ColumnType> columnTypes;
+            columnTypes[name] = attribute::getColumnType(mValues[1].to_string());
+            columns.add(columnTypes);
+        } catch(const std::invalid_argument& e)
+        {
+            die("Parsing error: invalid attribute column '" + name + "' -- " + e.what());
+        }
+        columnMap[mValues[0]] = columns.getColumn(name);
     }
-}
 
-void YamlReader::parseEdges(std::stringstream& edgeStream, const BaseGraph::Ptr& graph, VertexMap& vMap) const
-{
-    char c;
-    std::string fromNodeWord, toNodeWord, labelWord;
-    while(!edgeStream.eof())
+    /**
+     * Set the collected column values of the given elements, which have been
+     * added to the graph
+     */
+    template<typename T, typename F>
+    void applyColumnValues(const std::vector<T>& elements, std::vector<ColumnValue>& columnValues, const F& getId) const
+    {
+        for(size_t i = 0; i < columnValues.size(); ++i)
+        {
+            const ColumnValue& columnValue = columnValues[i];
+            try {
+                columnValue.column->setText(getId(elements[columnValue.element]), columnValue.value.to_string());
+            } catch(const std::invalid_argument& e)
+            {
+                die("Parsing error: invalid value of attribute column '" + columnValue.column->getName() + "' -- " + e.what());
+            }
+        }
+        columnValues.clear();
+    }
+
+    void createItem(const BaseGraph::Ptr& graph)
     {
-        // looking for initial '-' character, preceding an individual edge
-        do
+        if(mSection == SECTION_VERTEX_COLUMNS)
+        {
+            createColumn(graph->getVertexColumns(), mVertexColumns);
+        } else if(mSection == SECTION_EDGE_COLUMNS)
         {
-            edgeStream >> c;
+            createColumn(graph->getEdgeColumns(), mEdgeColumns);
+        } else if(mSection == SECTION_NODES)
+        {
+            Vertex::Ptr vertex = VertexTypeManager::getInstance()->createVertex(mValues[1].to_string(), mValues[2].to_string());
+            if(!mVertexMap.insert(VertexMap::value_type(mValues[0], vertex)).second)
+            {
+                die("Parsing error: duplicate node id '" + mValues[0].to_string() + "'");
+            }
+            mVertices.push_back(vertex);
+        } else {
+            Vertex::Ptr sourceVertex = getVertex(mValues[0]);
+            Vertex::Ptr targetVertex = getVertex(mValues[1]);
+            mEdges.push_back( Edge::Ptr(new Edge(sourceVertex, targetVertex, mValues[2].to_string())) );
         }
-        while('-' != c && !edgeStream.eof());
-        if(edgeStream.eof())
+    }
+
+    void completeSection(const BaseGraph::Ptr& graph)
+    {
+        completeItem();
+        if(!mVertices.empty())
         {
-            break;
+            graph->addVertices(mVertices);
+            applyColumnValues(mVertices, mVertexColumnValues, [&graph](const Vertex::Ptr& vertex) { return graph->getVertexId(vertex); });
+            mVertices.clear();
         }
+        if(!mEdges.empty())
+        {
+            graph->addEdges(mEdges);
+            applyColumnValues(mEdges, mEdgeColumnValues, [&graph](const Edge::Ptr& edge) { return graph->getEdgeId(edge); });
+            mEdges.clear();
+        }
+    }
 
-        // parsing one edge (one by one, all properties)
-        fromNodeWord = nextToken("fromNodeId:", edgeStream);
-        toNodeWord = nextToken("toNodeId:", edgeStream);
-        labelWord = nextToken("label:", edgeStream);
-        // storing results
-        Vertex::Ptr sourceVertex = vMap[fromNodeWord]; // NOTE: assumes the .yml (.yaml) file is valid
-        Vertex::Ptr targetvertex = vMap[toNodeWord]; // NOTE: assumes the .yml (.yaml) file is valid
-        Edge::Ptr edge(new Edge(sourceVertex, targetvertex, labelWord));
-        graph->addEdge(edge);
+    Vertex::Ptr getVertex(const boost::string_ref& id) const
+    {
+        VertexMap::const_iterator cit = mVertexMap.find(id);
+        if(cit == mVertexMap.end())
+        {
+            die("Parsing error: edge refers to unknown node id '" + id.to_string() + "'");
+        }
+        return cit->second;
     }
-}
 
-std::string YamlReader::nextToken(const std::string& keyword, std::stringstream& stream) const
-{
-    if(stream.eof())
+    /// throws on reason: "keyword" was expected -> "word" was encountered
+    void die(const std::string& keyword, const std::string& word) const
     {
-        die("Parsing error: keyword '" + keyword + "' failed to be found; End-Of-File was reached prematurely");
+        std::string msg = "graph_analysis::io::YamlReader: Parsing error: keyword '" + keyword + "' expected, but '" + word + "' was found instead";
+        LOG_ERROR_S << msg;
+        throw std::runtime_error(msg);
     }
 
-    std::string word;
-    stream >> word;
-    if(word.compare(keyword))
+    /// throws on provided "msg" reason
+    void die(const std::string& msg) const
     {
-        die(keyword, word);
+        std::string msg_stamped = std::string("graph_analysis::io::YamlReader: ") + msg;
+        LOG_ERROR_S << msg_stamped;
+        throw std::runtime_error(msg_stamped);
     }
 
-    if(stream.eof())
+    const char* mData;
+    size_t mSize;
+
+    Section mSection;
+    bool mInItem;
+    size_t mField;
+    boost::string_ref mValues[NUMBER_OF_FIELDS];
+
+    VertexMap mVertexMap;
+    std::vector<Vertex::Ptr> mVertices;
+    std::vector<Edge::Ptr> mEdges;
+
+    ColumnMap mVertexColumns;
+    ColumnMap mEdgeColumns;
+    std::vector<ColumnValue> mVertexColumnValues;
+    std::vector<ColumnValue> mEdgeColumnValues;
+};
+
+} // end anonymous namespace
+
+void YamlReader::read(const std::string& filename, BaseGraph::Ptr graph)
+{
+    utils::MappedFile::Ptr file;
+    try {
+        file = utils::MappedFile::Ptr(new utils::MappedFile(filename));
+    } catch(const std::runtime_error& e)
     {
-        die("Parsing error: Attribute corresponding to keyword '" + keyword + "' failed to be found; End-Of-File was reached prematurely");
+        // error checking
+        LOG_ERROR_S << "failed to open input file '" << filename
+                    << "' for graph import - " << e.what();
+        return;
     }
-    stream >> word;
-    return word;
+    LOG_INFO_S << "importing graph from file '" << filename << "'";
+
+    graph->clear();
+    parse(file->data(), file->size(), graph);
 }
 
-void YamlReader::die(const std::string& keyword, const std::string& word) const
+void YamlReader::read(std::istream& stream, BaseGraph::Ptr graph)
 {
-    std::string msg = "graph_analysis::io::YamlReader: Parsing error: keyword '" + keyword + "' expected, but '" + word + "' was found instead";
-    LOG_ERROR_S << msg;
-    throw std::runtime_error(msg);
+    std::vector<char> buffer;
+    readAll(stream, buffer);
+
+    graph->clear();
+    parse(buffer.data(), buffer.size(), graph);
 }
 
-void YamlReader::die(const std::string& msg) const
+void YamlReader::parse(const char* data, size_t size, const BaseGraph::Ptr& graph) const
 {
-    std::string msg_stamped = std::string("graph_analysis::io::YamlReader: ") + msg;
-    LOG_ERROR_S << msg_stamped;
-    throw std::runtime_error(msg_stamped);
+    YamlParser parser(data, size);
+    parser.parse(graph);
 }
 
 } // end namespace io
@@ -1,18 +1,87 @@
 #include "YamlWriter.hpp"
+#include <cctype>
 #include <base-logging/Logging.hpp>
 #include <boost/lexical_cast.hpp>
 #include "../GraphElement.hpp"
 
 namespace graph_analysis {
 namespace io {
+namespace {
 
-void YamlWriter::write(const std::string& filename, const BaseGraph& graph) const
+/**
+ * Check whether a text can be written as (unquoted) key or value of the
+ * custom yml format, i.e. whether it is read back unchanged
+ */
+bool isRepresentable(const std::string& text)
 {
-    BaseGraph graph_copy = graph;
-    write(filename, BaseGraph::Ptr(&graph_copy)); // reusing code
+    if(text.find_first_of("\r\n") != std::string::npos)
+    {
+        return false;
+    }
+    return text.empty() || (!std::isspace(static_cast<unsigned char>(text[0]))
+            && !std::isspace(static_cast<unsigned char>(text[text.size() - 1])));
 }
 
-void YamlWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+/**
+ * Select the columns that can be written and declare them in the given
+ * section
+ */
+std::vector<AttributeColumnBase::Ptr> writeColumnDeclarations(std::ostream& stream, const std::string& section, const AttributeColumns& columns)
+{
+    std::vector<AttributeColumnBase::Ptr> writableColumns;
+    AttributeColumns::ColumnMap::const_iterator cit = columns.getColumns().begin();
+    for(; cit != columns.getColumns().end(); ++cit)
+    {
+        const std::string& name = cit->first;
+        bool isSectionName = name == "nodes" || name == "edges" || name == "vertexColumns" || name == "edgeColumns";
+        if(name.empty() || isSectionName || !isRepresentable(name) || name[0] == '-' || name.find_first_of(":#") != std::string::npos)
+        {
+            LOG_WARN_S << "graph_analysis::io::YamlWriter::write: attribute column '" << name << "' cannot be"
+                " represented in the YAML format and will not be written -- use the binary format to preserve it";
+            continue;
+        }
+        writableColumns.push_back(cit->second);
+    }
+
+    if(!writableColumns.empty())
+    {
+        stream << section << ":\n";
+        for(size_t i = 0; i < writableColumns.size(); ++i)
+        {
+            stream << "  - name: " << writableColumns[i]->getName() << "\n";
+            stream << "    type: " << attribute::ColumnTypeTxt[writableColumns[i]->getType()] << "\n";
+        }
+    }
+    return writableColumns;
+}
+
+/**
+ * Write the column values of the given element as additional properties
+ */
+void writeColumnValues(std::ostream& stream, const std::vector<AttributeColumnBase::Ptr>& columns, GraphElementId id)
+{
+    for(size_t i = 0; i < columns.size(); ++i)
+    {
+        const AttributeColumnBase& column = *columns[i];
+        if(id >= column.size())
+        {
+            continue;
+        }
+
+        std::string text = column.getText(id);
+        if(!isRepresentable(text))
+        {
+            LOG_WARN_S << "graph_analysis::io::YamlWriter::write: value of attribute column '" << column.getName()
+                << "' for element " << id << " cannot be represented in the YAML format and will not be written";
+            continue;
+        }
+        stream << "    " << column.getName() << ": " << text << "\n";
+    }
+}
+
+} // end anonymous namespace
+
+void YamlWriter::write(const std::string& filename, const BaseGraph& graph) const
 {
     std::string file(filename);
     if(std::string::npos == file.find(".yml") && std::string::npos == file.find(".yaml"))
@@ -28,40 +97,56 @@ void YamlWriter::write(const std::string& filename, const BaseGraph::Ptr& graph)
         return;
     }
     LOG_INFO_S << "rendering graph to file '" << fname << "'";
+    write(fout, graph);
+    if(fout.is_open())
+    {
+        fout.close();
+    }
+}
+
+void YamlWriter::write(const std::string& filename, const BaseGraph::Ptr& graph) const
+{
+    write(filename, *graph);
+}
+
+void YamlWriter::write(std::ostream& stream, const BaseGraph& graph) const
+{
     // no file header
-    VertexIterator::Ptr nodeIt = graph->getVertexIterator();
-    fout << "nodes:\n";
+    std::vector<AttributeColumnBase::Ptr> vertexColumns = writeColumnDeclarations(stream, "vertexColumns", graph.getVertexColumns());
+    std::vector<AttributeColumnBase::Ptr> edgeColumns = writeColumnDeclarations(stream, "edgeColumns", graph.getEdgeColumns());
+
+    VertexIterator::Ptr nodeIt = graph.getVertexIterator();
+    stream << "nodes:\n";
     while(nodeIt->next()) // outputting nodes
     {
         Vertex::Ptr vertex = nodeIt->current();
-        exportVertex(graph, fout, vertex);
+        exportVertex(graph, stream, vertex, vertexColumns);
     }
 
-    EdgeIterator::Ptr edgeIt = graph->getEdgeIterator();
-    fout << "edges:" << std::endl;
+    EdgeIterator::Ptr edgeIt = graph.getEdgeIterator();
+    stream << "edges:" << std::endl;
     while(edgeIt->next()) // outputting edges
     {
         Edge::Ptr edge = edgeIt->current();
-        exportEdge(graph, fout, edge);
-    }
-    if(fout.is_open())
-    {
-        fout.close();
+        exportEdge(graph, stream, edge, edgeColumns);
     }
 }
 
-void YamlWriter::exportVertex(const BaseGraph::Ptr& graph, std::ofstream& fout, Vertex::Ptr vertex) const
+void YamlWriter::exportVertex(const BaseGraph& graph, std::ostream& fout, Vertex::Ptr vertex, const std::vector<AttributeColumnBase::Ptr>& columns) const
 {
-    fout << "  - id: "      << graph->getVertexId(vertex)   << std::endl;
-    fout << "    type: "    << vertex->getClassName()       << std::endl;
-    fout << "    label: "   << vertex->getLabel()           << std::endl;
+    GraphElementId vertexId = graph.getVertexId(vertex);
+    fout << "  - id: "      << vertexId                     << "\n";
+    fout << "    type: "    << vertex->getClassName()       << "\n";
+    fout << "    label: "   << vertex->getLabel()           << "\n";
+    writeColumnValues(fout, columns, vertexId);
 }
 
-void YamlWriter::exportEdge(const BaseGraph::Ptr& graph, std::ofstream& fout, Edge::Ptr edge) const
+void YamlWriter::exportEdge(const BaseGraph& graph, std::ostream& fout, Edge::Ptr edge, const std::vector<AttributeColumnBase::Ptr>& columns) const
 {
-    fout << "  - fromNodeId: "  << graph->getVertexId(edge->getSourceVertex())  << std::endl;
-    fout << "    toNodeId: "    << graph->getVertexId(edge->getTargetVertex())  << std::endl;
-    fout << "    label: "       << edge->getLabel()                             << std::endl;
+    fout << "  - fromNodeId: "  << graph.getVertexId(edge->getSourceVertex())   << "\n";
+    fout << "    toNodeId: "    << graph.getVertexId(edge->getTargetVertex())   << "\n";
+    fout << "    label: "       << edge->getLabel()                             << "\n";
+    writeColumnValues(fout, columns, graph.getEdgeId(edge));
 }
 
 } // end namespace io
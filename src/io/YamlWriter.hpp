@@ -2,9 +2,11 @@
 #define GRAPH_ANALYSIS_IO_YAMLEXPORTWRITER_HPP
 
 #include <string>
+#include <vector>
 #include <fstream>
 #include <stdexcept>
 #include "../GraphIO.hpp"
+#include "../AttributeColumn.hpp"
 
 namespace graph_analysis {
 namespace io {
@@ -14,6 +16,9 @@ namespace io {
  * \class YamlWriter
  * \brief Custom yml graph exporter
  * \details Exports requested graph to custom YAML/yml format (i.e. custom yml that simply lists the nodes with their properties and then lists edges and their properties)
+ *
+ * Attribute columns are declared in the sections vertexColumns/edgeColumns
+ * and their values are listed as additional properties of nodes and edges
  */
 class YamlWriter : public Writer
 {
@@ -23,15 +28,17 @@ private:
      * \param graph the given graph to render
      * \param fout the given stream to output to
      * \param vertex the requested vertex to render
+     * \param columns the vertex attribute columns to render
      */
-    void exportVertex(const BaseGraph::Ptr& graph, std::ofstream& fout, Vertex::Ptr vertex) const;
+    void exportVertex(const BaseGraph& graph, std::ostream& fout, Vertex::Ptr vertex, const std::vector<AttributeColumnBase::Ptr>& columns) const;
     /**
      * \brief prints to given stream the requested edge of the given graph
      * \param graph the given graph to render
      * \param fout the given stream to output to
      * @param edge the requested edge to render
+     * \param columns the edge attribute columns to render
      */
-    void exportEdge(const BaseGraph::Ptr& graph, std::ofstream& fout, Edge::Ptr edge) const;
+    void exportEdge(const BaseGraph& graph, std::ostream& fout, Edge::Ptr edge, const std::vector<AttributeColumnBase::Ptr>& columns) const;
 public:
     /**
      * \brief outputs the given graph to the given file
@@ -45,6 +52,12 @@ public:
      * \param graph smart pointer to the requested graph to be printed
      */
     void write(const std::string& filename, const BaseGraph::Ptr& graph) const;
+    /**
+     * \brief outputs the given graph to the given stream
+     * \param stream requested output stream
+     * \param graph requested graph to be printed
+     */
+    void write(std::ostream& stream, const BaseGraph& graph) const;
 };
 
 } // end namespace io
@@ -23,6 +23,12 @@ DirectedGraph::DirectedGraph(const DirectedGraph& other)
 DirectedGraph::~DirectedGraph()
 {}
 
+void DirectedGraph::reserve(size_t numberOfVertices, size_t numberOfEdges)
+{
+    mGraph.reserveNode(mGraph.maxNodeId() + 1 + numberOfVertices);
+    mGraph.reserveArc(mGraph.maxArcId() + 1 + numberOfEdges);
+}
+
 GraphElementId DirectedGraph::addVertexInternal(const Vertex::Ptr& vertex)
 {
     graph_t::Node node = mGraph.addNode();
@@ -104,6 +110,32 @@ Vertex::Ptr DirectedGraph::getTargetVertex(const Edge::Ptr& e) const
     return mVertexMap[ mGraph.target( mGraph.arcFromId(edgeId)) ];
 }
 
+VertexHandle DirectedGraph::source(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph.id( mGraph.source( mGraph.arcFromId(edge.id))) );
+}
+
+VertexHandle DirectedGraph::target(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph.id( mGraph.target( mGraph.arcFromId(edge.id))) );
+}
+
+void DirectedGraph::visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    for(graph_t::OutArcIt a(mGraph, mGraph.nodeFromId(vertex.id)); a != ::lemon::INVALID; ++a)
+    {
+        visitor(context, EdgeHandle( mGraph.id(a) ));
+    }
+}
+
+void DirectedGraph::visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    for(graph_t::InArcIt a(mGraph, mGraph.nodeFromId(vertex.id)); a != ::lemon::INVALID; ++a)
+    {
+        visitor(context, EdgeHandle( mGraph.id(a) ));
+    }
+}
+
 /**
  * \brief Direct usage off operator= is disallowed in lemon, thus
  * need for explicit usage of copy functions
@@ -126,6 +158,8 @@ DirectedGraph& DirectedGraph::operator=(const DirectedGraph& other)
         Edge::Ptr edge = mEdgeMap[a];
         edge->associate(this->getId(), this->mGraph.id(a));
     }
+    incrementVersion();
+    rebuildIndices();
 
     return *this;
 }
@@ -138,7 +172,9 @@ void DirectedGraph::write(std::ostream& ostream) const
     // Use explicit conversion to string map first
 
     EdgeStringMap edgeStringMap(mGraph);
+    EdgeStringMap edgeClassMap(mGraph);
     VertexStringMap vertexStringMap(mGraph);
+    VertexStringMap vertexClassMap(mGraph);
     EdgeIdMap edgeIdMap(mGraph);
     VertexIdMap vertexIdMap(mGraph);
 
@@ -147,7 +183,8 @@ void DirectedGraph::write(std::ostream& ostream) const
         Edge::Ptr edge = mEdgeMap[a];
         if(edge)
         {
-            edgeStringMap[a] = edge->toString();
+            edgeStringMap[a] = edge->getLabel();
+            edgeClassMap[a] = edge->getClassName();
             edgeIdMap[a] = getEdgeId(edge);
         }
     }
@@ -157,14 +194,17 @@ void DirectedGraph::write(std::ostream& ostream) const
         Vertex::Ptr vertex = mVertexMap[n];
         if(vertex)
         {
-            vertexStringMap[n] = vertex->toString();
+            vertexStringMap[n] = vertex->getLabel();
+            vertexClassMap[n] = vertex->getClassName();
             vertexIdMap[n] = getVertexId(vertex);
         }
     }
 
     ::lemon::digraphWriter(mGraph, ostream).
         arcMap("edges", edgeStringMap).
+        arcMap("edgeClass", edgeClassMap).
         nodeMap("vertices", vertexStringMap).
+        nodeMap("vertexClass", vertexClassMap).
         arcMap("edgeId", edgeIdMap).
         nodeMap("vertexId", vertexIdMap).
         attribute("caption", "test").
@@ -288,7 +328,61 @@ SubGraph::Ptr DirectedGraph::createSubGraph(const BaseGraph::Ptr& baseGraph) con
 
 BaseGraph::Ptr DirectedGraph::copy() const
 {
-    return shared_ptr<BaseGraph>(new DirectedGraph(*this));
+    DirectedGraph* graph = new DirectedGraph();
+    BaseGraph::Ptr baseGraph(graph);
+    graph->copyStructure(*this);
+    GraphElement::shareAssociations(graph->getId(), getId());
+    graph->copyIndices(*this);
+    return baseGraph;
+}
+
+void DirectedGraph::copyStructure(const DirectedGraph& other)
+{
+    // Nodes and arcs are added in the order of their ids to the empty
+    // graph, so that they receive the same ids -- ids which are unused in
+    // the other graph are filled with placeholders, which are erased
+    // afterwards
+    const graph_t& otherGraph = other.mGraph;
+    int maxNodeId = otherGraph.maxNodeId();
+    int maxArcId = otherGraph.maxArcId();
+    mGraph.reserveNode(maxNodeId + 1);
+    mGraph.reserveArc(maxArcId + 1);
+
+    for(int id = 0; id <= maxNodeId; ++id)
+    {
+        graph_t::Node node = mGraph.addNode();
+        graph_t::Node otherNode = otherGraph.nodeFromId(id);
+        if(otherGraph.valid(otherNode))
+        {
+            mVertexMap[node] = other.mVertexMap[otherNode];
+        }
+    }
+
+    std::vector<graph_t::Arc> placeholderArcs;
+    for(int id = 0; id <= maxArcId; ++id)
+    {
+        graph_t::Arc otherArc = otherGraph.arcFromId(id);
+        if(otherGraph.valid(otherArc))
+        {
+            graph_t::Arc arc = mGraph.addArc(mGraph.nodeFromId(otherGraph.id(otherGraph.source(otherArc))),
+                    mGraph.nodeFromId(otherGraph.id(otherGraph.target(otherArc))));
+            mEdgeMap[arc] = other.mEdgeMap[otherArc];
+        } else {
+            placeholderArcs.push_back(mGraph.addArc(mGraph.nodeFromId(0), mGraph.nodeFromId(0)));
+        }
+    }
+
+    for(size_t i = 0; i < placeholderArcs.size(); ++i)
+    {
+        mGraph.erase(placeholderArcs[i]);
+    }
+    for(int id = 0; id <= maxNodeId; ++id)
+    {
+        if(!otherGraph.valid(otherGraph.nodeFromId(id)))
+        {
+            mGraph.erase(mGraph.nodeFromId(id));
+        }
+    }
 }
 
 BaseGraph::Ptr DirectedGraph::newInstance() const
@@ -29,6 +29,9 @@ public:
 
     /**
      * Copy the graph
+     * \details The copy uses the same element ids and shares the
+     * associations of vertices and edges with this graph, see
+     * GraphElement::shareAssociations
      */
     BaseGraph::Ptr copy() const;
 
@@ -90,6 +93,9 @@ public:
      */
     Vertex::Ptr getTargetVertex(const Edge::Ptr& e) const;
 
+    VertexHandle source(EdgeHandle edge) const;
+    VertexHandle target(EdgeHandle edge) const;
+
     DirectedGraph(const DirectedGraph& other);
 
     /**
@@ -98,8 +104,18 @@ public:
      */
     DirectedGraph& operator=(const DirectedGraph& other);
 
+    /**
+     * Write the graph in LEMON graph format (LGF), storing label, class name
+     * and id of all vertices and edges
+     * \see io::LemonReader
+     */
     void write(std::ostream& ostream = std::cout) const;
 
+    /**
+     * Reserve space for additional vertices and edges
+     */
+    void reserve(size_t numberOfVertices, size_t numberOfEdges);
+
     /**
      * Get the vertex iterator for this implementation
      */
@@ -155,6 +171,18 @@ protected:
      */
     virtual SubGraph::Ptr createSubGraph(const BaseGraph::Ptr& graph) const;
 
+    /**
+     * Copy nodes, arcs and their data of another graph into this (empty)
+     * graph, preserving the ids of nodes and arcs
+     */
+    void copyStructure(const DirectedGraph& other);
+
+    /**
+     * Visit the out/in edges of a vertex without touching the elements
+     */
+    void visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+    void visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+
     // Property maps to store data associated with vertices and edges
     EdgeMap mEdgeMap;
     VertexMap mVertexMap;
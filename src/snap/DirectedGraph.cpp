@@ -14,14 +14,12 @@ DirectedGraph::~DirectedGraph()
 
 BaseGraph::Ptr DirectedGraph::copy() const
 {
-    // TODO: use snap internal copy
-    BaseGraph::Ptr baseGraph(new DirectedGraph());
-
-    graph_analysis::EdgeIterator::Ptr edgeIt = getEdgeIterator();
-    while(edgeIt->next())
-    {
-        baseGraph->addEdge(edgeIt->current());
-    }
+    DirectedGraph* graph = new DirectedGraph();
+    BaseGraph::Ptr baseGraph(graph);
+    // The snap internal copy preserves the ids of nodes and edges
+    graph->mGraph = mGraph;
+    GraphElement::shareAssociations(graph->getId(), getId());
+    graph->copyIndices(*this);
     return baseGraph;
 }
 
@@ -30,6 +28,11 @@ BaseGraph::Ptr DirectedGraph::newInstance() const
     return BaseGraph::Ptr(new DirectedGraph());
 }
 
+void DirectedGraph::reserve(size_t numberOfVertices, size_t numberOfEdges)
+{
+    mGraph.Reserve(mGraph.GetNodes() + numberOfVertices, mGraph.GetEdges() + numberOfEdges);
+}
+
 GraphElementId DirectedGraph::addVertexInternal(const Vertex::Ptr& vertex)
 {
     TInt nodeId = mGraph.AddNode();
@@ -83,6 +86,34 @@ Vertex::Ptr DirectedGraph::getTargetVertex(const Edge::Ptr& e) const
     return getVertex(nodeId);
 }
 
+VertexHandle DirectedGraph::source(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph.GetEI(edge.id).GetSrcNId() );
+}
+
+VertexHandle DirectedGraph::target(EdgeHandle edge) const
+{
+    return VertexHandle( mGraph.GetEI(edge.id).GetDstNId() );
+}
+
+void DirectedGraph::visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    graph_t::TNodeI nodeIt = mGraph.GetNI(vertex.id);
+    for(int i = 0; i < nodeIt.GetOutDeg(); ++i)
+    {
+        visitor(context, EdgeHandle( nodeIt.GetOutEId(i) ));
+    }
+}
+
+void DirectedGraph::visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const
+{
+    graph_t::TNodeI nodeIt = mGraph.GetNI(vertex.id);
+    for(int i = 0; i < nodeIt.GetInDeg(); ++i)
+    {
+        visitor(context, EdgeHandle( nodeIt.GetInEId(i) ));
+    }
+}
+
 /**
  * Get the vertex iterator for this implementation
  */
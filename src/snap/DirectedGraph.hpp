@@ -81,6 +81,9 @@ public:
      */
     Vertex::Ptr getTargetVertex(const Edge::Ptr& e) const;
 
+    VertexHandle source(EdgeHandle edge) const;
+    VertexHandle target(EdgeHandle edge) const;
+
     /**
      * Get the vertex iterator for this implementation
      */
@@ -97,6 +100,11 @@ public:
 
     graph_analysis::EdgeIterator::Ptr getInEdgeIterator(const Vertex::Ptr& vertex) const;
 
+    /**
+     * Reserve space for additional vertices and edges
+     */
+    void reserve(size_t numberOfVertices, size_t numberOfEdges);
+
 protected:
     /**
      * \brief Add a vertex
@@ -121,6 +129,12 @@ protected:
     virtual void removeEdgeInternal(const Edge::Ptr& edge);
 
     virtual SubGraph::Ptr createSubGraph(const BaseGraph::Ptr& baseGraph) const;
+
+    /**
+     * Visit the out/in edges of a vertex without touching the elements
+     */
+    void visitOutEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
+    void visitInEdges(VertexHandle vertex, EdgeVisitor visitor, void* context) const;
 };
 
 } // end namespace snap
@@ -0,0 +1,57 @@
+#include "MappedFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace graph_analysis {
+namespace utils {
+
+MappedFile::MappedFile(const std::string& filename, AccessPattern pattern)
+    : mFilename(filename)
+    , mData(NULL)
+    , mSize(0)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        throw std::runtime_error("graph_analysis::utils::MappedFile: failed to open '" + filename + "': " + strerror(errno));
+    }
+
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0)
+    {
+        std::string error = strerror(errno);
+        close(fd);
+        throw std::runtime_error("graph_analysis::utils::MappedFile: failed to stat '" + filename + "': " + error);
+    }
+
+    mSize = fileStat.st_size;
+    if(mSize > 0)
+    {
+        void* data = mmap(NULL, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data == MAP_FAILED)
+        {
+            std::string error = strerror(errno);
+            close(fd);
+            throw std::runtime_error("graph_analysis::utils::MappedFile: failed to map '" + filename + "': " + error);
+        }
+        madvise(data, mSize, pattern == SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM);
+        mData = static_cast<const char*>(data);
+    }
+    // the mapping remains valid after closing the descriptor
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if(mData)
+    {
+        munmap(const_cast<char*>(mData), mSize);
+    }
+}
+
+} // end namespace utils
+} // end namespace graph_analysis
@@ -0,0 +1,59 @@
+#ifndef GRAPH_ANALYSIS_UTILS_MAPPED_FILE_HPP
+#define GRAPH_ANALYSIS_UTILS_MAPPED_FILE_HPP
+
+#include <string>
+#include <stdexcept>
+#include "../SharedPtr.hpp"
+
+namespace graph_analysis {
+namespace utils {
+
+/**
+ * \class MappedFile
+ * \brief Read-only memory mapping of a file
+ * \details The mapping is released when the object is destroyed
+ */
+class MappedFile
+{
+public:
+    typedef shared_ptr<MappedFile> Ptr;
+
+    /// Expected access pattern, passed as hint to the kernel
+    enum AccessPattern { SEQUENTIAL, RANDOM };
+
+    /**
+     * Map the given file into memory
+     * \throw std::runtime_error if the file cannot be opened or mapped
+     */
+    MappedFile(const std::string& filename, AccessPattern pattern = SEQUENTIAL);
+
+    ~MappedFile();
+
+    /**
+     * Get the start of the mapped memory
+     * \return pointer to the data, or NULL for an empty file
+     */
+    const char* data() const { return mData; }
+
+    /**
+     * Get the size of the mapped file in bytes
+     */
+    size_t size() const { return mSize; }
+
+    /**
+     * Get the name of the mapped file
+     */
+    const std::string& getFilename() const { return mFilename; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    std::string mFilename;
+    const char* mData;
+    size_t mSize;
+};
+
+} // end namespace utils
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_UTILS_MAPPED_FILE_HPP
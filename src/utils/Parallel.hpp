@@ -0,0 +1,90 @@
+#ifndef GRAPH_ANALYSIS_UTILS_PARALLEL_HPP
+#define GRAPH_ANALYSIS_UTILS_PARALLEL_HPP
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace graph_analysis {
+namespace utils {
+
+/**
+ * Run the given function for each index in [0,n) on a separate thread and
+ * rethrow the first error that occurred
+ * \details Threads are started per call, there is no thread pool. If a
+ * thread cannot be started, the threads started so far are joined before
+ * the error is rethrown
+ */
+template<typename F>
+void runParallel(size_t n, const F& function)
+{
+    std::vector<std::exception_ptr> errors(n);
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    try {
+        for(size_t i = 0; i < n; ++i)
+        {
+            threads.push_back(std::thread([&errors, &function, i]()
+                {
+                    try {
+                        function(i);
+                    } catch(...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                }));
+        }
+    } catch(...)
+    {
+        for(size_t i = 0; i < threads.size(); ++i)
+        {
+            threads[i].join();
+        }
+        throw;
+    }
+
+    for(size_t i = 0; i < threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    for(size_t i = 0; i < errors.size(); ++i)
+    {
+        if(errors[i])
+        {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+
+/**
+ * Split the range [0,size) into chunks of at least minChunkSize entries
+ * and call function(begin, end) for each chunk, using at most one thread
+ * per hardware thread
+ * \details The function is called in the calling thread, if the range
+ * consists of a single chunk, e.g. for a minChunkSize of
+ * std::numeric_limits<size_t>::max()
+ */
+template<typename F>
+void parallelFor(size_t size, size_t minChunkSize, const F& function)
+{
+    size_t numberOfChunks = std::max(1u, std::thread::hardware_concurrency());
+    numberOfChunks = std::min(numberOfChunks, size/std::max(minChunkSize, static_cast<size_t>(1)));
+    if(numberOfChunks <= 1)
+    {
+        function(static_cast<size_t>(0), size);
+        return;
+    }
+
+    // Chunks differ in size by at most one entry, so that each has at least
+    // size/numberOfChunks >= minChunkSize entries
+    runParallel(numberOfChunks, [&function, size, numberOfChunks](size_t i)
+        {
+            function(i*size/numberOfChunks, (i + 1)*size/numberOfChunks);
+        });
+}
+
+} // end namespace utils
+} // end namespace graph_analysis
+#endif // GRAPH_ANALYSIS_UTILS_PARALLEL_HPP
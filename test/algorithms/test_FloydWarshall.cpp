@@ -2,6 +2,7 @@
 #include <graph_analysis/WeightedEdge.hpp>
 #include <graph_analysis/algorithms/FloydWarshall.hpp>
 #include <graph_analysis/lemon/Graph.hpp>
+#include <atomic>
 
 using namespace graph_analysis;
 using namespace graph_analysis::algorithms;
@@ -12,6 +13,14 @@ double getWeight(Edge::Ptr edge)
     return weightedEdge->getWeight();
 }
 
+std::atomic<size_t> numberOfEvaluations(0);
+
+double getCountedWeight(Edge::Ptr edge)
+{
+    ++numberOfEvaluations;
+    return getWeight(edge);
+}
+
 BOOST_AUTO_TEST_SUITE(algorithms_floyd_warshall)
 BOOST_AUTO_TEST_CASE(all_shortest_path)
 {
@@ -59,4 +68,46 @@ BOOST_AUTO_TEST_CASE(all_shortest_path)
 
     BOOST_REQUIRE_THROW(FloydWarshall::allShortestPaths(graph, getWeight), std::runtime_error);
 }
+
+BOOST_AUTO_TEST_CASE(weight_column)
+{
+    graph_analysis::BaseGraph::Ptr graph(new graph_analysis::lemon::DirectedGraph());
+
+    Vertex::Ptr v0( new Vertex("0"));
+    Vertex::Ptr v1( new Vertex("1"));
+    Vertex::Ptr v2( new Vertex("2"));
+
+    WeightedEdge::Ptr e0(new WeightedEdge(v0, v1, 30.0));
+    WeightedEdge::Ptr e1(new WeightedEdge(v1, v2, 10.0));
+    graph->addEdge(e0);
+    graph->addEdge(e1);
+
+    numberOfEvaluations = 0;
+    WeightColumn weights(graph, getCountedWeight);
+    BOOST_REQUIRE_EQUAL(numberOfEvaluations, 2);
+    BOOST_REQUIRE_EQUAL(weights(e0), 30.0);
+    BOOST_REQUIRE_EQUAL(weights.getWeight(graph->getEdgeId(e1)), 10.0);
+
+    DistanceMatrix distanceMatrix = FloydWarshall::allShortestPaths(graph, weights);
+    double distance02 = distanceMatrix[std::pair<Vertex::Ptr, Vertex::Ptr>(v0,v2)];
+    BOOST_REQUIRE_EQUAL(distance02, 40.0);
+    BOOST_REQUIRE_EQUAL(numberOfEvaluations, 2);
+
+    // Modifying the graph invalidates the weights
+    WeightedEdge::Ptr e2(new WeightedEdge(v0, v2, 20.0));
+    graph->addEdge(e2);
+    BOOST_REQUIRE(!weights.isUpToDate());
+    BOOST_REQUIRE_EQUAL(weights(e2), 20.0);
+    BOOST_REQUIRE(weights.isUpToDate());
+    BOOST_REQUIRE_EQUAL(numberOfEvaluations, 5);
+
+    numberOfEvaluations = 0;
+    WeightColumn parallelWeights(graph, getCountedWeight, true);
+    BOOST_REQUIRE(parallelWeights.isParallel());
+    BOOST_REQUIRE_EQUAL(numberOfEvaluations, 3);
+    BOOST_REQUIRE_EQUAL(parallelWeights(e2), 20.0);
+
+    graph_analysis::BaseGraph::Ptr otherGraph(new graph_analysis::lemon::DirectedGraph());
+    BOOST_REQUIRE_THROW(FloydWarshall::allShortestPaths(otherGraph, weights), std::invalid_argument);
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,10 @@
 #include <graph_analysis/WeightedEdge.hpp>
 #include <graph_analysis/NWeightedEdge.hpp>
 #include <graph_analysis/Vertex.hpp>
+#include <graph_analysis/HyperEdge.hpp>
+#include <graph_analysis/GraphArena.hpp>
+#include <graph_analysis/VertexTypeManager.hpp>
+#include <graph_analysis/EdgeTypeManager.hpp>
 
 using namespace graph_analysis;
 
@@ -66,5 +70,118 @@ BOOST_AUTO_TEST_CASE(nweighted_edge)
     BOOST_REQUIRE_THROW( NWeightedEdge<double>::Ptr(new NWeightedEdge<double>(weights3d)), std::invalid_argument );
 }
 
+BOOST_AUTO_TEST_CASE(nweighted_storage)
+{
+    typedef NWeightedEdge<int32_t, 3> edge_t;
+    BOOST_REQUIRE_EQUAL(edge_t::getDimensions(), 3);
+
+    std::vector<int32_t> weights(3);
+    weights[0] = 1;
+    weights[1] = 2;
+    weights[2] = 3;
+    edge_t::Ptr edge(new edge_t(weights));
+    BOOST_REQUIRE_EQUAL(edge->getWeight<2>(), 3);
+    edge->setWeight<1>(20);
+    BOOST_REQUIRE_EQUAL(edge->getWeight(1), 20);
+
+    std::vector<edge_t::Ptr> edges;
+    for(int32_t i = 0; i < 10; ++i)
+    {
+        edges.push_back(edge_t::Ptr(new edge_t(std::vector<int32_t>(3, i))));
+    }
+    std::vector<int32_t> exported = edge_t::exportWeights(edges, 1);
+    BOOST_REQUIRE_EQUAL(exported.size(), edges.size());
+    for(size_t i = 0; i < exported.size(); ++i)
+    {
+        BOOST_REQUIRE_EQUAL(exported[i], static_cast<int32_t>(i));
+    }
+    BOOST_REQUIRE_THROW(edge_t::exportWeights(edges, 3), std::out_of_range);
+
+    // Weights are serialized as vector
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oarch(ss);
+        oarch << weights;
+    }
+    edge_t restored;
+    restored.deserializeWeights(ss.str());
+    BOOST_REQUIRE(restored.getWeights() == weights);
+    restored.deserializeWeights(edge->serializeWeights());
+    BOOST_REQUIRE(restored.getWeights() == edge->getWeights());
+
+    edge_t restoredBinary;
+    restoredBinary.deserializeBinaryWeights(edge->serializeBinaryWeights());
+    BOOST_REQUIRE(restoredBinary.getWeights() == edge->getWeights());
+}
+
+BOOST_AUTO_TEST_CASE(arena_clone)
+{
+    Vertex::PtrList vertices;
+    Edge::PtrList edges;
+    WeightedEdge::Ptr weightedClone;
+    {
+        GraphArena arena(4096);
+        for(size_t i = 0; i < 1000; ++i)
+        {
+            vertices.push_back(VertexTypeManager::getInstance()->createVertex("graph_analysis::Vertex", "v", arena));
+        }
+        for(size_t i = 1; i < vertices.size(); ++i)
+        {
+            edges.push_back(EdgeTypeManager::getInstance()->createEdge("graph_analysis::Edge", vertices[i-1], vertices[i], "e", arena));
+        }
+        BOOST_REQUIRE_MESSAGE(arena.getNumberOfSlabs() > 1, "Elements are allocated in slabs, got " << arena.getNumberOfSlabs());
+        BOOST_REQUIRE(arena.getReservedBytes() >= arena.getNumberOfSlabs()*4096);
+
+        Edge::Ptr weighted(new WeightedEdge(10.0));
+        weightedClone = dynamic_pointer_cast<WeightedEdge>(weighted->clone(arena));
+        BOOST_REQUIRE_MESSAGE(weightedClone, "Clone of weighted edge has the correct type");
+
+        // Subclass without an arena override falls back to a heap allocated clone
+        Vertex::Ptr hyperEdge(new HyperEdge());
+        Vertex::Ptr hyperEdgeClone = hyperEdge->clone(arena);
+        BOOST_REQUIRE_MESSAGE(dynamic_pointer_cast<HyperEdge>(hyperEdgeClone), "Clone of hyperedge has the correct type");
+    }
+
+    // Elements keep the slabs alive after the arena has been dropped
+    BOOST_REQUIRE_EQUAL(vertices[10]->getLabel(), "v");
+    BOOST_REQUIRE(edges[10]->getSourceVertex() == vertices[10]);
+    BOOST_REQUIRE_EQUAL(weightedClone->getWeight(), 10.0);
+}
+
+BOOST_AUTO_TEST_CASE(type_ids)
+{
+    VertexTypeManager* vManager = VertexTypeManager::getInstance();
+    EdgeTypeManager* eManager = EdgeTypeManager::getInstance();
+
+    vertex::TypeId vertexType = vManager->getTypeId("graph_analysis::Vertex");
+    BOOST_REQUIRE_EQUAL(vManager->registerType(Vertex::Ptr(new Vertex())), vertexType);
+    BOOST_REQUIRE_THROW(vManager->getTypeId("graph_analysis::UnknownVertex"), std::invalid_argument);
+    BOOST_REQUIRE_THROW(vManager->createVertex(vertex::TypeId(1000)), std::invalid_argument);
+
+    vertex::TypeId hyperEdgeType = vManager->registerType(Vertex::Ptr(new HyperEdge()));
+    BOOST_REQUIRE(hyperEdgeType != vertexType);
+    Vertex::Ptr vertex = vManager->createVertex(hyperEdgeType, "h");
+    BOOST_REQUIRE(dynamic_pointer_cast<HyperEdge>(vertex));
+    BOOST_REQUIRE_EQUAL(vertex->getLabel(), "h");
+
+    edge::TypeId weightedEdgeType = eManager->registerType(Edge::Ptr(new WeightedEdge()));
+    BOOST_REQUIRE_EQUAL(eManager->getTypeId(WeightedEdge().getClassName()), weightedEdgeType);
+
+    GraphArena arena;
+    Vertex::PtrList vertices = vManager->createVertices(vertexType, 100, arena);
+    Edge::PtrList edges = eManager->createEdges(weightedEdgeType, 99, arena);
+    BOOST_REQUIRE_EQUAL(vertices.size(), 100);
+    BOOST_REQUIRE_EQUAL(edges.size(), 99);
+    for(size_t i = 0; i < edges.size(); ++i)
+    {
+        BOOST_REQUIRE(vertices[i] != vertices[i+1]);
+        BOOST_REQUIRE(dynamic_pointer_cast<WeightedEdge>(edges[i]));
+    }
+
+    Edge::Ptr edge = eManager->createEdge(weightedEdgeType, vertices[0], vertices[1], "e");
+    BOOST_REQUIRE(edge->getSourceVertex() == vertices[0]);
+    BOOST_REQUIRE(edge->getTargetVertex() == vertices[1]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -1,8 +1,18 @@
 #include <boost/test/unit_test.hpp>
 #include <graph_analysis/lemon/Graph.hpp>
 #include <graph_analysis/snap/Graph.hpp>
+#include <graph_analysis/boost_graph/DirectedGraph.hpp>
 #include <graph_analysis/filters/CommonFilters.hpp>
+#include <graph_analysis/filters/RegexFilters.hpp>
 #include <graph_analysis/BipartiteGraph.hpp>
+#include <graph_analysis/WeightedEdge.hpp>
+#include <graph_analysis/EdgeTypeManager.hpp>
+#include <graph_analysis/VersionedGraph.hpp>
+#include <graph_analysis/GraphTraits.hpp>
+#include <graph_analysis/GraphSnapshot.hpp>
+#include <atomic>
+#include <sstream>
+#include <thread>
 
 #include <graph_analysis/GraphIO.hpp>
 
@@ -143,6 +153,270 @@ BOOST_AUTO_TEST_CASE(clone_edges)
     }
 }
 
+BOOST_AUTO_TEST_CASE(parallel_clone)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        // Large enough to be cloned in multiple chunks
+        size_t numberOfVertices = 20000;
+        std::vector<Vertex::Ptr> vertices;
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            std::stringstream ss;
+            ss << v;
+            vertices.push_back(Vertex::Ptr(new Vertex(ss.str())));
+        }
+        std::vector<Edge::Ptr> edges;
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            edges.push_back(Edge::Ptr(new WeightedEdge(vertices[v], vertices[(v*7 + 1) % numberOfVertices], v)));
+        }
+        graph->addVertices(vertices);
+        graph->addEdges(edges);
+        graph->setParallelCloneEnabled(true);
+
+        BaseGraph::Ptr graph_clone = graph->clone();
+        BaseGraph::Ptr graph_edge_clone = graph->cloneEdges();
+        BOOST_REQUIRE_EQUAL(graph_clone->getAllVertices().size(), numberOfVertices);
+        BOOST_REQUIRE_EQUAL(graph_edge_clone->getAllVertices().size(), numberOfVertices);
+
+        std::vector<Edge::Ptr> clonedEdges = graph_clone->getAllEdges();
+        BOOST_REQUIRE_EQUAL(clonedEdges.size(), edges.size());
+        for(size_t e = 0; e < clonedEdges.size(); ++e)
+        {
+            WeightedEdge::Ptr edge = dynamic_pointer_cast<WeightedEdge>(clonedEdges[e]);
+            BOOST_REQUIRE(edge);
+            size_t v = edge->getWeight();
+            BOOST_REQUIRE(!graph->contains(clonedEdges[e]));
+            BOOST_REQUIRE(graph_clone->contains(edge->getSourceVertex()) && !graph->contains(edge->getSourceVertex()));
+            BOOST_REQUIRE_EQUAL(edge->getSourceVertex()->getLabel(), vertices[v]->getLabel());
+            BOOST_REQUIRE_EQUAL(edge->getTargetVertex()->getLabel(), vertices[(v*7 + 1) % numberOfVertices]->getLabel());
+        }
+
+        clonedEdges = graph_edge_clone->getAllEdges();
+        BOOST_REQUIRE_EQUAL(clonedEdges.size(), edges.size());
+        for(size_t e = 0; e < clonedEdges.size(); ++e)
+        {
+            WeightedEdge::Ptr edge = dynamic_pointer_cast<WeightedEdge>(clonedEdges[e]);
+            size_t v = edge->getWeight();
+            BOOST_REQUIRE(!graph->contains(clonedEdges[e]));
+            BOOST_REQUIRE(edge->getSourceVertex() == vertices[v]);
+            BOOST_REQUIRE(edge->getTargetVertex() == vertices[(v*7 + 1) % numberOfVertices]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(attribute_columns)
+{
+    EdgeTypeManager* eManager = EdgeTypeManager::getInstance();
+    eManager->registerType(Edge::Ptr(new WeightedEdge()));
+    eManager->registerColumn(WeightedEdge().getClassName(), "capacity", attribute::INT);
+
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Edge::Ptr e0(new Edge(v0, v1));
+        graph->addEdge(e0);
+        BOOST_REQUIRE_MESSAGE(!graph->getEdgeColumns().has("capacity"), "Column should only be created for registered types");
+
+        Edge::Ptr e1(new WeightedEdge(v1, v0, 1.0));
+        graph->addEdge(e1);
+        BOOST_REQUIRE_MESSAGE(graph->getEdgeColumns().has("capacity"), "Registered column has not been created");
+
+        AttributeColumn<int64_t>& capacity = graph->getEdgeColumn<int64_t>("capacity");
+        capacity.set(graph->getEdgeId(e1), 10);
+        BOOST_REQUIRE_THROW(graph->getEdgeColumn<double>("capacity"), std::invalid_argument);
+
+        AttributeColumn<std::string>& names = graph->getVertexColumn<std::string>("name");
+        names.set(graph->getVertexId(v0), "first");
+        BOOST_REQUIRE_MESSAGE(names.get(graph->getVertexId(v1)) == "", "Expected default value for unassigned vertex");
+
+        BaseGraph::Ptr graph_clone = graph->clone();
+        std::vector<Edge::Ptr> edges = graph_clone->getAllEdges();
+        for(size_t e = 0; e < edges.size(); ++e)
+        {
+            int64_t expected = edges[e]->getClassName() == e1->getClassName() ? 10 : 0;
+            BOOST_REQUIRE_MESSAGE(graph_clone->getEdgeColumn<int64_t>("capacity").get(graph_clone->getEdgeId(edges[e])) == expected, "Column value has not been cloned");
+        }
+        std::vector<Vertex::Ptr> vertices = graph_clone->getAllVertices();
+        size_t named = 0;
+        for(size_t v = 0; v < vertices.size(); ++v)
+        {
+            named += graph_clone->getVertexColumn<std::string>("name").get(graph_clone->getVertexId(vertices[v])) == "first";
+        }
+        BOOST_REQUIRE_MESSAGE(named == 1, "Vertex column value has not been cloned");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(copy_on_write)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+        Vertex::Ptr v3(new Vertex("v3"));
+        Edge::Ptr e0(new Edge(v0, v1));
+        Edge::Ptr e1(new Edge(v1, v2));
+        Edge::Ptr e2(new Edge(v2, v0));
+
+        // Leave unused ids in the graph
+        Edge::Ptr loop(new Edge(v3, v3));
+        graph->addEdge(e0);
+        graph->addEdge(e1);
+        graph->addEdge(loop);
+        graph->removeEdge(loop);
+        graph->removeVertex(v3);
+
+        BaseGraph::Ptr graphCopy = graph->copy();
+        BOOST_REQUIRE_EQUAL(graphCopy->getAllVertices().size(), 3);
+        BOOST_REQUIRE_EQUAL(graphCopy->getAllEdges().size(), 2);
+        BOOST_REQUIRE(graphCopy->contains(v0) && graphCopy->contains(e1));
+        BOOST_REQUIRE_EQUAL(graphCopy->getVertexId(v2), graph->getVertexId(v2));
+        BOOST_REQUIRE_EQUAL(graphCopy->getEdgeId(e1), graph->getEdgeId(e1));
+        BOOST_REQUIRE(graphCopy->getEdge(graphCopy->getEdgeId(e0)) == e0);
+
+        // Modifications only affect the modified graph
+        graphCopy->removeEdge(e0);
+        BOOST_REQUIRE(!graphCopy->contains(e0));
+        BOOST_REQUIRE(graph->contains(e0));
+
+        graph->removeEdge(e1);
+        BOOST_REQUIRE(!graph->contains(e1));
+        BOOST_REQUIRE(graphCopy->contains(e1));
+        BOOST_REQUIRE(graphCopy->getEdge(graphCopy->getEdgeId(e1)) == e1);
+
+        graph->addVertex(v3);
+        BOOST_REQUIRE(!graphCopy->contains(v3));
+
+        // Copy of a copy
+        BaseGraph::Ptr secondCopy = graphCopy->copy();
+        graphCopy->addEdge(e2);
+        BOOST_REQUIRE(graphCopy->contains(e2));
+        BOOST_REQUIRE(!secondCopy->contains(e2));
+        BOOST_REQUIRE(!secondCopy->contains(e0));
+
+        graphCopy.reset();
+        graph.reset();
+        BOOST_REQUIRE(secondCopy->contains(e1));
+        BOOST_REQUIRE_EQUAL(secondCopy->getAllVertices().size(), 3);
+        std::vector<Edge::Ptr> edges = secondCopy->getAllEdges();
+        BOOST_REQUIRE_EQUAL(edges.size(), 1);
+        BOOST_REQUIRE(edges[0] == e1);
+        secondCopy->removeEdge(e1);
+        BOOST_REQUIRE(!secondCopy->contains(e1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(copy_constructor)
+{
+    boost_graph::DirectedGraph graph;
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Edge::Ptr e0(new Edge(v0, v1));
+    graph.addEdge(e0);
+
+    boost_graph::DirectedGraph graphCopy(graph);
+    BOOST_REQUIRE(graphCopy.contains(v0) && graphCopy.contains(v1) && graphCopy.contains(e0));
+    BOOST_REQUIRE_EQUAL(graphCopy.getEdgeId(e0), graph.getEdgeId(e0));
+
+    graphCopy.removeEdge(e0);
+    BOOST_REQUIRE(!graphCopy.contains(e0));
+    BOOST_REQUIRE(graph.contains(e0));
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_epochs)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        uint64_t version = graph->version();
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+        graph->addEdge(Edge::Ptr(new Edge(v0, v1)));
+        graph->addEdge(Edge::Ptr(new Edge(v2, v1)));
+        graph->addEdge(Edge::Ptr(new Edge(v0, v2)));
+        BOOST_REQUIRE_MESSAGE(graph->version() > version, "Version has not been incremented");
+
+        VersionedGraph versioned(graph);
+        GraphSnapshot::ConstPtr snapshot = versioned.acquire();
+        BOOST_REQUIRE_MESSAGE(snapshot->getVersion() == graph->version(), "Snapshot does not have the current version");
+        BOOST_REQUIRE_MESSAGE(versioned.publish() == snapshot, "Unmodified graph should not create a new epoch");
+        BOOST_REQUIRE_EQUAL(snapshot->getNumberOfVertices(), 3);
+        BOOST_REQUIRE_EQUAL(snapshot->getNumberOfEdges(), 3);
+
+        size_t index0 = snapshot->getVertexIndex(graph->getVertexId(v0));
+        size_t index1 = snapshot->getVertexIndex(graph->getVertexId(v1));
+        BOOST_REQUIRE(snapshot->getVertex(index0) == v0);
+        BOOST_REQUIRE_EQUAL(snapshot->getOutDegree(index0), 2);
+        BOOST_REQUIRE_EQUAL(snapshot->getInDegree(index1), 2);
+        GraphSnapshot::Range out = snapshot->getOutEdges(index0);
+        for(size_t e = out.first; e < out.second; ++e)
+        {
+            BOOST_REQUIRE(snapshot->getEdge(e)->getSourceVertex() == v0);
+            BOOST_REQUIRE(snapshot->getVertex( snapshot->getTargetIndex(e) ) == snapshot->getEdge(e)->getTargetVertex());
+        }
+        GraphSnapshot::IndexRange in = snapshot->getInEdges(index1);
+        for(; in.first != in.second; ++in.first)
+        {
+            BOOST_REQUIRE(snapshot->getEdge(*in.first)->getTargetVertex() == v1);
+        }
+
+        // Readers always see a consistent epoch, i.e. the initial graph or a
+        // chain of n edges with n + 1 vertices
+        bool consistent = true;
+        std::atomic<bool> done(false);
+        std::thread reader([&versioned, &snapshot, &consistent, &done]()
+            {
+                uint64_t lastVersion = 0;
+                while(!done)
+                {
+                    GraphSnapshot::ConstPtr current = versioned.acquire();
+                    consistent &= current->getVersion() >= lastVersion;
+                    consistent &= current == snapshot || current->getNumberOfVertices() == current->getNumberOfEdges() + 1 || current->getNumberOfVertices() == 0;
+                    lastVersion = current->getVersion();
+                }
+            });
+
+        for(size_t e = 0; e < snapshot->getNumberOfEdges(); ++e)
+        {
+            graph->removeEdge(snapshot->getEdge(e));
+        }
+        for(size_t v = 0; v < snapshot->getNumberOfVertices(); ++v)
+        {
+            graph->removeVertex(snapshot->getVertex(v));
+        }
+        versioned.publish();
+        Vertex::Ptr last(new Vertex("0"));
+        for(int e = 0; e < 200; ++e)
+        {
+            Vertex::Ptr next(new Vertex());
+            graph->addEdge(Edge::Ptr(new Edge(last, next)));
+            last = next;
+            versioned.publish();
+        }
+        done = true;
+        reader.join();
+
+        BOOST_REQUIRE_MESSAGE(consistent, "Reader has seen an inconsistent epoch");
+        BOOST_REQUIRE_EQUAL(versioned.acquire()->getNumberOfEdges(), 200);
+        BOOST_REQUIRE_MESSAGE(snapshot->getNumberOfEdges() == 3, "Pinned snapshot has been modified");
+    }
+}
+
 BOOST_AUTO_TEST_CASE(iterator_over_edges_and_vertices)
 {
     using namespace graph_analysis;
@@ -189,6 +463,271 @@ BOOST_AUTO_TEST_CASE(iterator_over_edges_and_vertices)
     }
 }
 
+BOOST_AUTO_TEST_CASE(handles)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+        Edge::Ptr e0(new Edge(v0, v1));
+        Edge::Ptr e1(new Edge(v0, v2));
+        Edge::Ptr e2(new Edge(v1, v2));
+        graph->addEdge(e0);
+        graph->addEdge(e1);
+        graph->addEdge(e2);
+
+        VertexHandle h0 = graph->getVertexHandle(v0);
+        VertexHandle h2 = graph->getVertexHandle(v2);
+        BOOST_REQUIRE(graph->getVertex(h0.id) == v0);
+
+        EdgeHandle edge = graph->getEdgeHandle(e2);
+        BOOST_REQUIRE(graph->source(edge) == graph->getVertexHandle(v1));
+        BOOST_REQUIRE(graph->target(edge) == h2);
+
+        long useCount = v1.use_count();
+        std::set<VertexHandle> targets;
+        graph->forEachOutEdge(h0, [&graph, &targets](EdgeHandle e)
+            {
+                targets.insert(graph->target(e));
+            });
+        BOOST_REQUIRE_EQUAL(targets.size(), 2);
+        BOOST_REQUIRE(targets.count(graph->getVertexHandle(v1)) && targets.count(h2));
+        BOOST_REQUIRE_EQUAL(v1.use_count(), useCount);
+
+        std::vector<EdgeHandle> inEdges;
+        graph->forEachInEdge(h2, [&inEdges](EdgeHandle e) { inEdges.push_back(e); });
+        BOOST_REQUIRE_EQUAL(inEdges.size(), 2);
+        for(size_t e = 0; e < inEdges.size(); ++e)
+        {
+            BOOST_REQUIRE(graph->target(inEdges[e]) == h2);
+            BOOST_REQUIRE(graph->getEdge(inEdges[e].id)->getTargetVertex() == v2);
+        }
+    }
+}
+
+namespace {
+
+/// Count vertices, out edges and in edges with the traits of the graph
+struct DegreeCounter
+{
+    size_t vertices;
+    size_t outEdges;
+    size_t inEdges;
+    size_t loops;
+
+    template<typename Backend>
+    void operator()(const Backend& graph)
+    {
+        forEachVertex(graph, [this, &graph](VertexHandle vertex)
+            {
+                ++vertices;
+                visitOutEdges(graph, vertex, [this, &graph, vertex](EdgeHandle edge)
+                    {
+                        ++outEdges;
+                        if(GraphTraits<Backend>::target(graph, edge) == vertex)
+                        {
+                            ++loops;
+                        }
+                    });
+                visitInEdges(graph, vertex, [this](EdgeHandle) { ++inEdges; });
+            });
+    }
+};
+
+} // end anonymous namespace
+
+BOOST_AUTO_TEST_CASE(graph_traits)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+        graph->addEdge(Edge::Ptr(new Edge(v0, v1)));
+        graph->addEdge(Edge::Ptr(new Edge(v1, v2)));
+        graph->addEdge(Edge::Ptr(new Edge(v2, v0)));
+        graph->addEdge(Edge::Ptr(new Edge(v2, v2)));
+
+        DegreeCounter counter = { 0, 0, 0, 0 };
+        dispatch(*graph, counter);
+        BOOST_REQUIRE_EQUAL(counter.vertices, 3);
+        BOOST_REQUIRE_EQUAL(counter.outEdges, 4);
+        BOOST_REQUIRE_EQUAL(counter.inEdges, 4);
+        BOOST_REQUIRE_EQUAL(counter.loops, 1);
+
+        // Generic traits use the handle based interface of BaseGraph
+        DegreeCounter genericCounter = { 0, 0, 0, 0 };
+        genericCounter(*graph);
+        BOOST_REQUIRE_EQUAL(genericCounter.vertices, 3);
+        BOOST_REQUIRE_EQUAL(genericCounter.outEdges, 4);
+        BOOST_REQUIRE_EQUAL(genericCounter.loops, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(type_buckets)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr h0(new HyperEdge("h0"));
+        Edge::Ptr e0(new Edge(v0, v1));
+        Edge::Ptr w0(new WeightedEdge(v1, v0, 1.0));
+        Edge::Ptr w1(new WeightedEdge(v0, v1, 2.0));
+        Edge::Ptr w2(new WeightedEdge(v1, h0, 3.0));
+        graph->addEdge(e0);
+        graph->addEdge(w0);
+        graph->addEdge(w1);
+        graph->addEdge(w2);
+
+        BOOST_REQUIRE_EQUAL(graph->getVertices<Vertex>().size(), 3);
+        BOOST_REQUIRE_EQUAL(graph->getVertices<HyperEdge>().size(), 1);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<Edge>().size(), 4);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<WeightedEdge>().size(), 3);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<WeightedEdge>(v0, v1).size(), 1);
+        BOOST_REQUIRE(graph->getEdges<WeightedEdge>(v0, v1).front() == w1);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<Edge>(v0, v1).size(), 2);
+
+        BaseGraph::Ptr graphCopy = graph->copy();
+        BOOST_REQUIRE_EQUAL(graphCopy->getEdges<WeightedEdge>().size(), 3);
+
+        // Removing a vertex removes its edges from the index
+        graph->removeVertex(h0);
+        BOOST_REQUIRE_EQUAL(graph->getVertices<HyperEdge>().size(), 0);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<WeightedEdge>().size(), 2);
+        graph->removeEdge(w1);
+        std::vector<WeightedEdge::Ptr> weightedEdges = graph->getEdges<WeightedEdge>();
+        BOOST_REQUIRE_EQUAL(weightedEdges.size(), 1);
+        BOOST_REQUIRE(weightedEdges.front() == w0);
+        BOOST_REQUIRE(graph->getEdges<WeightedEdge>(v0, v1).empty());
+
+        BOOST_REQUIRE_EQUAL(graphCopy->getVertices<HyperEdge>().size(), 1);
+        BOOST_REQUIRE_EQUAL(graphCopy->getEdges<WeightedEdge>().size(), 3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(adjacency_index)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+        Edge::Ptr e0(new Edge(v0, v1));
+        Edge::Ptr e1(new WeightedEdge(v0, v1, 1.0));
+        Edge::Ptr e2(new Edge(v1, v0));
+        graph->addEdge(e0);
+        graph->addEdge(e1);
+        graph->addEdge(e2);
+
+        // The index is built from the existing edges
+        graph->setAdjacencyIndexEnabled(true);
+        BOOST_REQUIRE(graph->isAdjacencyIndexEnabled());
+
+        Edge::Ptr e3(new Edge(v1, v2));
+        graph->addEdge(e3);
+        BOOST_REQUIRE(graph->hasEdge(v0, v1));
+        BOOST_REQUIRE(graph->hasEdge(v1, v2));
+        BOOST_REQUIRE(!graph->hasEdge(v2, v1));
+        BOOST_REQUIRE_EQUAL(graph->getEdges(v0, v1).size(), 2);
+        BOOST_REQUIRE_EQUAL(graph->getEdges<WeightedEdge>(v0, v1).size(), 1);
+
+        BaseGraph::Ptr graphCopy = graph->copy();
+        BOOST_REQUIRE(graphCopy->isAdjacencyIndexEnabled());
+        BOOST_REQUIRE_EQUAL(graphCopy->getEdges(v0, v1).size(), 2);
+
+        // Removing a vertex removes its edges from the index, even if the
+        // id of the vertex is reused
+        graph->removeVertex(v2);
+        graph->addVertex(v2);
+        BOOST_REQUIRE(!graph->hasEdge(v1, v2));
+
+        BOOST_REQUIRE_EQUAL(graph->removeEdges(v0, v1), 3);
+        BOOST_REQUIRE(!graph->hasEdge(v0, v1));
+        BOOST_REQUIRE(graph->getEdges(v1, v0).empty());
+        BOOST_REQUIRE(graphCopy->hasEdge(v1, v2));
+
+        // Lookup without the index
+        graph->setAdjacencyIndexEnabled(false);
+        Edge::Ptr e4(new Edge(v1, v0));
+        graph->addEdge(e4);
+        BOOST_REQUIRE(graph->hasEdge(v1, v0));
+        BOOST_REQUIRE(!graph->hasEdge(v0, v1));
+
+        // Loops are removed once, with and without the index
+        for(int indexed = 0; indexed < 2; ++indexed)
+        {
+            graph->setAdjacencyIndexEnabled(indexed);
+            Edge::Ptr loop(new Edge(v2, v2));
+            graph->addEdge(loop);
+            BOOST_REQUIRE(graph->hasEdge(v2, v2));
+            BOOST_REQUIRE_EQUAL(graph->removeEdges(v2, v2), 1);
+            BOOST_REQUIRE(!graph->hasEdge(v2, v2));
+        }
+
+        // Sorted adjacency of a snapshot
+        GraphSnapshot::ConstPtr snapshot = GraphSnapshot::create(*graphCopy);
+        size_t s0 = snapshot->getVertexIndex(graphCopy->getVertexId(v0));
+        size_t s1 = snapshot->getVertexIndex(graphCopy->getVertexId(v1));
+        size_t s2 = snapshot->getVertexIndex(graphCopy->getVertexId(v2));
+        GraphSnapshot::Range range = snapshot->getEdges(s0, s1);
+        BOOST_REQUIRE_EQUAL(range.second - range.first, 2);
+        BOOST_REQUIRE(snapshot->hasEdge(s1, s2));
+        BOOST_REQUIRE(!snapshot->hasEdge(s2, s1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_vertices_by_label)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("label-a"));
+        Vertex::Ptr v1(new Vertex("label-b"));
+        Vertex::Ptr v2(new Vertex("label-a"));
+        BOOST_REQUIRE_EQUAL(v0->getLabelSymbol(), v2->getLabelSymbol());
+        BOOST_REQUIRE_EQUAL(v0->getLabel(), "label-a");
+        graph->addVertex(v0);
+        graph->addVertex(v1);
+        graph->addVertex(v2);
+
+        BOOST_REQUIRE_EQUAL(graph->findVerticesByLabel("label-a").size(), 2);
+        BOOST_REQUIRE_EQUAL(graph->findVerticesByLabel("label-b").size(), 1);
+        BOOST_REQUIRE(graph->findVerticesByLabel("label-unknown").empty());
+
+        BaseGraph::Ptr graphCopy = graph->copy();
+        BOOST_REQUIRE_EQUAL(graphCopy->findVerticesByLabel("label-a").size(), 2);
+
+        graph->removeVertex(v2);
+        BOOST_REQUIRE_EQUAL(graph->findVerticesByLabel("label-a").size(), 1);
+        BOOST_REQUIRE(graph->findVerticesByLabel("label-a").front() == v0);
+
+        // Relabeling is picked up by all graphs
+        v1->setLabel("label-a");
+        BOOST_REQUIRE_EQUAL(graph->findVerticesByLabel("label-a").size(), 2);
+        BOOST_REQUIRE(graph->findVerticesByLabel("label-b").empty());
+        BOOST_REQUIRE_EQUAL(graphCopy->findVerticesByLabel("label-a").size(), 3);
+
+        BOOST_REQUIRE_EQUAL(v0->getClassSymbol(), v1->getClassSymbol());
+        BOOST_REQUIRE_EQUAL(SymbolTable::resolve(v0->getClassSymbol()), v0->getClassName());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(subgraph)
 {
     for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
@@ -301,6 +840,59 @@ BOOST_AUTO_TEST_CASE(subgraph)
     }
 }
 
+BOOST_AUTO_TEST_CASE(parallel_filters)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        // Large enough to be filtered in multiple chunks
+        size_t numberOfVertices = 5000;
+        std::vector<Vertex::Ptr> vertices;
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            std::stringstream ss;
+            ss << "v" << v;
+            vertices.push_back(Vertex::Ptr(new Vertex(ss.str())));
+        }
+        std::vector<Edge::Ptr> edges;
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            edges.push_back(Edge::Ptr(new Edge(vertices[v], vertices[(v + 1) % numberOfVertices])));
+        }
+        graph->addVertices(vertices);
+        graph->addEdges(edges);
+
+        SubGraph::Ptr subgraph = BaseGraph::getSubGraph(graph);
+        BOOST_REQUIRE(!subgraph->isParallelFiltersEnabled());
+        subgraph->setParallelFiltersEnabled(true);
+        Filter< Vertex::Ptr >::Ptr vertexFilter(new filters::VertexRegexFilter("v.*7"));
+        Filter< Edge::Ptr >::Ptr edgeFilter(new filters::CombinedEdgeRegexFilter(filters::VertexRegexFilter("v.*3"),
+                    filters::EdgeRegexFilter(".*"),
+                    filters::VertexRegexFilter("v.*4")));
+        subgraph->applyFilters(vertexFilter, edgeFilter);
+
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            BOOST_REQUIRE_EQUAL(subgraph->enabled(vertices[v]), v % 10 != 7);
+            // Disabling a vertex might disable its edges as well
+            if(v % 10 != 6 && v % 10 != 7)
+            {
+                BOOST_REQUIRE_EQUAL(subgraph->enabled(edges[v]), v % 10 != 3);
+            }
+        }
+
+        subgraph->enableAllVertices();
+        subgraph->enableAllEdges();
+        for(size_t v = 0; v < numberOfVertices; ++v)
+        {
+            BOOST_REQUIRE(subgraph->enabled(vertices[v]));
+            BOOST_REQUIRE(subgraph->enabled(edges[v]));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(get_edges)
 {
     for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
 #include <graph_analysis/Vertex.hpp>
 #include <graph_analysis/lemon/Graph.hpp>
 #include <graph_analysis/io/GraphvizWriter.hpp>
@@ -9,6 +10,14 @@
 
 #include <graph_analysis/io/GVGraph.hpp>
 #include <graph_analysis/io/GraphvizGridStyle.hpp>
+#include <graph_analysis/io/BinaryGraphView.hpp>
+#include <graph_analysis/io/EdgeListReader.hpp>
+#include <graph_analysis/io/JournalObserver.hpp>
+#include <graph_analysis/io/AttributeCodec.hpp>
+#include <graph_analysis/algorithms/MultiCommodityEdge.hpp>
+#include <graph_analysis/algorithms/MultiCommodityVertex.hpp>
+#include <graph_analysis/filters/RegexFilters.hpp>
+#include <fstream>
 #include "test_utils.hpp"
 
 using namespace graph_analysis;
@@ -392,6 +401,15 @@ BOOST_AUTO_TEST_CASE(gexf_viz)
     BaseGraph::Ptr read_graph = BaseGraph::getInstance();
     std::string filename = getRootDir() + "test/data/yeast.gexf";
     io::GraphIO::read(filename, read_graph, representation::GEXF);
+
+    BOOST_REQUIRE_MESSAGE(read_graph->order() == 2361, "Expected 2361 vertices, but got " << read_graph->order());
+    BOOST_REQUIRE_MESSAGE(read_graph->size() == 7182, "Expected 7182 edges, but got " << read_graph->size());
+
+    VertexIterator::Ptr vertexIt = read_graph->getVertexIterator();
+    while(vertexIt->next())
+    {
+        BOOST_REQUIRE_MESSAGE(!vertexIt->current()->getLabel().empty(), "Vertex label should not be empty");
+    }
 }
 
 BOOST_AUTO_TEST_CASE(graphviz_css)
@@ -485,4 +503,641 @@ BOOST_AUTO_TEST_CASE(nweight_serialization)
 }
 
 
+BOOST_AUTO_TEST_CASE(binary)
+{
+    Vertex::Ptr empty( new DerivedVertex("empty"));
+    VertexTypeManager *vManager = VertexTypeManager::getInstance();
+    vManager->registerType(empty);
+    vManager->registerAttribute(empty->getClassName(), "m0",
+            (io::AttributeSerializationCallbacks::serialize_func_t)&DerivedVertex::serializeMember0,
+            (io::AttributeSerializationCallbacks::deserialize_func_t)&DerivedVertex::deserializeMember0,
+            (io::AttributeSerializationCallbacks::print_func_t)&DerivedVertex::serializeMember0);
+
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        DerivedVertex* derivedVertex = new DerivedVertex("v0");
+        derivedVertex->mMember0 = "v0-m0\nwith \"special\" <characters>";
+        Vertex::Ptr v0(derivedVertex);
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex("v2"));
+
+        graph->addEdge(Edge::Ptr(new Edge(v0, v1, "e0")));
+        graph->addEdge(Edge::Ptr(new Edge(v1, v2, "e1")));
+        graph->addEdge(Edge::Ptr(new Edge(v0, v2, "e2")));
+
+        std::string filename = "/tmp/test-io-" + graph->getImplementationTypeName() + ".gbin";
+        io::GraphIO::write(filename, graph, representation::BINARY);
+
+        {
+            io::BinaryGraphView view(filename);
+            BOOST_REQUIRE_MESSAGE(view.getNumberOfVertices() == 3, "Expected 3 vertices, but got " << view.getNumberOfVertices());
+            BOOST_REQUIRE_MESSAGE(view.getNumberOfEdges() == 3, "Expected 3 edges, but got " << view.getNumberOfEdges());
+
+            for(size_t v = 0; v < view.getNumberOfVertices(); ++v)
+            {
+                BOOST_REQUIRE_MESSAGE(graph->getVertex(view.getVertexId(v))->getLabel() == view.getVertexLabel(v), "Vertex id does not refer to the original vertex");
+                std::pair<size_t, size_t> outEdges = view.getOutEdges(v);
+                for(size_t e = outEdges.first; e < outEdges.second; ++e)
+                {
+                    BOOST_REQUIRE_MESSAGE(view.getSourceIndex(e) == v, "Out edge of vertex " << v << " has wrong source");
+                }
+                if(view.getVertexLabel(v) == "v0")
+                {
+                    BOOST_REQUIRE_MESSAGE(view.getVertexClassName(v) == "DerivedVertex", "Expected class DerivedVertex, but got " << view.getVertexClassName(v));
+                    BOOST_REQUIRE_MESSAGE(outEdges.second - outEdges.first == 2, "Expected two out edges for v0");
+                    DerivedVertex* vertex = dynamic_cast<DerivedVertex*>(view.getVertex(v).get());
+                    BOOST_REQUIRE_MESSAGE(vertex, "Vertex should be of type DerivedVertex");
+                    BOOST_REQUIRE_MESSAGE(vertex->mMember0 == derivedVertex->mMember0, "Member0 was imported wrongly");
+                }
+            }
+        }
+
+        BaseGraph::Ptr read_graph = BaseGraph::getInstance(graph->getImplementationType());
+        io::GraphIO::read(filename, read_graph);
+        BOOST_REQUIRE_MESSAGE(read_graph->order() == 3, "Read graph has wrong order: " << read_graph->order());
+        BOOST_REQUIRE_MESSAGE(read_graph->size() == 3, "Read graph has wrong size: " << read_graph->size());
+
+        std::vector< shared_ptr<DerivedVertex> > vertices = read_graph->getVertices<DerivedVertex>();
+        BOOST_REQUIRE_MESSAGE(vertices.size() == 1, "Expected one vertex of type DerivedVertex");
+        BOOST_REQUIRE_MESSAGE(vertices[0]->mMember0 == derivedVertex->mMember0, "Member0 was imported wrongly");
+        BOOST_REQUIRE_MESSAGE(read_graph->getOutEdges(vertices[0]).size() == 2, "Expected two out edges for v0");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(yaml)
+{
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        Vertex::Ptr v0(new Vertex("v0 with spaces"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v2(new Vertex(""));
+
+        graph->addEdge(Edge::Ptr(new Edge(v0, v1, "e0")));
+        graph->addEdge(Edge::Ptr(new Edge(v1, v2, "e1: with colon")));
+        graph->addEdge(Edge::Ptr(new Edge(v0, v2, "e2")));
+
+        std::string filename = "/tmp/test-io-" + graph->getImplementationTypeName() + ".yaml";
+        io::GraphIO::write(filename, graph, representation::YAML);
+
+        BaseGraph::Ptr read_graph = BaseGraph::getInstance(graph->getImplementationType());
+        io::GraphIO::read(filename, read_graph);
+        BOOST_REQUIRE_MESSAGE(read_graph->order() == 3, "Read graph has wrong order: " << read_graph->order());
+        BOOST_REQUIRE_MESSAGE(read_graph->size() == 3, "Read graph has wrong size: " << read_graph->size());
+
+        std::set<std::string> labels;
+        EdgeIterator::Ptr edgeIt = read_graph->getEdgeIterator();
+        while(edgeIt->next())
+        {
+            Edge::Ptr edge = edgeIt->current();
+            labels.insert(edge->getSourceVertex()->getLabel() + "->" + edge->getTargetVertex()->getLabel() + ":" + edge->getLabel());
+        }
+        BOOST_REQUIRE_MESSAGE(labels.count("v0 with spaces->v1:e0"), "Edge e0 was imported wrongly");
+        BOOST_REQUIRE_MESSAGE(labels.count("v1->:e1: with colon"), "Edge e1 was imported wrongly");
+        BOOST_REQUIRE_MESSAGE(labels.count("v0 with spaces->:e2"), "Edge e2 was imported wrongly");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(edge_list)
+{
+    std::string filename = "/tmp/test-io.edges";
+    {
+        std::ofstream file(filename.c_str());
+        file << "# source target weight\n";
+        file << "0 1\n";
+        file << "1 2 0.5\r\n";
+        file << "\n";
+        file << "  5\t7 2.5\n";
+    }
+
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        io::GraphIO::read(filename, graph);
+        BOOST_REQUIRE_MESSAGE(graph->order() == 8, "Expected one vertex per id, but got " << graph->order());
+        BOOST_REQUIRE_MESSAGE(graph->size() == 3, "Expected 3 edges, but got " << graph->size());
+
+        io::EdgeListReader reader(4);
+        reader.setCompactVertexIds(true);
+        graph = BaseGraph::getInstance(graph->getImplementationType());
+        reader.read(filename, graph);
+        BOOST_REQUIRE_MESSAGE(graph->order() == 5, "Expected 5 vertices after compaction, but got " << graph->order());
+        BOOST_REQUIRE_MESSAGE(graph->size() == 3, "Expected 3 edges, but got " << graph->size());
+
+        size_t weighted = 0;
+        EdgeIterator::Ptr edgeIt = graph->getEdgeIterator();
+        while(edgeIt->next())
+        {
+            WeightedEdge::Ptr edge = dynamic_pointer_cast<WeightedEdge>(edgeIt->current());
+            if(edge)
+            {
+                ++weighted;
+                if(edge->getSourceVertex()->getLabel() == "5")
+                {
+                    BOOST_REQUIRE_MESSAGE(edge->getTargetVertex()->getLabel() == "7", "Edge 5->7 was imported wrongly");
+                    BOOST_REQUIRE_MESSAGE(edge->getWeight() == 2.5, "Expected weight 2.5, but got " << edge->getWeight());
+                }
+            }
+        }
+        BOOST_REQUIRE_MESSAGE(weighted == 2, "Expected 2 weighted edges, but got " << weighted);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(edge_list_large_ids)
+{
+    std::string filename = "/tmp/test-io-sparse.edges";
+    {
+        std::ofstream file(filename.c_str());
+        file << "0 4000000000\n";
+    }
+
+    std::string overflowFilename = "/tmp/test-io-overflow.edges";
+    {
+        std::ofstream file(overflowFilename.c_str());
+        file << "0 1\n";
+        file << "0 18446744073709551617\n";
+    }
+
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        // A sparse id range falls back to compacted vertex ids
+        io::EdgeListReader reader;
+        reader.read(filename, graph);
+        BOOST_REQUIRE_MESSAGE(graph->order() == 2, "Expected 2 vertices for a sparse id range, but got " << graph->order());
+        BOOST_REQUIRE_MESSAGE(graph->size() == 1, "Expected 1 edge, but got " << graph->size());
+
+        graph = BaseGraph::getInstance(graph->getImplementationType());
+        BOOST_REQUIRE_THROW(reader.read(overflowFilename, graph), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(matrix_market)
+{
+    std::string filename = "/tmp/test-io.mtx";
+    {
+        std::ofstream file(filename.c_str());
+        file << "%%MatrixMarket matrix coordinate real symmetric\n";
+        file << "% comment\n";
+        file << "4 4 3\n";
+        file << "1 2 0.5\n";
+        file << "3 3 1\n";
+        file << "4 1 2\n";
+    }
+
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    io::GraphIO::read(filename, graph);
+    BOOST_REQUIRE_MESSAGE(graph->order() == 4, "Expected 4 vertices, but got " << graph->order());
+    BOOST_REQUIRE_MESSAGE(graph->size() == 5, "Expected 5 edges for symmetric matrix, but got " << graph->size());
+
+    {
+        std::ofstream file(filename.c_str());
+        file << "%%MatrixMarket matrix coordinate pattern general\n";
+        file << "2 2 1\n";
+        file << "1 3\n";
+    }
+    BOOST_REQUIRE_THROW(io::GraphIO::read(filename, BaseGraph::getInstance()), std::runtime_error);
+
+    // The size line must not be trusted for allocations
+    {
+        std::ofstream file(filename.c_str());
+        file << "%%MatrixMarket matrix coordinate pattern general\n";
+        file << "1000000000000 1000000000000 1000000000000\n";
+        file << "1 2\n";
+    }
+    BOOST_REQUIRE_THROW(io::GraphIO::read(filename, BaseGraph::getInstance()), std::runtime_error);
+
+    {
+        std::ofstream file(filename.c_str());
+        file << "%%MatrixMarket matrix coordinate pattern general\n";
+        file << "18446744073709551615 1 1\n";
+        file << "1 1\n";
+    }
+    BOOST_REQUIRE_THROW(io::GraphIO::read(filename, BaseGraph::getInstance()), std::runtime_error);
+
+    {
+        std::ofstream file(filename.c_str());
+        file << "%%MatrixMarket matrix coordinate pattern general\n";
+        file << "1000000000000 1000000000000 1\n";
+        file << "1 2\n";
+    }
+    graph = BaseGraph::getInstance();
+    io::GraphIO::read(filename, graph);
+    BOOST_REQUIRE_MESSAGE(graph->order() == 2, "Expected 2 vertices for a sparse matrix, but got " << graph->order());
+    BOOST_REQUIRE_MESSAGE(graph->size() == 1, "Expected 1 edge, but got " << graph->size());
+}
+
+BOOST_AUTO_TEST_CASE(lemon_lgf)
+{
+    EdgeTypeManager::getInstance()->registerType(Edge::Ptr(new WeightedEdge()));
+
+    lemon::DirectedGraph::Ptr lemonGraph(new lemon::DirectedGraph());
+
+    Vertex::Ptr v0(new Vertex("v0 with spaces"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Vertex::Ptr v2(new Vertex(""));
+
+    lemonGraph->addEdge(Edge::Ptr(new Edge(v0, v1, "e0")));
+    lemonGraph->addEdge(Edge::Ptr(new Edge(v1, v2, "e1 \"quoted\"")));
+    lemonGraph->addEdge(Edge::Ptr(new WeightedEdge(v0, v2, 1.0)));
+
+    std::string filename = "/tmp/test-io.lemon";
+    {
+        std::ofstream file(filename.c_str());
+        lemonGraph->write(file);
+    }
+
+    for(int i = BaseGraph::BOOST_DIRECTED_GRAPH; i < BaseGraph::IMPLEMENTATION_TYPE_END; ++i)
+    {
+        BaseGraph::Ptr graph = BaseGraph::getInstance(static_cast<BaseGraph::ImplementationType>(i));
+        BOOST_TEST_MESSAGE("BaseGraph implementation: " << graph->getImplementationTypeName());
+
+        io::GraphIO::read(filename, graph);
+        BOOST_REQUIRE_MESSAGE(graph->order() == 3, "Read graph has wrong order: " << graph->order());
+        BOOST_REQUIRE_MESSAGE(graph->size() == 3, "Read graph has wrong size: " << graph->size());
+
+        std::set<std::string> labels;
+        EdgeIterator::Ptr edgeIt = graph->getEdgeIterator();
+        while(edgeIt->next())
+        {
+            Edge::Ptr edge = edgeIt->current();
+            labels.insert(edge->getSourceVertex()->getLabel() + "->" + edge->getTargetVertex()->getLabel() + ":" + edge->getLabel() + ":" + edge->getClassName());
+        }
+        BOOST_REQUIRE_MESSAGE(labels.count("v0 with spaces->v1:e0:graph_analysis::Edge"), "Edge e0 was imported wrongly");
+        BOOST_REQUIRE_MESSAGE(labels.count("v1->:e1 \"quoted\":graph_analysis::Edge"), "Edge e1 was imported wrongly");
+        BOOST_REQUIRE_MESSAGE(labels.count("v0 with spaces->::" + WeightedEdge().getClassName()), "Weighted edge was imported wrongly");
+
+        if(graph->getImplementationType() == BaseGraph::LEMON_DIRECTED_GRAPH)
+        {
+            BOOST_REQUIRE_MESSAGE(graph->getVertex(lemonGraph->getVertexId(v0))->getLabel() == v0->getLabel(), "Vertex ids have not been restored");
+        }
+    }
+
+    // Files without class maps, as written by earlier versions, use the
+    // default types
+    std::string legacyFilename = "/tmp/test-io-legacy.lemon";
+    {
+        std::ofstream file(legacyFilename.c_str());
+        file << "@nodes\n";
+        file << "label\tvertices\tvertexId\n";
+        file << "0\t\"v0\"\t0\n";
+        file << "1\t\"v1\"\t1\n";
+        file << "@arcs\n";
+        file << "\t\tlabel\tedges\tedgeId\n";
+        file << "0\t1\t0\t\"e0\"\t0\n";
+        file << "@attributes\n";
+        file << "caption\t\"test\"\n";
+    }
+    BaseGraph::Ptr legacyGraph = BaseGraph::getInstance();
+    io::GraphIO::read(legacyFilename, legacyGraph);
+    BOOST_REQUIRE_MESSAGE(legacyGraph->order() == 2, "Read graph has wrong order: " << legacyGraph->order());
+    BOOST_REQUIRE_MESSAGE(legacyGraph->size() == 1, "Read graph has wrong size: " << legacyGraph->size());
+    Edge::Ptr legacyEdge = legacyGraph->getAllEdges().at(0);
+    BOOST_REQUIRE_EQUAL(legacyEdge->getLabel(), "e0");
+    BOOST_REQUIRE_EQUAL(legacyEdge->getSourceVertex()->getLabel(), "v0");
+    BOOST_REQUIRE_EQUAL(legacyEdge->getClassName(), EdgeTypeManager::getInstance()->getDefaultType());
+}
+
+BOOST_AUTO_TEST_CASE(compression)
+{
+    std::vector<std::string> filenames;
+    filenames.push_back("/tmp/test-io-compressed.gexf.gz");
+#if BOOST_VERSION >= 106700
+    filenames.push_back("/tmp/test-io-compressed.yaml.zst");
+#endif
+    filenames.push_back("/tmp/test-io-compressed.gbin.gz");
+
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Vertex::Ptr v2(new Vertex("v2"));
+    graph->addEdge(Edge::Ptr(new Edge(v0, v1, "e0")));
+    graph->addEdge(Edge::Ptr(new Edge(v1, v2, "e1")));
+
+    for(size_t i = 0; i < filenames.size(); ++i)
+    {
+        const std::string& filename = filenames[i];
+        BOOST_TEST_MESSAGE("Compressed file: " << filename);
+        BOOST_REQUIRE_MESSAGE(io::GraphIO::getCompressionFromFilename(filename) != representation::NO_COMPRESSION, "Compression of '" << filename << "' not detected");
+
+        io::GraphIO::write(filename, graph);
+
+        BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+        io::GraphIO::read(filename, read_graph);
+        BOOST_REQUIRE_MESSAGE(read_graph->order() == 3, "Read graph has wrong order: " << read_graph->order());
+        BOOST_REQUIRE_MESSAGE(read_graph->size() == 2, "Read graph has wrong size: " << read_graph->size());
+    }
+
+    // Stream interface without compression
+    std::stringstream ss;
+    io::GraphIO::write(ss, *graph, representation::YAML);
+    BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+    io::GraphIO::read(ss, read_graph, representation::YAML);
+    BOOST_REQUIRE_MESSAGE(read_graph->size() == 2, "Graph read from stream has wrong size: " << read_graph->size());
+}
+
+BOOST_AUTO_TEST_CASE(journal)
+{
+    EdgeTypeManager::getInstance()->registerType(Edge::Ptr(new WeightedEdge()));
+    std::string filename = "/tmp/test-io.journal";
+
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    graph->addEdge(Edge::Ptr(new Edge(v0, v1, "e0")));
+
+    io::JournalObserver::Ptr journal(new io::JournalObserver(graph, filename));
+    graph->addObserver(journal);
+
+    // Snapshot only
+    BaseGraph::Ptr replayed = BaseGraph::getInstance();
+    io::GraphIO::replay(filename, replayed);
+    BOOST_REQUIRE_MESSAGE(replayed->order() == 2 && replayed->size() == 1, "Snapshot was replayed wrongly");
+
+    // Group committed records
+    std::vector<Vertex::Ptr> vertices;
+    vertices.push_back(Vertex::Ptr(new Vertex("v2")));
+    vertices.push_back(Vertex::Ptr(new Vertex("v3")));
+    graph->addVertices(vertices);
+    Edge::Ptr e1(new Edge(v1, vertices[0], "e1"));
+    graph->addEdge(e1);
+    graph->addEdge(Edge::Ptr(new WeightedEdge(vertices[0], vertices[1], 2.0)));
+    graph->removeEdge(e1);
+
+    replayed = BaseGraph::getInstance();
+    io::GraphIO::replay(filename, replayed);
+    BOOST_REQUIRE_MESSAGE(replayed->order() == 4, "Replayed graph has wrong order: " << replayed->order());
+    BOOST_REQUIRE_MESSAGE(replayed->size() == 2, "Replayed graph has wrong size: " << replayed->size());
+
+    std::set<std::string> labels;
+    EdgeIterator::Ptr edgeIt = replayed->getEdgeIterator();
+    while(edgeIt->next())
+    {
+        Edge::Ptr edge = edgeIt->current();
+        labels.insert(edge->getSourceVertex()->getLabel() + "->" + edge->getTargetVertex()->getLabel() + ":" + edge->getClassName());
+    }
+    BOOST_REQUIRE_MESSAGE(labels.count("v0->v1:" + Edge().getClassName()), "Edge e0 was replayed wrongly");
+    BOOST_REQUIRE_MESSAGE(labels.count("v2->v3:" + WeightedEdge().getClassName()), "Weighted edge was replayed wrongly");
+
+    // Compaction keeps the content
+    BOOST_REQUIRE_MESSAGE(journal->getNumberOfRecords() > 0, "Expected records in the journal");
+    journal->compact();
+    BOOST_REQUIRE_MESSAGE(journal->getNumberOfRecords() == 0, "Expected no records after compaction");
+    graph->addEdge(Edge::Ptr(new Edge(v1, v0, "e3")));
+
+    replayed = BaseGraph::getInstance();
+    io::GraphIO::replay(filename, replayed);
+    BOOST_REQUIRE_MESSAGE(replayed->order() == 4, "Replayed graph has wrong order after compaction: " << replayed->order());
+    BOOST_REQUIRE_MESSAGE(replayed->size() == 3, "Replayed graph has wrong size after compaction: " << replayed->size());
+}
+
+BOOST_AUTO_TEST_CASE(binary_columns)
+{
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Edge::Ptr e0(new Edge(v0, v1, "e0"));
+    graph->addEdge(e0);
+
+    graph->getVertexColumn<double>("x").set(graph->getVertexId(v1), 2.5);
+    graph->getVertexColumn<std::string>("name").set(graph->getVertexId(v0), "first vertex");
+    graph->getEdgeColumn<int64_t>("capacity").set(graph->getEdgeId(e0), -3);
+    attribute::Blob blob(3, 0xff);
+    graph->getEdgeColumn<attribute::Blob>("data").set(graph->getEdgeId(e0), blob);
+
+    std::string filename = "/tmp/test-io-columns.gbin";
+    io::GraphIO::write(filename, graph);
+
+    io::BinaryGraphView view(filename);
+    BOOST_REQUIRE_MESSAGE(view.getNumberOfColumns() == 4, "Expected 4 columns, but got " << view.getNumberOfColumns());
+
+    BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+    io::GraphIO::read(filename, read_graph);
+
+    VertexIterator::Ptr vertexIt = read_graph->getVertexIterator();
+    while(vertexIt->next())
+    {
+        Vertex::Ptr vertex = vertexIt->current();
+        GraphElementId id = read_graph->getVertexId(vertex);
+        double x = read_graph->getVertexColumn<double>("x").get(id);
+        const std::string& name = read_graph->getVertexColumn<std::string>("name").get(id);
+        if(vertex->getLabel() == "v0")
+        {
+            BOOST_REQUIRE_MESSAGE(x == 0.0 && name == "first vertex", "Columns of v0 were read wrongly");
+        } else {
+            BOOST_REQUIRE_MESSAGE(x == 2.5 && name.empty(), "Columns of v1 were read wrongly");
+        }
+    }
+
+    Edge::Ptr edge = read_graph->getAllEdges().at(0);
+    BOOST_REQUIRE_MESSAGE(read_graph->getEdgeColumn<int64_t>("capacity").get(read_graph->getEdgeId(edge)) == -3, "Int column was read wrongly");
+    BOOST_REQUIRE_MESSAGE(read_graph->getEdgeColumn<attribute::Blob>("data").get(read_graph->getEdgeId(edge)) == blob, "Blob column was read wrongly");
+}
+
+BOOST_AUTO_TEST_CASE(text_columns)
+{
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Edge::Ptr e0(new Edge(v0, v1, "e0"));
+    graph->addEdge(e0);
+
+    graph->getVertexColumn<double>("x").set(graph->getVertexId(v1), 0.1);
+    graph->getVertexColumn<std::string>("name").set(graph->getVertexId(v0), "first <vertex> & more");
+    graph->getEdgeColumn<int64_t>("capacity").set(graph->getEdgeId(e0), -3);
+    attribute::Blob blob(3, 0xff);
+    blob[1] = 0x0a;
+    graph->getEdgeColumn<attribute::Blob>("data").set(graph->getEdgeId(e0), blob);
+
+    std::vector<std::string> filenames;
+    filenames.push_back("/tmp/test-io-columns.gexf");
+    filenames.push_back("/tmp/test-io-columns.yaml");
+    for(size_t i = 0; i < filenames.size(); ++i)
+    {
+        const std::string& filename = filenames[i];
+        io::GraphIO::write(filename, graph);
+
+        BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+        io::GraphIO::read(filename, read_graph);
+        BOOST_REQUIRE_MESSAGE(read_graph->getVertexColumns().getColumns().size() == 2, "Expected 2 vertex columns in " << filename);
+        BOOST_REQUIRE_MESSAGE(read_graph->getEdgeColumns().getColumns().size() == 2, "Expected 2 edge columns in " << filename);
+
+        VertexIterator::Ptr vertexIt = read_graph->getVertexIterator();
+        while(vertexIt->next())
+        {
+            Vertex::Ptr vertex = vertexIt->current();
+            GraphElementId id = read_graph->getVertexId(vertex);
+            double x = read_graph->getVertexColumn<double>("x").get(id);
+            const std::string& name = read_graph->getVertexColumn<std::string>("name").get(id);
+            if(vertex->getLabel() == "v0")
+            {
+                BOOST_REQUIRE_MESSAGE(x == 0.0 && name == "first <vertex> & more", "Columns of v0 were read wrongly from " << filename);
+            } else {
+                BOOST_REQUIRE_MESSAGE(x == 0.1 && name.empty(), "Columns of v1 were read wrongly from " << filename);
+            }
+        }
+
+        Edge::Ptr edge = read_graph->getAllEdges().at(0);
+        BOOST_REQUIRE_MESSAGE(read_graph->getEdgeColumn<int64_t>("capacity").get(read_graph->getEdgeId(edge)) == -3, "Int column was read wrongly from " << filename);
+        BOOST_REQUIRE_MESSAGE(read_graph->getEdgeColumn<attribute::Blob>("data").get(read_graph->getEdgeId(edge)) == blob, "Blob column was read wrongly from " << filename);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(attribute_codec)
+{
+    std::vector<double> costs;
+    costs.push_back(0.5);
+    costs.push_back(-1e10);
+    std::map<std::set<uint32_t>, std::pair<uint32_t, uint32_t> > bounds;
+    std::set<uint32_t> commodities;
+    commodities.insert(3);
+    commodities.insert(300000);
+    bounds[commodities] = std::pair<uint32_t, uint32_t>(1, std::numeric_limits<uint32_t>::max());
+
+    io::AttributeEncoder encoder;
+    encoder << int32_t(-42) << uint64_t(1) << costs << std::string("label") << bounds;
+
+    int32_t negative;
+    uint64_t positive;
+    std::vector<double> decodedCosts;
+    std::string label;
+    std::map<std::set<uint32_t>, std::pair<uint32_t, uint32_t> > decodedBounds;
+    io::AttributeDecoder decoder(encoder.str());
+    decoder >> negative >> positive >> decodedCosts >> label >> decodedBounds;
+
+    BOOST_REQUIRE_MESSAGE(decoder.atEnd(), "Expected all data to be decoded");
+    BOOST_REQUIRE(negative == -42 && positive == 1);
+    BOOST_REQUIRE(decodedCosts == costs && label == "label" && decodedBounds == bounds);
+
+    std::string truncated = encoder.str().substr(0, encoder.str().size() - 1);
+    io::AttributeDecoder truncatedDecoder(truncated);
+    BOOST_REQUIRE_THROW(truncatedDecoder >> negative >> positive >> decodedCosts >> label >> decodedBounds, std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(lazy_attributes)
+{
+    using namespace graph_analysis::algorithms;
+
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    MultiCommodityVertex::Ptr v0(new MultiCommodityVertex(2, "v0"));
+    v0->setCommoditySupply(1, -5);
+    MultiCommodityVertex::Ptr v1(new MultiCommodityVertex(2, "v1"));
+    MultiCommodityEdge::Ptr e0(new MultiCommodityEdge(2, "e0"));
+    e0->setSourceVertex(v0);
+    e0->setTargetVertex(v1);
+    e0->setCapacityUpperBound(10);
+    e0->setCommodityCost(1, 2.5);
+    graph->addEdge(e0);
+
+    std::vector<std::string> filenames;
+    filenames.push_back("/tmp/test-io-lazy-attributes.gbin");
+    filenames.push_back("/tmp/test-io-lazy-attributes.gexf");
+    for(size_t i = 0; i < filenames.size(); ++i)
+    {
+        BOOST_TEST_MESSAGE("Lazy attributes for: " << filenames[i]);
+        io::GraphIO::write(filenames[i], graph);
+
+        BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+        io::GraphIO::read(filenames[i], read_graph);
+
+        MultiCommodityEdge::Ptr edge = dynamic_pointer_cast<MultiCommodityEdge>(read_graph->getAllEdges().at(0));
+        BOOST_REQUIRE_MESSAGE(edge, "Expected a MultiCommodityEdge");
+        BOOST_REQUIRE_MESSAGE(edge->hasPendingAttributes(), "Expected attributes to be deserialized on first access");
+        BOOST_REQUIRE_EQUAL(edge->getCapacityUpperBound(), 10);
+        BOOST_REQUIRE_MESSAGE(!edge->hasPendingAttributes(), "Expected attributes to be deserialized");
+        BOOST_REQUIRE_EQUAL(edge->getCommodityCost(1), 2.5);
+
+        MultiCommodityVertex::Ptr vertex = dynamic_pointer_cast<MultiCommodityVertex>(edge->getSourceVertex());
+        BOOST_REQUIRE_MESSAGE(vertex, "Expected a MultiCommodityVertex");
+        BOOST_REQUIRE_EQUAL(vertex->getCommoditySupply(1), -5);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lazy_attributes_parallel_filters)
+{
+    using namespace graph_analysis::algorithms;
+
+    // Large enough to be filtered in multiple chunks
+    size_t numberOfVertices = 3000;
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    std::vector<Vertex::Ptr> vertices;
+    for(size_t v = 0; v < numberOfVertices; ++v)
+    {
+        std::stringstream ss;
+        ss << "v" << v;
+        MultiCommodityVertex::Ptr vertex(new MultiCommodityVertex(2, ss.str()));
+        vertex->setCommoditySupply(1, -static_cast<int32_t>(v % 10));
+        vertices.push_back(vertex);
+    }
+    graph->addVertices(vertices);
+    for(size_t v = 0; v < numberOfVertices; ++v)
+    {
+        MultiCommodityEdge::Ptr edge(new MultiCommodityEdge(2));
+        edge->setSourceVertex(vertices[v]);
+        edge->setTargetVertex(vertices[(v + 1) % numberOfVertices]);
+        graph->addEdge(edge);
+    }
+
+    std::string filename = "/tmp/test-io-lazy-attributes-parallel-filters.gbin";
+    io::GraphIO::write(filename, graph);
+    BaseGraph::Ptr read_graph = BaseGraph::getInstance();
+    io::GraphIO::read(filename, read_graph);
+
+    std::vector<Vertex::Ptr> readVertices = read_graph->getAllVertices();
+    std::vector<Edge::Ptr> readEdges = read_graph->getAllEdges();
+    BOOST_REQUIRE_EQUAL(readVertices.size(), numberOfVertices);
+    BOOST_REQUIRE_EQUAL(readEdges.size(), numberOfVertices);
+    for(size_t i = 0; i < readVertices.size(); ++i)
+    {
+        BOOST_REQUIRE_MESSAGE(readVertices[i]->hasPendingAttributes(), "Expected attributes to be deserialized on first access");
+    }
+
+    // Attributes of elements which are not evaluated remain pending
+    Filter< Vertex::Ptr >::Ptr vertexClassFilter(new filters::VertexRegexFilter("MultiCommodityVertex", filters::CLASS));
+    SubGraph::Ptr classSubgraph = BaseGraph::getSubGraph(read_graph);
+    classSubgraph->setParallelFiltersEnabled(true);
+    classSubgraph->applyFilters(vertexClassFilter, Filter< Edge::Ptr >::Ptr());
+    for(size_t i = 0; i < readEdges.size(); ++i)
+    {
+        BOOST_REQUIRE_MESSAGE(readEdges[i]->hasPendingAttributes(), "Expected edge attributes to remain pending");
+    }
+
+    // Content filters deserialize the attributes, class filters are matched
+    // once per class
+    SubGraph::Ptr subgraph = BaseGraph::getSubGraph(read_graph);
+    subgraph->setParallelFiltersEnabled(true);
+    Filter< Vertex::Ptr >::Ptr vertexFilter(new filters::VertexRegexFilter(".*supply/demand: \\[0,-7\\].*"));
+    Filter< Edge::Ptr >::Ptr edgeFilter(new filters::CombinedEdgeRegexFilter(filters::VertexRegexFilter("MultiCommodityVertex", filters::CLASS),
+                filters::EdgeRegexFilter("MultiCommodityEdge", filters::CLASS),
+                filters::VertexRegexFilter(".*supply/demand: \\[0,-4\\].*")));
+    subgraph->applyFilters(vertexFilter, edgeFilter);
+
+    for(size_t i = 0; i < readVertices.size(); ++i)
+    {
+        MultiCommodityVertex::Ptr vertex = dynamic_pointer_cast<MultiCommodityVertex>(readVertices[i]);
+        BOOST_REQUIRE_MESSAGE(vertex, "Expected a MultiCommodityVertex");
+        BOOST_REQUIRE_MESSAGE(!vertex->hasPendingAttributes(), "Expected attributes to be deserialized");
+        BOOST_REQUIRE_EQUAL(subgraph->enabled(vertex), vertex->getCommoditySupply(1) != -7);
+    }
+    for(size_t i = 0; i < readEdges.size(); ++i)
+    {
+        MultiCommodityVertex::Ptr source = dynamic_pointer_cast<MultiCommodityVertex>(readEdges[i]->getSourceVertex());
+        MultiCommodityVertex::Ptr target = dynamic_pointer_cast<MultiCommodityVertex>(readEdges[i]->getTargetVertex());
+        // Disabling a vertex might disable its edges as well
+        if(source->getCommoditySupply(1) != -7 && target->getCommoditySupply(1) != -7)
+        {
+            BOOST_REQUIRE_EQUAL(subgraph->enabled(readEdges[i]), target->getCommoditySupply(1) != -4);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,8 +1,64 @@
 #include <boost/test/unit_test.hpp>
 #include <graph_analysis/TransactionObserver.hpp>
+#include <graph_analysis/AsyncObserver.hpp>
+#include <graph_analysis/BaseGraph.hpp>
 
 using namespace graph_analysis;
 
+/**
+ * Observer which counts the received events
+ */
+class CountingObserver : public BaseGraphObserver
+{
+public:
+    CountingObserver(bool batches = false)
+        : batches(batches)
+        , numberOfBatches(0)
+        , added(0)
+        , removed(0)
+        , transactions(0)
+    {}
+
+    bool acceptsBatches() const { return batches; }
+
+    void notify(const Vertex::Ptr& vertex, const EventType& event, const GraphId& origin)
+    {
+        count(event);
+    }
+
+    void notify(const Edge::Ptr& edge, const EventType& event, const GraphId& origin)
+    {
+        count(event);
+    }
+
+    void notify(const TransactionType& event, const GraphId& origin)
+    {
+        ++transactions;
+    }
+
+    void notifyBatch(const std::vector<ObserverEvent>& events)
+    {
+        ++numberOfBatches;
+        BaseGraphObserver::notifyBatch(events);
+    }
+
+    void count(const EventType& event)
+    {
+        if(event == EVENT_TYPE_ADDED)
+        {
+            ++added;
+        } else {
+            ++removed;
+        }
+    }
+
+    bool batches;
+    size_t numberOfBatches;
+    size_t added;
+    size_t removed;
+    size_t transactions;
+};
+
 BOOST_AUTO_TEST_SUITE(observer)
 
 BOOST_AUTO_TEST_CASE(transactionObserver)
@@ -13,4 +69,174 @@ BOOST_AUTO_TEST_CASE(transactionObserver)
     // TODO do some actual testing
 }
 
+BOOST_AUTO_TEST_CASE(coalescing_transaction_observer)
+{
+    for(size_t spillThreshold = 0; spillThreshold < 10; spillThreshold += 3)
+    {
+        BOOST_TEST_MESSAGE("Spill threshold: " << spillThreshold);
+        BaseGraph::Ptr graph = BaseGraph::getInstance();
+        Vertex::Ptr v0(new Vertex("v0"));
+        Vertex::Ptr v1(new Vertex("v1"));
+        Vertex::Ptr v3(new Vertex("v3"));
+        graph->addVertex(v0);
+        graph->addVertex(v1);
+        graph->addVertex(v3);
+
+        shared_ptr<CountingObserver> observer(new CountingObserver());
+        BaseGraphObserver::Ptr baseObserver = observer;
+        TransactionObserver::Ptr transactionObserver = TransactionObserver::getInstance(baseObserver);
+        transactionObserver->setSpillThreshold(spillThreshold);
+        graph->addObserver(transactionObserver);
+
+        graph->transactionEvent(TRANSACTION_START);
+        std::vector<Edge::Ptr> edges;
+        for(size_t i = 0; i < 10; ++i)
+        {
+            Edge::Ptr edge(new Edge(v0, v1));
+            graph->addEdge(edge);
+            edges.push_back(edge);
+        }
+        // cancels out
+        Vertex::Ptr v2(new Vertex("v2"));
+        graph->addVertex(v2);
+        graph->removeVertex(v2);
+        // added, removed and added again: single event
+        graph->removeEdge(edges[0]);
+        graph->addEdge(edges[0]);
+        // existing vertex removed, added and removed again: single event
+        graph->removeVertex(v3);
+        graph->addVertex(v3);
+        graph->removeVertex(v3);
+        BOOST_REQUIRE_MESSAGE(observer->added == 0 && observer->removed == 0, "Expected events to be held");
+
+        graph->transactionEvent(TRANSACTION_STOP);
+        BOOST_REQUIRE_MESSAGE(observer->removed == 1, "Expected one removal, but got " << observer->removed);
+        BOOST_REQUIRE_MESSAGE(observer->added == 10, "Expected 10 additions, but got " << observer->added);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction_observer_readded_elements)
+{
+    for(size_t spillThreshold = 0; spillThreshold < 10; spillThreshold += 3)
+    {
+        BOOST_TEST_MESSAGE("Spill threshold: " << spillThreshold);
+        BaseGraph::Ptr graph = BaseGraph::getInstance();
+        Vertex::Ptr v0(new Vertex("v0"));
+        graph->addVertex(v0);
+
+        shared_ptr<CountingObserver> observer(new CountingObserver());
+        BaseGraphObserver::Ptr baseObserver = observer;
+        TransactionObserver::Ptr transactionObserver = TransactionObserver::getInstance(baseObserver);
+        transactionObserver->setSpillThreshold(spillThreshold);
+        graph->addObserver(transactionObserver);
+
+        graph->transactionEvent(TRANSACTION_START);
+        // existing vertex removed and added again: both events are kept
+        graph->removeVertex(v0);
+        graph->addVertex(v0);
+
+        // added and removed elements do not accumulate
+        Vertex::Ptr v1(new Vertex("v1"));
+        for(size_t i = 0; i < 100; ++i)
+        {
+            graph->addVertex(v1);
+            graph->removeVertex(v1);
+        }
+        if(spillThreshold > 2)
+        {
+            BOOST_REQUIRE_MESSAGE(transactionObserver->getNumberOfPendingEvents() <= 4, "Expected cancelled events not to be held, but "
+                    << transactionObserver->getNumberOfPendingEvents() << " events are pending");
+        }
+
+        graph->transactionEvent(TRANSACTION_STOP);
+        BOOST_REQUIRE_MESSAGE(observer->removed == 1, "Expected one removal, but got " << observer->removed);
+        BOOST_REQUIRE_MESSAGE(observer->added == 1, "Expected one addition, but got " << observer->added);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_observer)
+{
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    shared_ptr<CountingObserver> observer(new CountingObserver(true));
+    graph->addObserver(observer);
+
+    Vertex::Ptr v0(new Vertex("v0"));
+    graph->addVertex(v0);
+    BOOST_REQUIRE_MESSAGE(observer->numberOfBatches == 1 && observer->added == 1, "Expected immediate notification outside of a transaction");
+
+    Vertex::Ptr v1(new Vertex("v1"));
+    Vertex::Ptr v2(new Vertex("v2"));
+    Edge::Ptr e0(new Edge(v0, v1));
+    graph->transactionEvent(TRANSACTION_START);
+    graph->addEdge(e0);
+    graph->addVertex(v2);
+    graph->removeVertex(v2);
+    graph->transactionEvent(TRANSACTION_START);
+    graph->removeEdge(e0);
+    graph->addEdge(e0);
+    graph->transactionEvent(TRANSACTION_STOP);
+    BOOST_REQUIRE_MESSAGE(observer->numberOfBatches == 1, "Expected events to be held until the outermost transaction is stopped");
+    graph->transactionEvent(TRANSACTION_STOP);
+
+    BOOST_REQUIRE_MESSAGE(observer->numberOfBatches == 2, "Expected a single batch for the transaction");
+    BOOST_REQUIRE_MESSAGE(observer->added == 3 && observer->removed == 0, "Expected coalesced events: added " << observer->added << ", removed " << observer->removed);
+    BOOST_REQUIRE_EQUAL(observer->transactions, 4);
+}
+
+BOOST_AUTO_TEST_CASE(remove_vertex_with_edges)
+{
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    Vertex::Ptr v0(new Vertex("v0"));
+    Vertex::Ptr v1(new Vertex("v1"));
+    Edge::Ptr e0(new Edge(v0, v1));
+    graph->addEdge(e0);
+
+    shared_ptr<CountingObserver> observer(new CountingObserver());
+    graph->addObserver(observer);
+    shared_ptr<CountingObserver> batchObserver(new CountingObserver(true));
+    graph->addObserver(batchObserver);
+
+    Vertex::Ptr v2(new Vertex("v2"));
+    Edge::Ptr e1(new Edge(v1, v2));
+    Edge::Ptr e2(new Edge(v2, v2));
+    graph->transactionEvent(TRANSACTION_START);
+    graph->addEdge(e1);
+    graph->addEdge(e2);
+    graph->removeVertex(v2);
+    graph->removeVertex(v0);
+    graph->transactionEvent(TRANSACTION_STOP);
+
+    BOOST_REQUIRE_MESSAGE(!e0->associated(graph->getId()) && !e1->associated(graph->getId()) && !e2->associated(graph->getId()),
+            "Expected edges to be removed along with their vertices");
+    // v2, e1, e2 added and removed, v0 and e0 removed
+    BOOST_REQUIRE_MESSAGE(observer->added == 3 && observer->removed == 5, "Expected removal of edges to be reported: added " << observer->added << ", removed " << observer->removed);
+    BOOST_REQUIRE_MESSAGE(batchObserver->added == 0 && batchObserver->removed == 2, "Expected coalesced events: added " << batchObserver->added << ", removed " << batchObserver->removed);
+}
+
+BOOST_AUTO_TEST_CASE(async_observer)
+{
+    BaseGraph::Ptr graph = BaseGraph::getInstance();
+    shared_ptr<CountingObserver> observer(new CountingObserver());
+    AsyncObserver::Ptr asyncObserver(new AsyncObserver(observer, 4));
+    graph->addObserver(asyncObserver);
+
+    std::vector<Vertex::Ptr> vertices;
+    for(size_t i = 0; i < 100; ++i)
+    {
+        Vertex::Ptr vertex(new Vertex());
+        graph->addVertex(vertex);
+        vertices.push_back(vertex);
+    }
+    std::vector<Edge::Ptr> edges;
+    for(size_t i = 1; i < vertices.size(); ++i)
+    {
+        edges.push_back(Edge::Ptr(new Edge(vertices[i-1], vertices[i])));
+    }
+    graph->addEdges(edges);
+
+    asyncObserver->flush();
+    BOOST_REQUIRE_EQUAL(observer->added, vertices.size() + edges.size());
+    BOOST_REQUIRE_EQUAL(observer->transactions, 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()